@@ -0,0 +1,153 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Interrupt driven, debounced button events.
+ */
+
+#ifndef BUTTON_H_INCLUDED
+#define BUTTON_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "scheduler.h"
+#include "soft_timer.h"
+
+/* Number of buttons */
+#ifndef WE_BUTTON_MAX
+#define WE_BUTTON_MAX 4
+#endif
+
+/* Number of events that can be queued */
+#ifndef WE_BUTTON_QUEUE_SIZE
+#define WE_BUTTON_QUEUE_SIZE 16
+#endif
+
+/* Button event types */
+typedef enum WE_Button_EventType_t
+{
+    WE_Button_Event_Pressed,   /* Debounced press */
+    WE_Button_Event_Released,  /* Debounced release */
+    WE_Button_Event_Click,     /* One or more short presses, see clicks */
+    WE_Button_Event_LongPress  /* Held for longPressMs, no click follows */
+} WE_Button_EventType_t;
+
+/* Button event */
+typedef struct WE_Button_Event_t
+{
+    uint32_t timestamp;         /* WE_GetTickMicroseconds() at the first edge, or at the timeout for click and long press */
+    uint8_t button;             /* Index passed to WE_Button_Init() */
+    WE_Button_EventType_t type; /* Event type */
+    uint8_t clicks;             /* Number of clicks of a click event */
+} WE_Button_Event_t;
+
+/* Button configuration */
+typedef struct WE_Button_Config_t
+{
+    uint32_t pin;         /* Pin with external interrupt */
+    bool activeLow;       /* Button pulls to GND (internal pull-up) or to VCC (internal pull-down) */
+    uint16_t debounceMs;  /* Level must be stable this long, every edge restarts the time */
+    uint16_t longPressMs; /* Hold time of a long press, 0 to disable */
+    uint16_t clickGapMs;  /* Max. time between the clicks of a multi-click, 0 reports every click right away */
+} WE_Button_Config_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Start detecting events of a button.
+     *
+     * Edges are timestamped in the pin interrupt. Debouncing, long press and click timeouts
+     * run on software timers, so events do not depend on how often the application polls.
+     *
+     * @param[in] button Button index (< WE_BUTTON_MAX)
+     * @param[in] config Configuration
+     * @return true if request succeeded, false otherwise
+     */
+    extern bool WE_Button_Init(uint8_t button, const WE_Button_Config_t *config);
+
+    /**
+     * @brief Stop detecting events of a button.
+     *
+     * @param[in] button Button index
+     */
+    extern void WE_Button_Deinit(uint8_t button);
+
+    /**
+     * @brief Take the oldest event from the queue.
+     *
+     * @param[out] event Event
+     * @return true if an event was returned, false if the queue is empty
+     */
+    extern bool WE_Button_GetEvent(WE_Button_Event_t *event);
+
+    /**
+     * @brief Post a scheduler event to a task whenever the queue becomes non-empty.
+     *
+     * The task reads the queue with WE_Button_GetEvent() until it is empty, then the next
+     * button event is posted again.
+     *
+     * @param[in] task Task or NULL to stop posting
+     * @param[in] signal Signal of the posted event
+     */
+    extern void WE_Button_SetTask(WE_Task_t *task, uint16_t signal);
+
+    /**
+     * @brief Debounced state of a button.
+     *
+     * @param[in] button Button index
+     * @return true if the button is pressed, false otherwise
+     */
+    extern bool WE_Button_IsPressed(uint8_t button);
+
+    /**
+     * @brief Number of events lost because the queue was full.
+     *
+     * @return Number of lost events
+     */
+    extern uint32_t WE_Button_GetDroppedCount(void);
+
+    /**
+     * @brief Set up button 0 with the previous EasyButton behavior (active low, 35 ms debounce).
+     *
+     * OnBtnPress is called after a short press has been released, OnBtnLongPress once the button
+     * has been held for BTN_LONG_PRESS_DURATION_MS. Both are called from buttonUpdate().
+     */
+    extern void buttonInit(uint8_t pin, void (*OnBtnPress)(), void (*OnBtnLongPress)());
+
+    /**
+     * @brief Call the callbacks of the queued events of button 0.
+     */
+    extern void buttonUpdate();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BUTTON_H_INCLUDED */
@@ -0,0 +1,330 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Interrupt driven, debounced button events (M0Express).
+ */
+
+#include "button.h"
+
+#ifdef M0Express
+
+#include <Arduino.h>
+#include "global.h"
+
+/* State of one button, changed from the pin and the timer interrupts only */
+typedef struct WE_Button_t
+{
+    WE_Button_Config_t config;
+    bool initialized;
+    bool pressed;    /* Debounced state */
+    bool debouncing; /* Debounce timer running */
+    bool longFired;  /* Long press reported for the current press */
+    uint8_t clicks;  /* Clicks of the current multi-click */
+    uint32_t edgeTime;
+    WE_SoftTimer_t debounceTimer;
+    WE_SoftTimer_t holdTimer; /* Long press, then click gap */
+} WE_Button_t;
+
+static WE_Button_t buttons[WE_BUTTON_MAX];
+
+static WE_Button_Event_t buttonQueue[WE_BUTTON_QUEUE_SIZE];
+static uint8_t buttonQueueHead = 0;
+static uint8_t buttonQueueCount = 0;
+static uint32_t buttonDropped = 0;
+
+static WE_Task_t *buttonTask = NULL;
+static uint16_t buttonSignal = 0;
+static bool buttonPosted = false;
+
+static void (*legacyOnPress)() = NULL;
+static void (*legacyOnLongPress)() = NULL;
+
+static void WE_Button_Edge(uint8_t index);
+static void WE_Button_Debounced(WE_SoftTimer_t *timer, void *context);
+static void WE_Button_HoldExpired(WE_SoftTimer_t *timer, void *context);
+static void WE_Button_Push(uint8_t index, WE_Button_EventType_t type, uint8_t clicks, uint32_t timestamp);
+
+/* attachInterrupt() passes no context, one handler per button */
+static void WE_Button_Edge0() { WE_Button_Edge(0); }
+static void WE_Button_Edge1() { WE_Button_Edge(1); }
+static void WE_Button_Edge2() { WE_Button_Edge(2); }
+static void WE_Button_Edge3() { WE_Button_Edge(3); }
+static void (*const buttonEdgeHandlers[])() = {WE_Button_Edge0, WE_Button_Edge1, WE_Button_Edge2, WE_Button_Edge3};
+
+#if WE_BUTTON_MAX > 4
+#error "Add edge handlers for more than 4 buttons"
+#endif
+
+bool WE_Button_Init(uint8_t button, const WE_Button_Config_t *config)
+{
+    if ((button >= WE_BUTTON_MAX) || (NULL == config) || (config->debounceMs == 0) ||
+        (NOT_AN_INTERRUPT == digitalPinToInterrupt(config->pin)))
+    {
+        return false;
+    }
+
+    if (!WE_SoftTimer_Init())
+    {
+        return false;
+    }
+
+    WE_Button_Deinit(button);
+
+    WE_Button_t *b = &buttons[button];
+    memset(b, 0, sizeof(*b));
+    b->config = *config;
+
+    pinMode(config->pin, config->activeLow ? INPUT_PULLUP : INPUT_PULLDOWN);
+    b->pressed = ((digitalRead(config->pin) == LOW) == config->activeLow);
+    b->initialized = true;
+
+    attachInterrupt(digitalPinToInterrupt(config->pin), buttonEdgeHandlers[button], CHANGE);
+    return true;
+}
+
+void WE_Button_Deinit(uint8_t button)
+{
+    if ((button >= WE_BUTTON_MAX) || !buttons[button].initialized)
+    {
+        return;
+    }
+
+    WE_Button_t *b = &buttons[button];
+    detachInterrupt(digitalPinToInterrupt(b->config.pin));
+    WE_SoftTimer_Stop(&b->debounceTimer);
+    WE_SoftTimer_Stop(&b->holdTimer);
+    b->initialized = false;
+}
+
+bool WE_Button_GetEvent(WE_Button_Event_t *event)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (0 == buttonQueueCount)
+    {
+        /* Post again on the next event */
+        buttonPosted = false;
+        __set_PRIMASK(primask);
+        return false;
+    }
+
+    *event = buttonQueue[buttonQueueHead];
+    buttonQueueHead = (uint8_t)((buttonQueueHead + 1) % WE_BUTTON_QUEUE_SIZE);
+    buttonQueueCount--;
+
+    __set_PRIMASK(primask);
+    return true;
+}
+
+void WE_Button_SetTask(WE_Task_t *task, uint16_t signal)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    buttonTask = task;
+    buttonSignal = signal;
+    buttonPosted = false;
+    if ((NULL != buttonTask) && (buttonQueueCount > 0))
+    {
+        buttonPosted = WE_Scheduler_Post(buttonTask, buttonSignal, buttonQueueCount, NULL);
+    }
+
+    __set_PRIMASK(primask);
+}
+
+bool WE_Button_IsPressed(uint8_t button)
+{
+    return (button < WE_BUTTON_MAX) && buttons[button].pressed;
+}
+
+uint32_t WE_Button_GetDroppedCount(void)
+{
+    return buttonDropped;
+}
+
+void buttonInit(uint8_t pin, void (*OnBtnPress)(), void (*OnBtnLongPress)())
+{
+    WE_Button_Config_t config = {pin, true, 35, BTN_LONG_PRESS_DURATION_MS, 0};
+
+    legacyOnPress = OnBtnPress;
+    legacyOnLongPress = OnBtnLongPress;
+    WE_Button_Init(0, &config);
+}
+
+void buttonUpdate()
+{
+    WE_Button_Event_t event;
+
+    while (WE_Button_GetEvent(&event))
+    {
+        if (0 != event.button)
+        {
+            continue;
+        }
+        if ((WE_Button_Event_Click == event.type) && (NULL != legacyOnPress))
+        {
+            legacyOnPress();
+        }
+        else if ((WE_Button_Event_LongPress == event.type) && (NULL != legacyOnLongPress))
+        {
+            legacyOnLongPress();
+        }
+    }
+}
+
+/**
+ * @brief Pin interrupt: timestamp the first edge and (re)start debouncing.
+ *
+ * Every edge restarts the debounce time, the level is sampled once it has been stable that long.
+ */
+static void WE_Button_Edge(uint8_t index)
+{
+    WE_Button_t *b = &buttons[index];
+    uint32_t now = WE_GetTickMicroseconds();
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (b->initialized)
+    {
+        if (!b->debouncing)
+        {
+            b->debouncing = true;
+            b->edgeTime = now;
+        }
+        WE_SoftTimer_Start(&b->debounceTimer, (uint32_t)b->config.debounceMs * 1000, 0, WE_Button_Debounced, b);
+    }
+
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Debounce timer: take over the stable level and run the click state machine.
+ */
+static void WE_Button_Debounced(WE_SoftTimer_t *timer, void *context)
+{
+    (void)timer;
+    WE_Button_t *b = (WE_Button_t *)context;
+    uint8_t index = (uint8_t)(b - buttons);
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    b->debouncing = false;
+    bool pressed = ((digitalRead(b->config.pin) == LOW) == b->config.activeLow);
+
+    if (pressed != b->pressed)
+    {
+        b->pressed = pressed;
+
+        if (pressed)
+        {
+            WE_Button_Push(index, WE_Button_Event_Pressed, 0, b->edgeTime);
+            b->longFired = false;
+            WE_SoftTimer_Stop(&b->holdTimer);
+            if (b->config.longPressMs > 0)
+            {
+                WE_SoftTimer_Start(&b->holdTimer, (uint32_t)b->config.longPressMs * 1000, 0, WE_Button_HoldExpired, b);
+            }
+        }
+        else
+        {
+            WE_Button_Push(index, WE_Button_Event_Released, 0, b->edgeTime);
+            WE_SoftTimer_Stop(&b->holdTimer);
+            if (!b->longFired)
+            {
+                b->clicks++;
+                if (b->config.clickGapMs > 0)
+                {
+                    WE_SoftTimer_Start(&b->holdTimer, (uint32_t)b->config.clickGapMs * 1000, 0, WE_Button_HoldExpired, b);
+                }
+                else
+                {
+                    WE_Button_Push(index, WE_Button_Event_Click, b->clicks, b->edgeTime);
+                    b->clicks = 0;
+                }
+            }
+        }
+    }
+
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Hold timer: long press while pressed, end of a multi-click while released.
+ */
+static void WE_Button_HoldExpired(WE_SoftTimer_t *timer, void *context)
+{
+    (void)timer;
+    WE_Button_t *b = (WE_Button_t *)context;
+    uint8_t index = (uint8_t)(b - buttons);
+    uint32_t now = WE_GetTickMicroseconds();
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (b->pressed)
+    {
+        b->longFired = true;
+        b->clicks = 0;
+        WE_Button_Push(index, WE_Button_Event_LongPress, 0, now);
+    }
+    else if (b->clicks > 0)
+    {
+        WE_Button_Push(index, WE_Button_Event_Click, b->clicks, now);
+        b->clicks = 0;
+    }
+
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Queue an event and notify the task. Must be called with interrupts disabled.
+ */
+static void WE_Button_Push(uint8_t index, WE_Button_EventType_t type, uint8_t clicks, uint32_t timestamp)
+{
+    if (buttonQueueCount >= WE_BUTTON_QUEUE_SIZE)
+    {
+        buttonDropped++;
+        return;
+    }
+
+    WE_Button_Event_t *event = &buttonQueue[(buttonQueueHead + buttonQueueCount) % WE_BUTTON_QUEUE_SIZE];
+    event->timestamp = timestamp;
+    event->button = index;
+    event->type = type;
+    event->clicks = clicks;
+    buttonQueueCount++;
+
+    if ((NULL != buttonTask) && !buttonPosted)
+    {
+        buttonPosted = WE_Scheduler_Post(buttonTask, buttonSignal, buttonQueueCount, NULL);
+    }
+}
+
+#endif /* M0Express */
@@ -40,8 +40,22 @@
 
 #if defined(WE_DEBUG)
 
+#define WE_DEBUG_FLUSH_TIMEOUT_MS 1000
+
 TypeSerial *SerialDebug;
 
+/*
+ * Formatted records are queued in a ring buffer and sent to the debug serial interface
+ * later by WE_Debug_Process(), which WE_Delay(), the scheduler and WE_Idle_Enter() call
+ * before waiting. Printing therefore never waits for the USB transfer; if the ring buffer is
+ * full, the record is dropped and counted. The ring buffer is filled with interrupts disabled, so printing from ISRs is safe.
+ */
+static char DebugRing[WE_DEBUG_RING_SIZE];
+static volatile uint16_t DebugHead = 0; /* Next byte to be written */
+static volatile uint16_t DebugTail = 0; /* Next byte to be sent */
+static volatile bool DebugDraining = false;
+static WE_Debug_Stats_t DebugStats;
+
 /**
  * @brief Initializes UART2 and connects this interface to printf().
  *
@@ -49,10 +63,6 @@ TypeSerial *SerialDebug;
  * definitions of system file functions such as _write() (e.g. it might be necessary
  * to exclude the STM32CubeIDE-generated syscalls.c from compilation).
  *
- * Also note that it is not safe to call printf() from different contexts (e.g.
- * inside main and inside ISRs) - there is no guarantee, that the debug output is
- * forwarded correctly in all circumstances.
- *
  * There are two preprocessor defines controlling debug behavior:
  * - WE_DEBUG: Initialize debug UART and enable printing of debug messages in drivers.
  * - WE_DEBUG_INIT: Initialize debug UART but disable printing of debug messages in drivers
@@ -61,16 +71,211 @@ TypeSerial *SerialDebug;
  */
 void WE_Debug_Init()
 {
+    if (SerialDebug != NULL)
+    {
+        return;
+    }
     SerialDebug = SSerial_create(&Serial);
     SSerial_begin(SerialDebug, 921600);
 }
 
+/**
+ * @brief Formats a debug message and queues it for sending.
+ *
+ * Messages longer than WE_DEBUG_RECORD_SIZE - 1 characters are truncated.
+ */
 void WE_Debug_Print(const char format[], ...)
 {
+    char record[WE_DEBUG_RECORD_SIZE];
     va_list ap;
+
     va_start(ap, format);
-    SSerial_vprintf(SerialDebug, format, ap);
+    int length = vsnprintf(record, sizeof(record), format, ap);
     va_end(ap);
+
+    if (length < 0)
+    {
+        return;
+    }
+    if ((size_t)length >= sizeof(record))
+    {
+        DebugStats.truncated++;
+        length = sizeof(record) - 1;
+    }
+
+    WE_Debug_Write(record, length);
+}
+
+/**
+ * @brief Queues raw data for sending.
+ *
+ * @param[in] data Data to be sent
+ * @param[in] length Length of data in bytes
+ * @return true if the data was queued, false if it was dropped because the ring buffer is full
+ */
+bool WE_Debug_Write(const char *data, size_t length)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint16_t used = (uint16_t)((DebugHead - DebugTail + WE_DEBUG_RING_SIZE) % WE_DEBUG_RING_SIZE);
+    if (length > (size_t)(WE_DEBUG_RING_SIZE - 1 - used))
+    {
+        DebugStats.droppedRecords++;
+        DebugStats.droppedBytes += length;
+        __set_PRIMASK(primask);
+        return false;
+    }
+
+    uint16_t head = DebugHead;
+    size_t first = WE_DEBUG_RING_SIZE - head;
+    if (first > length)
+    {
+        first = length;
+    }
+    memcpy(&DebugRing[head], data, first);
+    memcpy(DebugRing, data + first, length - first);
+    DebugHead = (uint16_t)((head + length) % WE_DEBUG_RING_SIZE);
+
+    DebugStats.records++;
+    if (used + length > DebugStats.highWater)
+    {
+        DebugStats.highWater = (uint16_t)(used + length);
+    }
+
+    __set_PRIMASK(primask);
+    WE_EVENT_MARK(WE_EVENT_ID_LOG, length);
+    return true;
+}
+
+/**
+ * @brief Sends queued data as far as the debug serial interface accepts it without waiting.
+ *
+ * Called from WE_Delay(), WE_Scheduler_Run() and WE_Idle_Enter(); applications that use none
+ * of them call it from their main loop.
+ *
+ * @return true if queued data is left, false if the ring buffer is empty
+ */
+bool WE_Debug_Process()
+{
+    if (SerialDebug == NULL || DebugDraining)
+    {
+        return DebugHead != DebugTail;
+    }
+    DebugDraining = true;
+
+    uint16_t head = DebugHead;
+    uint16_t tail = DebugTail;
+    int space = SSerial_availableForWrite(SerialDebug);
+
+    while (tail != head && space > 0)
+    {
+        /* Contiguous part up to the end of the ring buffer */
+        size_t length = (head > tail) ? (size_t)(head - tail) : (size_t)(WE_DEBUG_RING_SIZE - tail);
+        if (length > (size_t)space)
+        {
+            length = space;
+        }
+
+        size_t written = SSerial_writeB(SerialDebug, &DebugRing[tail], length);
+        if (written == 0)
+        {
+            break;
+        }
+        tail = (uint16_t)((tail + written) % WE_DEBUG_RING_SIZE);
+        space -= written;
+    }
+
+    DebugTail = tail;
+    DebugDraining = false;
+    return DebugHead != DebugTail;
+}
+
+/**
+ * @brief Sends all queued data, waiting for the debug serial interface if necessary.
+ */
+void WE_Debug_Flush()
+{
+    uint32_t start = WE_GetTick();
+
+    if (SerialDebug == NULL)
+    {
+        return;
+    }
+
+    /* Give up if nobody reads the USB serial port */
+    while (WE_Debug_Process() && (WE_GetTick() - start) < WE_DEBUG_FLUSH_TIMEOUT_MS)
+    {
+    }
+    SSerial_flush(SerialDebug);
+}
+
+/**
+ * @brief Reads a byte received on the debug serial interface, e.g. a command.
+ *
+ * @return Received byte, -1 if none
+ */
+int WE_Debug_Read()
+{
+    if (SerialDebug == NULL || SSerial_available(SerialDebug) <= 0)
+    {
+        return -1;
+    }
+    return SSerial_read(SerialDebug);
+}
+
+/**
+ * @brief Handles single byte commands received on the debug serial interface.
+ *
+ * 'p' prints the profiling zones (WE_PROFILE), 'f' the frame statistics (WE_FRAME_MONITOR), 'r'
+ * resets both, 't' dumps the event trace (WE_EVENT_TRACE), 'm' prints the RAM usage. Other bytes
+ * are dropped. Called from the main loop.
+ */
+void WE_Debug_Poll()
+{
+    int command;
+    while ((command = WE_Debug_Read()) >= 0)
+    {
+        switch (command)
+        {
+        case 'p':
+            WE_Profile_Print();
+            break;
+
+        case 'r':
+            WE_Profile_Reset();
+            WE_FrameMonitor_Reset();
+            break;
+
+        case 't':
+            WE_EventTrace_Dump(NULL);
+            break;
+
+        case 'm':
+            WE_Memory_Print();
+            break;
+
+        case 'f':
+            WE_FrameMonitor_Print();
+            break;
+
+        default:
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Returns the debug log statistics.
+ *
+ * @param[out] stats Statistics
+ */
+void WE_Debug_GetStats(WE_Debug_Stats_t *stats)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *stats = DebugStats;
+    __set_PRIMASK(primask);
 }
 
 #endif // WE_DEBUG
@@ -31,25 +31,212 @@
 #ifndef GLOBAL_DEBUG_H_INCLUDED
 #define GLOBAL_DEBUG_H_INCLUDED
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
 #if defined(WE_DEBUG)
 
-#define WE_DEBUG_PRINT(string, ...) WE_Debug_Print(string, ##__VA_ARGS__);
+/* Size of the ring buffer holding formatted records until they are sent */
+#ifndef WE_DEBUG_RING_SIZE
+#define WE_DEBUG_RING_SIZE 1024
+#endif
+
+/* Maximum length of one formatted record, longer records are truncated */
+#ifndef WE_DEBUG_RECORD_SIZE
+#define WE_DEBUG_RECORD_SIZE 128
+#endif
+
+/* Log levels, messages above WE_DEBUG_LEVEL are removed at compile time */
+#define WE_DEBUG_LEVEL_ERROR 1
+#define WE_DEBUG_LEVEL_WARNING 2
+#define WE_DEBUG_LEVEL_INFO 3
+#define WE_DEBUG_LEVEL_VERBOSE 4
+
+#ifndef WE_DEBUG_LEVEL
+#define WE_DEBUG_LEVEL WE_DEBUG_LEVEL_INFO
+#endif
+
+#if WE_DEBUG_RECORD_SIZE > 257
+#error "WE_DEBUG_RECORD_SIZE exceeds the length field of tokenized records"
+#endif
+
+/* Start byte of a tokenized record: [start][payload length][token (u32)][arguments] */
+#define WE_DEBUG_TOKEN_START 0x1E
+#define WE_DEBUG_TOKEN_HEADER_SIZE 6
+
+#if defined(WE_DEBUG_TOKENIZED) && defined(__cplusplus)
+/* Only a hash of the format string and the raw arguments are queued, formatting is done
+ * on the host by Common/Utilities/log_tokens/log_tokens.py. The format string is only
+ * used in a constant expression, so it does not end up in flash. */
+#define WE_DEBUG_EMIT(string, ...)                                                                           \
+    do                                                                                                       \
+    {                                                                                                        \
+        WE_Debug_Record we_debug_record(std::integral_constant<uint32_t, WE_Debug_Token(string)>::value); \
+        WE_Debug_EncodeArgs(we_debug_record, ##__VA_ARGS__);                                                \
+        WE_Debug_Write((const char *)we_debug_record.data, we_debug_record.length);                         \
+    } while (0)
+#else
+#define WE_DEBUG_EMIT(string, ...) WE_Debug_Print(string, ##__VA_ARGS__)
+#endif
+
+#define WE_DEBUG_PRINT_LEVEL(level, string, ...)     \
+    do                                               \
+    {                                                \
+        if ((level) <= WE_DEBUG_LEVEL)               \
+        {                                            \
+            WE_DEBUG_EMIT(string, ##__VA_ARGS__);    \
+        }                                            \
+    } while (0)
+
+/* WE_DEBUG_PRINT reports errors, as all existing driver messages do */
+#define WE_DEBUG_PRINT(string, ...) WE_DEBUG_PRINT_LEVEL(WE_DEBUG_LEVEL_ERROR, string, ##__VA_ARGS__)
+#define WE_DEBUG_WARNING(string, ...) WE_DEBUG_PRINT_LEVEL(WE_DEBUG_LEVEL_WARNING, string, ##__VA_ARGS__)
+#define WE_DEBUG_INFO(string, ...) WE_DEBUG_PRINT_LEVEL(WE_DEBUG_LEVEL_INFO, string, ##__VA_ARGS__)
+#define WE_DEBUG_VERBOSE(string, ...) WE_DEBUG_PRINT_LEVEL(WE_DEBUG_LEVEL_VERBOSE, string, ##__VA_ARGS__)
 
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
+    /**
+     * @brief Debug log statistics.
+     */
+    typedef struct
+    {
+        uint32_t records;         /**< Records queued */
+        uint32_t droppedRecords;  /**< Records dropped because the ring buffer was full */
+        uint32_t droppedBytes;    /**< Bytes of the dropped records */
+        uint32_t truncated;       /**< Records cut to WE_DEBUG_RECORD_SIZE */
+        uint16_t highWater;       /**< Maximum ring buffer fill level in bytes */
+    } WE_Debug_Stats_t;
+
     void WE_Debug_Init();
 
     void WE_Debug_Print(const char format[], ...);
 
+    bool WE_Debug_Write(const char *data, size_t length);
+
+    bool WE_Debug_Process();
+
+    void WE_Debug_Flush();
+
+    int WE_Debug_Read();
+
+    void WE_Debug_Poll();
+
+    void WE_Debug_GetStats(WE_Debug_Stats_t *stats);
+
 #ifdef __cplusplus
 }
 #endif
 
+#if defined(WE_DEBUG_TOKENIZED) && defined(__cplusplus)
+#include <string.h>
+#include <type_traits>
+
+/**
+ * @brief Token of a format string (32 bit FNV-1a hash), evaluated at compile time.
+ */
+constexpr uint32_t WE_Debug_Token(const char *format, uint32_t hash = 2166136261u)
+{
+    return (*format == '\0') ? hash : WE_Debug_Token(format + 1, (hash ^ (uint8_t)*format) * 16777619u);
+}
+
+/**
+ * @brief Tokenized record being assembled on the stack.
+ */
+struct WE_Debug_Record
+{
+    uint8_t data[WE_DEBUG_RECORD_SIZE];
+    size_t length;
+
+    explicit WE_Debug_Record(uint32_t token)
+    {
+        data[0] = WE_DEBUG_TOKEN_START;
+        data[1] = 4;
+        memcpy(&data[2], &token, sizeof(token));
+        length = WE_DEBUG_TOKEN_HEADER_SIZE;
+    }
+
+    void append(const void *value, size_t size)
+    {
+        if (size > sizeof(data) - length)
+        {
+            size = sizeof(data) - length;
+        }
+        memcpy(&data[length], value, size);
+        length += size;
+        data[1] = (uint8_t)(length - 2);
+    }
+};
+
+/* Arguments are stored as promoted by printf: integers up to 32 bit as 4 bytes,
+ * 64 bit integers and floating point values as 8 bytes, strings with their terminator. */
+template <typename T>
+inline typename std::enable_if<(std::is_integral<T>::value || std::is_enum<T>::value) && sizeof(T) <= 4>::type
+WE_Debug_EncodeArg(WE_Debug_Record &record, T value)
+{
+    uint32_t raw = (uint32_t)value;
+    record.append(&raw, sizeof(raw));
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value && sizeof(T) == 8>::type
+WE_Debug_EncodeArg(WE_Debug_Record &record, T value)
+{
+    uint64_t raw = (uint64_t)value;
+    record.append(&raw, sizeof(raw));
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value>::type
+WE_Debug_EncodeArg(WE_Debug_Record &record, T value)
+{
+    double raw = value;
+    record.append(&raw, sizeof(raw));
+}
+
+inline void WE_Debug_EncodeArg(WE_Debug_Record &record, const char *value)
+{
+    /* Keep the terminator even if the string is cut */
+    size_t size = strlen(value);
+    if (size > sizeof(record.data) - record.length - 1)
+    {
+        size = (record.length < sizeof(record.data)) ? sizeof(record.data) - record.length - 1 : 0;
+    }
+    record.append(value, size);
+    record.append("", 1);
+}
+
+template <typename T>
+inline void WE_Debug_EncodeArg(WE_Debug_Record &record, const T *value)
+{
+    uint32_t raw = (uint32_t)(uintptr_t)value;
+    record.append(&raw, sizeof(raw));
+}
+
+inline void WE_Debug_EncodeArgs(WE_Debug_Record &record)
+{
+    (void)record;
+}
+
+template <typename T, typename... Args>
+inline void WE_Debug_EncodeArgs(WE_Debug_Record &record, T value, Args... args)
+{
+    WE_Debug_EncodeArg(record, value);
+    WE_Debug_EncodeArgs(record, args...);
+}
+#endif /* WE_DEBUG_TOKENIZED */
+
 #else
+#define WE_DEBUG_PRINT_LEVEL(level, string, ...)
 #define WE_DEBUG_PRINT(string, ...)
+#define WE_DEBUG_WARNING(string, ...)
+#define WE_DEBUG_INFO(string, ...)
+#define WE_DEBUG_VERBOSE(string, ...)
+#define WE_Debug_Poll()
 #endif /* WE_DEBUG */
 
 #endif /* GLOBAL_DEBUG_H_INCLUDED */
@@ -0,0 +1,225 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Event trace ring buffer.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "event_trace.h"
+
+#ifdef WE_EVENT_TRACE
+
+#if defined(WE_DEBUG)
+#include "debug.h"
+#endif
+
+#if defined(M0Express)
+#include <Arduino.h>
+#elif defined(BASE_PLATFORM)
+#include <Arduino.h>
+#include "ConfigPlatform.h"
+#endif
+
+/* Events per dump line */
+#define WE_EVENT_TRACE_LINE_EVENTS 4
+
+static WE_EventTrace_Event_t eventTraceRing[WE_EVENT_TRACE_SIZE];
+static volatile uint32_t eventTraceWritten = 0; /* Events recorded since the last clear */
+static volatile bool eventTraceStopped = false;
+
+static const char *eventTraceNames[WE_EVENT_TRACE_MAX_NAMES] = {
+    [WE_EVENT_ID_LOG] = "log",
+    [WE_EVENT_ID_ICLED_ENCODE] = "icled-encode",
+    [WE_EVENT_ID_ICLED_FRAME] = "icled-frame",
+    [WE_EVENT_ID_ICLED_DMA_ISR] = "icled-dma-isr",
+    [WE_EVENT_ID_SOFTTIMER_ISR] = "softtimer-isr",
+    [WE_EVENT_ID_UART_RX_ISR] = "uart-rx-isr",
+    [WE_EVENT_ID_UART_TX_ISR] = "uart-tx-isr",
+    [WE_EVENT_ID_UART_ERROR_ISR] = "uart-err-isr",
+    [WE_EVENT_ID_I2C_ISR] = "i2c-isr",
+    [WE_EVENT_ID_I2C_TRANSFER] = "i2c-transfer",
+};
+
+#if defined(M0Express)
+/**
+ * @brief Returns the cycles since start, to be called with interrupts disabled.
+ *
+ * The SysTick counts down from SysTick->LOAD once per millisecond. If it wrapped around
+ * while interrupts are disabled, millis() is not incremented yet and the pending flag is set.
+ */
+static inline uint32_t WE_EventTrace_Now(void)
+{
+    uint32_t ms = millis();
+    uint32_t ticks = SysTick->VAL;
+    if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+    {
+        ticks = SysTick->VAL;
+        ms++;
+    }
+    uint32_t load = SysTick->LOAD;
+    return ms * (load + 1) + (load - ticks);
+}
+
+static inline bool WE_EventTrace_InInterrupt(void) { return 0 != __get_IPSR(); }
+#elif defined(BASE_PLATFORM)
+static inline uint32_t WE_EventTrace_Now(void) { return (uint32_t)(BaseClock_now() * WE_EVENT_TRACE_CYCLES_PER_US); }
+
+static inline bool WE_EventTrace_InInterrupt(void) { return BaseClock_inInterrupt(); }
+#else
+static inline uint32_t WE_EventTrace_Now(void) { return 0; }
+
+static inline bool WE_EventTrace_InInterrupt(void) { return false; }
+#endif
+
+static void WE_EventTrace_WriteLine(WE_EventTrace_Write_t write, const char *line, size_t length);
+
+void WE_EventTrace_Record(uint8_t type, uint8_t id, uint16_t value)
+{
+#if defined(M0Express) || defined(BASE_PLATFORM)
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+#endif
+
+    if (!eventTraceStopped)
+    {
+        WE_EventTrace_Event_t *event = &eventTraceRing[eventTraceWritten & (WE_EVENT_TRACE_SIZE - 1)];
+        event->time = WE_EventTrace_Now();
+        event->type = WE_EventTrace_InInterrupt() ? (uint8_t)(type | WE_EVENT_TRACE_FLAG_ISR) : type;
+        event->id = id;
+        event->value = value;
+        eventTraceWritten++;
+    }
+
+#if defined(M0Express) || defined(BASE_PLATFORM)
+    __set_PRIMASK(primask);
+#endif
+}
+
+void WE_EventTrace_SetName(uint8_t id, const char *name)
+{
+    if (id < WE_EVENT_TRACE_MAX_NAMES)
+    {
+        eventTraceNames[id] = name;
+    }
+}
+
+void WE_EventTrace_Start(void) { eventTraceStopped = false; }
+
+void WE_EventTrace_Stop(void) { eventTraceStopped = true; }
+
+void WE_EventTrace_Clear(void) { eventTraceWritten = 0; }
+
+void WE_EventTrace_Dump(WE_EventTrace_Write_t write)
+{
+    static const char hex[] = "0123456789abcdef";
+    char line[16 + WE_EVENT_TRACE_LINE_EVENTS * sizeof(WE_EventTrace_Event_t) * 2 + 3];
+    int length;
+
+    bool stopped = eventTraceStopped;
+    eventTraceStopped = true;
+
+    uint32_t written = eventTraceWritten;
+    uint32_t count = (written < WE_EVENT_TRACE_SIZE) ? written : WE_EVENT_TRACE_SIZE;
+
+    length = snprintf(line, sizeof(line), "WE_EVENT_TRACE %d %d %lu %lu\r\n", WE_EVENT_TRACE_VERSION,
+                      WE_EVENT_TRACE_CYCLES_PER_US, (unsigned long)written, (unsigned long)count);
+    WE_EventTrace_WriteLine(write, line, (size_t)length);
+
+    for (uint8_t id = 0; id < WE_EVENT_TRACE_MAX_NAMES; id++)
+    {
+        if (NULL != eventTraceNames[id])
+        {
+            length = snprintf(line, sizeof(line), "WE_EVENT_NAME %u %s\r\n", (unsigned)id, eventTraceNames[id]);
+            if ((size_t)length >= sizeof(line))
+            {
+                /* Name truncated */
+                length = (int)sizeof(line) - 1;
+                line[length - 2] = '\r';
+                line[length - 1] = '\n';
+            }
+            WE_EventTrace_WriteLine(write, line, (size_t)length);
+        }
+    }
+
+    /* Oldest event first, the events are written as stored (little endian) */
+    for (uint32_t i = 0; i < count; i += WE_EVENT_TRACE_LINE_EVENTS)
+    {
+        size_t pos = (size_t)snprintf(line, sizeof(line), "WE_EVENT_DATA ");
+        for (uint32_t j = i; (j < count) && (j < i + WE_EVENT_TRACE_LINE_EVENTS); j++)
+        {
+            const WE_EventTrace_Event_t *event = &eventTraceRing[(written - count + j) & (WE_EVENT_TRACE_SIZE - 1)];
+            const uint8_t raw[sizeof(WE_EventTrace_Event_t)] = {
+                (uint8_t)event->time, (uint8_t)(event->time >> 8), (uint8_t)(event->time >> 16), (uint8_t)(event->time >> 24),
+                event->type, event->id, (uint8_t)event->value, (uint8_t)(event->value >> 8)};
+            for (size_t k = 0; k < sizeof(raw); k++)
+            {
+                line[pos++] = hex[raw[k] >> 4];
+                line[pos++] = hex[raw[k] & 0x0F];
+            }
+        }
+        line[pos++] = '\r';
+        line[pos++] = '\n';
+        WE_EventTrace_WriteLine(write, line, pos);
+    }
+
+    WE_EventTrace_WriteLine(write, "WE_EVENT_END\r\n", 14);
+#if defined(WE_DEBUG)
+    if (NULL == write)
+    {
+        WE_Debug_Flush();
+    }
+#endif
+
+    eventTraceStopped = stopped;
+}
+
+/**
+ * @brief Write one line of the dump, on the debug serial waiting for space in the ring buffer.
+ *
+ * @param[in] write Output, NULL for the debug serial
+ * @param[in] line Line
+ * @param[in] length Length of the line in bytes
+ */
+static void WE_EventTrace_WriteLine(WE_EventTrace_Write_t write, const char *line, size_t length)
+{
+    if (NULL != write)
+    {
+        write(line, length);
+        return;
+    }
+
+#if defined(WE_DEBUG)
+    if (!WE_Debug_Write(line, length))
+    {
+        WE_Debug_Flush();
+        WE_Debug_Write(line, length);
+    }
+#endif
+}
+
+#endif /* WE_EVENT_TRACE */
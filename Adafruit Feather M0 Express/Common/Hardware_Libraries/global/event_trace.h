@@ -0,0 +1,175 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Event trace ring buffer.
+ *
+ * Records timestamped events (begin/end of interrupts and other sections, frame output, log
+ * markers, counter values) into a ring buffer in RAM that always holds the latest
+ * WE_EVENT_TRACE_SIZE events. WE_EventTrace_Dump() writes the ring as text, which
+ * Common/Utilities/event_trace/event_trace.py converts into a Chrome trace (JSON) for
+ * chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Recording an event takes about 40 cycles on the M0Express with interrupts disabled, so the
+ * trace can stay enabled in release builds. Without WE_EVENT_TRACE defined all macros compile
+ * to nothing.
+ */
+
+#ifndef EVENT_TRACE_H_INCLUDED
+#define EVENT_TRACE_H_INCLUDED
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Number of events in the ring buffer (8 bytes each), a power of two */
+#ifndef WE_EVENT_TRACE_SIZE
+#define WE_EVENT_TRACE_SIZE 256
+#endif
+
+#if (WE_EVENT_TRACE_SIZE & (WE_EVENT_TRACE_SIZE - 1)) != 0
+#error "WE_EVENT_TRACE_SIZE must be a power of two"
+#endif
+
+/* Number of event ids that can be named */
+#ifndef WE_EVENT_TRACE_MAX_NAMES
+#define WE_EVENT_TRACE_MAX_NAMES 32
+#endif
+
+/* Timestamp clock, written to the dump for the conversion */
+#ifndef WE_EVENT_TRACE_CYCLES_PER_US
+#define WE_EVENT_TRACE_CYCLES_PER_US 48
+#endif
+
+/* Version of the dump format */
+#define WE_EVENT_TRACE_VERSION 1
+
+/* Events recorded by the SDK, the remaining ids are free for the application */
+#define WE_EVENT_ID_LOG 0            /* Debug message queued, value: length */
+#define WE_EVENT_ID_ICLED_ENCODE 1   /* Pixel buffer encoded into the SPI buffer */
+#define WE_EVENT_ID_ICLED_FRAME 2    /* ICLED frame on the wire, DMA job started until completed */
+#define WE_EVENT_ID_ICLED_DMA_ISR 3  /* ICLED DMA complete interrupt */
+#define WE_EVENT_ID_SOFTTIMER_ISR 4  /* Software timer interrupt */
+#define WE_EVENT_ID_UART_RX_ISR 5    /* UART receive timer interrupt */
+#define WE_EVENT_ID_UART_TX_ISR 6    /* UART transmit DMA complete interrupt */
+#define WE_EVENT_ID_UART_ERROR_ISR 7 /* UART SERCOM interrupt */
+#define WE_EVENT_ID_I2C_ISR 8        /* I2C SERCOM interrupt */
+#define WE_EVENT_ID_I2C_TRANSFER 9   /* Blocking I2C transfer */
+#define WE_EVENT_ID_APP 16           /* First id of the application */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Event types */
+    typedef enum
+    {
+        WE_EventTrace_Begin = 0,   /* Section begins */
+        WE_EventTrace_End = 1,     /* Section ends */
+        WE_EventTrace_Mark = 2,    /* Single point in time with a value */
+        WE_EventTrace_Counter = 3, /* New value of a counter */
+    } WE_EventTrace_Type_t;
+
+    /* Set in the type of events recorded in interrupt context */
+#define WE_EVENT_TRACE_FLAG_ISR 0x80
+
+    /* Event as stored in the ring buffer and written to the dump (little endian) */
+    typedef struct WE_EventTrace_Event_t
+    {
+        uint32_t time; /* Cycles, wraps around after 2^32 cycles */
+        uint8_t type;  /* WE_EventTrace_Type_t | WE_EVENT_TRACE_FLAG_ISR */
+        uint8_t id;
+        uint16_t value;
+    } WE_EventTrace_Event_t;
+
+    /* Receives the dump, e.g. to send it to another interface than the debug serial */
+    typedef void (*WE_EventTrace_Write_t)(const char *data, size_t length);
+
+#ifdef WE_EVENT_TRACE
+    /**
+     * @brief Record an event, may be called from interrupts.
+     *
+     * @param[in] type Event type (WE_EventTrace_Type_t)
+     * @param[in] id Event id
+     * @param[in] value Value of marks and counters
+     */
+    extern void WE_EventTrace_Record(uint8_t type, uint8_t id, uint16_t value);
+
+    /**
+     * @brief Name an event id for the dump, the SDK ids are named already.
+     *
+     * @param[in] id Event id
+     * @param[in] name Name, the string is not copied
+     */
+    extern void WE_EventTrace_SetName(uint8_t id, const char *name);
+
+    /**
+     * @brief Resume recording after WE_EventTrace_Stop(), recording is on after reset.
+     */
+    extern void WE_EventTrace_Start(void);
+
+    /**
+     * @brief Stop recording, e.g. to keep the events that led to an error until they are dumped.
+     */
+    extern void WE_EventTrace_Stop(void);
+
+    /**
+     * @brief Drop all recorded events.
+     */
+    extern void WE_EventTrace_Clear(void);
+
+    /**
+     * @brief Write the recorded events, oldest first.
+     *
+     * Recording is paused meanwhile. The dump consists of text lines starting with "WE_EVENT",
+     * other output on the same interface is ignored by the converter.
+     *
+     * @param[in] write Output, NULL for the debug serial (WE_DEBUG only)
+     */
+    extern void WE_EventTrace_Dump(WE_EventTrace_Write_t write);
+
+#define WE_EVENT_BEGIN(id) WE_EventTrace_Record(WE_EventTrace_Begin, (id), 0)
+#define WE_EVENT_END(id) WE_EventTrace_Record(WE_EventTrace_End, (id), 0)
+#define WE_EVENT_MARK(id, value) WE_EventTrace_Record(WE_EventTrace_Mark, (id), (uint16_t)(value))
+#define WE_EVENT_COUNTER(id, value) WE_EventTrace_Record(WE_EventTrace_Counter, (id), (uint16_t)(value))
+#else
+#define WE_EVENT_BEGIN(id) ((void)0)
+#define WE_EVENT_END(id) ((void)0)
+#define WE_EVENT_MARK(id, value) ((void)0)
+#define WE_EVENT_COUNTER(id, value) ((void)0)
+#define WE_EventTrace_SetName(id, name) ((void)0)
+#define WE_EventTrace_Start() ((void)0)
+#define WE_EventTrace_Stop() ((void)0)
+#define WE_EventTrace_Clear() ((void)0)
+#define WE_EventTrace_Dump(write) ((void)0)
+#endif /* WE_EVENT_TRACE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENT_TRACE_H_INCLUDED */
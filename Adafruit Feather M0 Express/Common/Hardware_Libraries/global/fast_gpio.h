@@ -0,0 +1,165 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Fast GPIO access and trace marker pins.
+ */
+
+#ifndef FAST_GPIO_H_INCLUDED
+#define FAST_GPIO_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "global_types.h"
+
+#ifdef M0Express
+
+#include <Arduino.h>
+
+/* Number of trace marker pins */
+#define WE_TRACE_MAX_PINS 8
+
+/* Trace markers driven by the SDK, the remaining ids are free for the application */
+#define WE_TRACE_ID_ICLED_ENCODE 0   /* Pixel buffer encoded into the SPI buffer */
+#define WE_TRACE_ID_ICLED_DMA 1      /* ICLED frame transfer, single frame output only */
+#define WE_TRACE_ID_SOFTTIMER_ISR 2  /* Software timer interrupt */
+#define WE_TRACE_ID_UART_RX 3        /* UART receive poll */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Pin resolved to its port group and bit mask.
+     *
+     * Zero initialized fast pins are valid and ignore all writes.
+     */
+    typedef struct WE_FastPin_t
+    {
+        uint32_t group; /* Port group (PA, PB) */
+        uint32_t mask;  /* Bit of the pin */
+    } WE_FastPin_t;
+
+    /**
+     * @brief Resolve a pin for fast access.
+     *
+     * The pin mode is not changed, configure it with WE_InitPins() first.
+     *
+     * @param[out] fastPin Fast pin
+     * @param[in] pin Pin
+     * @return true if request succeeded, false otherwise
+     */
+    static inline bool WE_FastPin_Init(WE_FastPin_t *fastPin, WE_Pin_t pin)
+    {
+        fastPin->group = 0;
+        fastPin->mask = 0;
+
+        if ((0 == pin.pin) || (pin.pin >= PINS_COUNT) || (NOT_A_PORT == g_APinDescription[pin.pin].ulPort))
+        {
+            return false;
+        }
+
+        fastPin->group = g_APinDescription[pin.pin].ulPort;
+        fastPin->mask = 1UL << g_APinDescription[pin.pin].ulPin;
+        return true;
+    }
+
+    /* Outputs are written over the single cycle IOBUS */
+
+    static inline void WE_FastPin_Set(const WE_FastPin_t *fastPin)
+    {
+        PORT_IOBUS->Group[fastPin->group].OUTSET.reg = fastPin->mask;
+    }
+
+    static inline void WE_FastPin_Clear(const WE_FastPin_t *fastPin)
+    {
+        PORT_IOBUS->Group[fastPin->group].OUTCLR.reg = fastPin->mask;
+    }
+
+    static inline void WE_FastPin_Toggle(const WE_FastPin_t *fastPin)
+    {
+        PORT_IOBUS->Group[fastPin->group].OUTTGL.reg = fastPin->mask;
+    }
+
+    static inline void WE_FastPin_Write(const WE_FastPin_t *fastPin, WE_Pin_Level_t level)
+    {
+        if (WE_Pin_Level_High == level)
+        {
+            WE_FastPin_Set(fastPin);
+        }
+        else
+        {
+            WE_FastPin_Clear(fastPin);
+        }
+    }
+
+    /* Inputs are read over the APB, the IOBUS only returns continuously sampled inputs */
+    static inline WE_Pin_Level_t WE_FastPin_Read(const WE_FastPin_t *fastPin)
+    {
+        return (PORT->Group[fastPin->group].IN.reg & fastPin->mask) ? WE_Pin_Level_High : WE_Pin_Level_Low;
+    }
+
+#ifdef WE_TRACE
+    extern WE_FastPin_t WE_TracePins[WE_TRACE_MAX_PINS];
+
+    /**
+     * @brief Assign marker pins to the trace ids.
+     *
+     * Trace markers are only compiled in with WE_TRACE defined. The pins are configured as
+     * outputs and driven low, ids without a pin (0) are ignored.
+     *
+     * @param[in] pins Marker pins, index is the trace id
+     * @param[in] numPins Number of marker pins (max. WE_TRACE_MAX_PINS)
+     * @return true if request succeeded, false otherwise
+     */
+    extern bool WE_Trace_Init(const uint32_t pins[], uint8_t numPins);
+
+/* Drive the marker pin of a trace id high around a section, e.g. for a logic analyzer */
+#define WE_TRACE_BEGIN(id) WE_FastPin_Set(&WE_TracePins[(id)])
+#define WE_TRACE_END(id) WE_FastPin_Clear(&WE_TracePins[(id)])
+#define WE_TRACE_TOGGLE(id) WE_FastPin_Toggle(&WE_TracePins[(id)])
+#else
+#define WE_TRACE_BEGIN(id) ((void)0)
+#define WE_TRACE_END(id) ((void)0)
+#define WE_TRACE_TOGGLE(id) ((void)0)
+#endif /* WE_TRACE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#else
+
+/* Trace markers need the port registers, they compile to nothing on other platforms */
+#define WE_TRACE_BEGIN(id) ((void)0)
+#define WE_TRACE_END(id) ((void)0)
+#define WE_TRACE_TOGGLE(id) ((void)0)
+
+#endif /* M0Express */
+
+#endif /* FAST_GPIO_H_INCLUDED */
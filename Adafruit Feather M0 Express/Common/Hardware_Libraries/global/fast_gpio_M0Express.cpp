@@ -0,0 +1,64 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Trace marker pins (M0Express).
+ */
+
+#include "fast_gpio.h"
+
+#if defined(M0Express) && defined(WE_TRACE)
+
+#include "global.h"
+
+WE_FastPin_t WE_TracePins[WE_TRACE_MAX_PINS];
+
+bool WE_Trace_Init(const uint32_t pins[], uint8_t numPins)
+{
+    if (numPins > WE_TRACE_MAX_PINS)
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < numPins; i++)
+    {
+        WE_Pin_t pin = {pins[i], WE_Pin_Type_Output};
+
+        if (0 == pin.pin)
+        {
+            continue;
+        }
+
+        if (!WE_InitPins(&pin, 1) || !WE_FastPin_Init(&WE_TracePins[i], pin))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#endif /* M0Express && WE_TRACE */
@@ -0,0 +1,275 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Frame deadline monitor.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "frame_monitor.h"
+
+#ifdef WE_FRAME_MONITOR
+
+#include "global.h"
+#include "watchdog.h"
+
+#if defined(WE_DEBUG)
+#include "debug.h"
+#endif
+
+#if defined(M0Express) || defined(BASE_PLATFORM)
+#include <Arduino.h>
+#define WE_FRAME_MONITOR_LOCK()          \
+    uint32_t primask = __get_PRIMASK(); \
+    __disable_irq()
+#define WE_FRAME_MONITOR_UNLOCK() __set_PRIMASK(primask)
+#else
+#define WE_FRAME_MONITOR_LOCK()
+#define WE_FRAME_MONITOR_UNLOCK()
+#endif
+
+static WE_FrameMonitor_Stats_t frameStats;
+static bool frameIntervalValid = false; /* lastRenderUs was taken with the current period */
+static bool framePending = false;       /* Frame rendered, its transfer has not started yet */
+static uint32_t framePendingRenderUs;
+static bool frameInFlight = false;      /* Transfer of a rendered frame running */
+static uint32_t frameInFlightRenderUs;
+
+void WE_FrameMonitor_SetPeriod(uint32_t periodUs)
+{
+    WE_FRAME_MONITOR_LOCK();
+    frameStats.periodUs = periodUs;
+    frameIntervalValid = false;
+    framePending = false;
+    frameInFlight = false;
+    WE_FRAME_MONITOR_UNLOCK();
+
+    if (0 == periodUs)
+    {
+        WE_FrameMonitor_StopWatchdog();
+    }
+    else if ((0 != frameStats.watchdogPeriods) && !WE_FrameMonitor_StartWatchdog(frameStats.watchdogPeriods))
+    {
+        /* Better no watchdog than one that expires within a frame period */
+        WE_FrameMonitor_StopWatchdog();
+    }
+}
+
+bool WE_FrameMonitor_StartWatchdog(uint8_t periods)
+{
+    if ((0 == periods) || (0 == frameStats.periodUs))
+    {
+        return false;
+    }
+
+    uint64_t timeoutMs = ((uint64_t)frameStats.periodUs * periods + 999) / 1000;
+    if ((timeoutMs > WE_WATCHDOG_MAX_TIMEOUT_MS) || !WE_Watchdog_Start((uint32_t)timeoutMs))
+    {
+        return false;
+    }
+
+    frameStats.watchdogPeriods = periods;
+    return true;
+}
+
+void WE_FrameMonitor_StopWatchdog(void)
+{
+    if (0 != frameStats.watchdogPeriods)
+    {
+        frameStats.watchdogPeriods = 0;
+        WE_Watchdog_Stop();
+    }
+}
+
+void WE_FrameMonitor_Render(bool torn)
+{
+    if (0 == frameStats.periodUs)
+    {
+        return;
+    }
+
+    uint32_t now = WE_GetTickMicroseconds();
+
+    WE_FRAME_MONITOR_LOCK();
+    if (frameIntervalValid)
+    {
+        uint32_t interval = now - frameStats.lastRenderUs;
+        if ((0 == frameStats.maxIntervalUs) || (interval < frameStats.minIntervalUs))
+        {
+            frameStats.minIntervalUs = interval;
+        }
+        if (interval > frameStats.maxIntervalUs)
+        {
+            frameStats.maxIntervalUs = interval;
+        }
+
+        /* Bin 0 within 2^SHIFT us of the period, then one bin per power of two */
+        uint32_t jitter = (interval > frameStats.periodUs) ? (interval - frameStats.periodUs) : (frameStats.periodUs - interval);
+        uint32_t scaled = jitter >> WE_FRAME_MONITOR_HISTOGRAM_SHIFT;
+        uint8_t bin = (0 == scaled) ? 0 : (uint8_t)(32 - __builtin_clz(scaled));
+        if (bin >= WE_FRAME_MONITOR_HISTOGRAM_BINS)
+        {
+            bin = WE_FRAME_MONITOR_HISTOGRAM_BINS - 1;
+        }
+        if (frameStats.histogram[bin] < UINT16_MAX)
+        {
+            frameStats.histogram[bin]++;
+        }
+    }
+
+    if (framePending)
+    {
+        frameStats.dropped++;
+    }
+    if (torn)
+    {
+        frameStats.torn++;
+    }
+    frameStats.frames++;
+    frameStats.lastRenderUs = now;
+    frameIntervalValid = true;
+    framePending = true;
+    framePendingRenderUs = now;
+    WE_FRAME_MONITOR_UNLOCK();
+
+    if (0 != frameStats.watchdogPeriods)
+    {
+        WE_Watchdog_Feed();
+    }
+}
+
+void WE_FrameMonitor_DmaStart(void)
+{
+    if (0 == frameStats.periodUs)
+    {
+        return;
+    }
+
+    uint32_t now = WE_GetTickMicroseconds();
+
+    WE_FRAME_MONITOR_LOCK();
+    frameStats.lastDmaUs = now;
+    if (framePending)
+    {
+        framePending = false;
+        frameInFlight = true;
+        frameInFlightRenderUs = framePendingRenderUs;
+    }
+    WE_FRAME_MONITOR_UNLOCK();
+}
+
+void WE_FrameMonitor_Latch(void)
+{
+    if (0 == frameStats.periodUs)
+    {
+        return;
+    }
+
+    uint32_t now = WE_GetTickMicroseconds();
+
+    WE_FRAME_MONITOR_LOCK();
+    frameStats.lastLatchUs = now;
+    if (frameInFlight)
+    {
+        frameInFlight = false;
+        frameStats.latched++;
+
+        uint32_t latency = now - frameInFlightRenderUs;
+        if (latency > frameStats.maxLatencyUs)
+        {
+            frameStats.maxLatencyUs = latency;
+        }
+        if (latency > frameStats.periodUs)
+        {
+            frameStats.late++;
+        }
+    }
+    WE_FRAME_MONITOR_UNLOCK();
+}
+
+void WE_FrameMonitor_GetStats(WE_FrameMonitor_Stats_t *stats)
+{
+    WE_FRAME_MONITOR_LOCK();
+    *stats = frameStats;
+    WE_FRAME_MONITOR_UNLOCK();
+
+    stats->watchdogReset = WE_Watchdog_CausedReset();
+}
+
+void WE_FrameMonitor_Reset(void)
+{
+    WE_FRAME_MONITOR_LOCK();
+    uint32_t periodUs = frameStats.periodUs;
+    uint8_t watchdogPeriods = frameStats.watchdogPeriods;
+    memset(&frameStats, 0, sizeof(frameStats));
+    frameStats.periodUs = periodUs;
+    frameStats.watchdogPeriods = watchdogPeriods;
+    frameIntervalValid = false;
+    framePending = false;
+    frameInFlight = false;
+    WE_FRAME_MONITOR_UNLOCK();
+}
+
+void WE_FrameMonitor_Print(void)
+{
+#if defined(WE_DEBUG)
+    WE_FrameMonitor_Stats_t stats;
+    WE_FrameMonitor_GetStats(&stats);
+
+    if (stats.watchdogReset)
+    {
+        WE_DEBUG_WARNING("Last reset was caused by the watchdog\r\n");
+    }
+    if (0 == stats.periodUs)
+    {
+        WE_DEBUG_INFO("Frame monitor stopped, no frame period set\r\n");
+        return;
+    }
+
+    WE_DEBUG_INFO("Frames [us]: period %lu, %lu rendered, %lu latched, %lu late, %lu dropped, %lu torn\r\n",
+                  (unsigned long)stats.periodUs, (unsigned long)stats.frames, (unsigned long)stats.latched,
+                  (unsigned long)stats.late, (unsigned long)stats.dropped, (unsigned long)stats.torn);
+    WE_DEBUG_INFO("Render interval min %lu max %lu, render to latch max %lu\r\n", (unsigned long)stats.minIntervalUs,
+                  (unsigned long)stats.maxIntervalUs, (unsigned long)stats.maxLatencyUs);
+
+    char histogram[WE_FRAME_MONITOR_HISTOGRAM_BINS * 6 + 1];
+    size_t length = 0;
+    for (uint8_t bin = 0; bin < WE_FRAME_MONITOR_HISTOGRAM_BINS; bin++)
+    {
+        length += (size_t)snprintf(&histogram[length], sizeof(histogram) - length, " %u", (unsigned)stats.histogram[bin]);
+    }
+    WE_DEBUG_INFO("Jitter histogram (<2^%d us, then x2):%s\r\n", WE_FRAME_MONITOR_HISTOGRAM_SHIFT, histogram);
+
+    if (0 != stats.watchdogPeriods)
+    {
+        WE_DEBUG_INFO("Watchdog armed, resets after %u frame periods without render\r\n", (unsigned)stats.watchdogPeriods);
+    }
+    WE_Debug_Flush();
+#endif
+}
+
+#endif /* WE_FRAME_MONITOR */
@@ -0,0 +1,163 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Frame deadline monitor.
+ *
+ * The LED drivers report three points of every frame: render start (the frame is written
+ * into the output buffer), DMA start (its transfer begins) and latch (the transfer including
+ * the latch time is complete). The monitor keeps a histogram of the deviation of the render
+ * interval from the nominal frame period and counts frames that were
+ *   late:    latched more than one frame period after their render start,
+ *   dropped: replaced by the next frame before their transfer started,
+ *   torn:    written into the buffer while the DMA was sending it.
+ * With continuous output the looping transfer picks up each frame, there is no latch per frame
+ * and only the render intervals and torn frames are measured.
+ *
+ * Optionally the hardware watchdog (see watchdog.h) resets the MCU when no frame was rendered
+ * for a number of frame periods. Without WE_FRAME_MONITOR defined all functions compile to
+ * nothing.
+ */
+
+#ifndef FRAME_MONITOR_H_INCLUDED
+#define FRAME_MONITOR_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Jitter histogram bins, bin 0 counts render intervals within 2^WE_FRAME_MONITOR_HISTOGRAM_SHIFT us
+   of the frame period, each further bin doubles the limit, the last bin counts everything above
+   (by default 64 us to 2^16 us, 65 ms) */
+#ifndef WE_FRAME_MONITOR_HISTOGRAM_BINS
+#define WE_FRAME_MONITOR_HISTOGRAM_BINS 12
+#endif
+#ifndef WE_FRAME_MONITOR_HISTOGRAM_SHIFT
+#define WE_FRAME_MONITOR_HISTOGRAM_SHIFT 6
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Frame statistics, times in microseconds */
+    typedef struct WE_FrameMonitor_Stats_t
+    {
+        uint32_t periodUs;       /* Nominal frame period, 0 while the monitor is stopped */
+        uint32_t frames;         /* Frames rendered */
+        uint32_t latched;        /* Frames latched by the LEDs (single frame output only) */
+        uint32_t late;           /* Frames latched more than one period after their render start */
+        uint32_t dropped;        /* Frames replaced before their transfer started */
+        uint32_t torn;           /* Frames written into the buffer while it was being sent */
+        uint32_t minIntervalUs;  /* Shortest time from one render start to the next */
+        uint32_t maxIntervalUs;  /* Longest time from one render start to the next */
+        uint32_t maxLatencyUs;   /* Longest time from render start to latch */
+        uint32_t lastRenderUs;   /* Render start of the last frame (WE_GetTickMicroseconds()) */
+        uint32_t lastDmaUs;      /* Last DMA start */
+        uint32_t lastLatchUs;    /* Last latch */
+        uint16_t histogram[WE_FRAME_MONITOR_HISTOGRAM_BINS]; /* Saturates at 65535 */
+        uint8_t watchdogPeriods; /* Frame periods without render until the watchdog resets, 0 if not armed */
+        bool watchdogReset;      /* The last reset was caused by the watchdog */
+    } WE_FrameMonitor_Stats_t;
+
+#ifdef WE_FRAME_MONITOR
+    /**
+     * @brief Set the nominal frame period and start monitoring.
+     *
+     * The statistics are kept, the next render interval is not measured. An armed watchdog is
+     * restarted with the new period.
+     *
+     * @param[in] periodUs Frame period in microseconds, 0 stops monitoring and the watchdog
+     */
+    extern void WE_FrameMonitor_SetPeriod(uint32_t periodUs);
+
+    /**
+     * @brief Arm the hardware watchdog, it resets the MCU when no frame is rendered for the given
+     * number of frame periods.
+     *
+     * Each render start feeds the watchdog. Stop it before pausing the output.
+     *
+     * @param[in] periods Number of frame periods (the timeout is rounded up, see WE_Watchdog_Start())
+     * @return true if request succeeded, false if no period is set or the timeout is too long
+     */
+    extern bool WE_FrameMonitor_StartWatchdog(uint8_t periods);
+
+    /**
+     * @brief Stop the watchdog armed by WE_FrameMonitor_StartWatchdog().
+     */
+    extern void WE_FrameMonitor_StopWatchdog(void);
+
+    /**
+     * @brief Render start of a frame, called by the LED driver.
+     *
+     * @param[in] torn true if the frame is written into the buffer the DMA is sending
+     */
+    extern void WE_FrameMonitor_Render(bool torn);
+
+    /**
+     * @brief Start of a transfer, called by the LED driver, also from interrupts.
+     */
+    extern void WE_FrameMonitor_DmaStart(void);
+
+    /**
+     * @brief End of a transfer including the latch time, called by the LED driver, also from interrupts.
+     */
+    extern void WE_FrameMonitor_Latch(void);
+
+    /**
+     * @brief Copy the statistics.
+     *
+     * @param[out] stats Statistics
+     */
+    extern void WE_FrameMonitor_GetStats(WE_FrameMonitor_Stats_t *stats);
+
+    /**
+     * @brief Clear the statistics, period and watchdog are kept.
+     */
+    extern void WE_FrameMonitor_Reset(void);
+
+    /**
+     * @brief Print the statistics on the debug serial (WE_DEBUG only).
+     *
+     * Also printed by WE_Debug_Poll() on receiving 'f', 'r' resets the statistics.
+     */
+    extern void WE_FrameMonitor_Print(void);
+#else
+#define WE_FrameMonitor_SetPeriod(periodUs) ((void)0)
+#define WE_FrameMonitor_StartWatchdog(periods) (false)
+#define WE_FrameMonitor_StopWatchdog() ((void)0)
+#define WE_FrameMonitor_Render(torn) ((void)0)
+#define WE_FrameMonitor_DmaStart() ((void)0)
+#define WE_FrameMonitor_Latch() ((void)0)
+#define WE_FrameMonitor_Reset() ((void)0)
+#define WE_FrameMonitor_Print() ((void)0)
+#endif /* WE_FRAME_MONITOR */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FRAME_MONITOR_H_INCLUDED */
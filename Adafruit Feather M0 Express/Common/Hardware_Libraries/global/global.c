@@ -30,9 +30,15 @@
 
 #include "global.h"
 #include "global_types.h"
+#include "soft_timer.h"
 
 #include <string.h>
 
+#if defined(WE_DEBUG)
+/* A USB packet of debug output may take up to 1 ms */
+#define WE_DEBUG_DRAIN_MARGIN_MS 2
+#endif
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -114,26 +120,131 @@ extern "C"
     {
         if (sleepForMs > 0)
         {
+#if defined(WE_DEBUG)
+            /* Send queued debug output while waiting, stop early enough not to overrun the delay */
+            uint32_t start = millis();
+            while (((millis() - start) + WE_DEBUG_DRAIN_MARGIN_MS) < sleepForMs && WE_Debug_Process())
+            {
+            }
+
+            uint32_t elapsed = millis() - start;
+            if (elapsed < sleepForMs)
+            {
+                delay(sleepForMs - elapsed);
+            }
+#else
             delay((uint32_t)sleepForMs);
+#endif
         }
     }
 
-    uint32_t WE_GetTick()
+    void WE_PrintPlatformMemory()
     {
-        return millis();
+#if defined(WE_DEBUG)
+        TypePlatformMemory memory;
+        PlatformMemory_get(&memory);
+
+#ifdef WE_STATIC_ALLOCATION
+        WE_DEBUG_INFO("Platform objects: %u in use, %lu of %lu bytes reserved, peak %lu bytes, %u failed\r\n",
+                      (unsigned)memory.objects, (unsigned long)memory.usedBytes, (unsigned long)memory.reservedBytes,
+                      (unsigned long)memory.peakBytes, (unsigned)memory.failures);
+#else
+        WE_DEBUG_INFO("Platform objects: %u in use, %lu bytes on the heap, peak %lu bytes, %u failed\r\n",
+                      (unsigned)memory.objects, (unsigned long)memory.usedBytes, (unsigned long)memory.peakBytes,
+                      (unsigned)memory.failures);
+#endif
+#endif
     }
 
 #ifndef WE_MICROSECOND_TICK
+    /* The M0 has no divider, ticks are divided by multiplying with the reciprocal */
+#if WE_SOFTTIMER_TICKS_PER_US != 3
+#error "The reciprocals of the time base assume 3 ticks per microsecond"
+#endif
+#define WE_TICKS_TO_US_RECIPROCAL 0xAAAAAAAAAAAAAAABULL /* ceil(2^65 / 3), exact for all 64 bit values */
+#define WE_TICKS_TO_US_SHIFT 1
+#define WE_TICKS_TO_MS_RECIPROCAL 0xAEC33E1F671529A5ULL /* ceil(2^75 / 3000), exact for all 64 bit values */
+#define WE_TICKS_TO_MS_SHIFT 11
+
+    /**
+     * @brief Upper 64 bits of the 128 bit product a * b.
+     */
+    static uint64_t WE_MultiplyHigh(uint64_t a, uint64_t b)
+    {
+        uint64_t aLow = (uint32_t)a;
+        uint64_t aHigh = a >> 32;
+        uint64_t bLow = (uint32_t)b;
+        uint64_t bHigh = b >> 32;
+
+        uint64_t low = aLow * bLow;
+        uint64_t middle = aHigh * bLow + (low >> 32);
+        uint64_t middle2 = aLow * bHigh + (uint32_t)middle;
+        return aHigh * bHigh + (middle >> 32) + (middle2 >> 32);
+    }
+
+    /* Set by WE_InitTimebase() once the counter of the software timers runs */
+    static volatile bool timebaseStarted = false;
+
+    bool WE_InitTimebase()
+    {
+        if (!timebaseStarted)
+        {
+            timebaseStarted = WE_SoftTimer_Init();
+        }
+        return timebaseStarted;
+    }
+
+    /**
+     * @brief Ticks of the time base, the counter of the software timers.
+     *
+     * micros() is used until WE_InitTimebase() has started the counter, or if it can not be started.
+     */
+    static uint64_t WE_GetTimebaseTicks()
+    {
+        if (!timebaseStarted)
+        {
+            return (uint64_t)micros() * WE_SOFTTIMER_TICKS_PER_US;
+        }
+
+        return WE_SoftTimer_GetTicks();
+    }
+
     void WE_DelayMicroseconds(uint32_t sleepForUsec)
     {
-        /* Microsecond tick is disabled: round to ms */
-        WE_Delay(((sleepForUsec + 500) / 1000));
+        uint64_t end = WE_GetTimebaseTicks() + (uint64_t)sleepForUsec * WE_SOFTTIMER_TICKS_PER_US;
+
+        /* Whole milliseconds are left to WE_Delay(), which sends debug output meanwhile */
+        uint32_t wholeMs = (sleepForUsec >= 2000) ? (sleepForUsec / 1000 - 1) : 0;
+        while (wholeMs > 0)
+        {
+            uint16_t chunk = (wholeMs > 0xFFFF) ? 0xFFFF : (uint16_t)wholeMs;
+            WE_Delay(chunk);
+            wholeMs -= chunk;
+        }
+
+        while (WE_GetTimebaseTicks() < end)
+        {
+        }
     }
 
     uint32_t WE_GetTickMicroseconds()
     {
-        /* Microsecond tick is disabled: return ms tick * 1000 */
-        return WE_GetTick() * 1000;
+        return (uint32_t)WE_GetTickMicroseconds64();
+    }
+
+    uint64_t WE_GetTickMicroseconds64()
+    {
+        return WE_MultiplyHigh(WE_GetTimebaseTicks(), WE_TICKS_TO_US_RECIPROCAL) >> WE_TICKS_TO_US_SHIFT;
+    }
+
+    uint32_t WE_GetTick()
+    {
+        return (uint32_t)(WE_MultiplyHigh(WE_GetTimebaseTicks(), WE_TICKS_TO_MS_RECIPROCAL) >> WE_TICKS_TO_MS_SHIFT);
+    }
+#else
+    uint32_t WE_GetTick()
+    {
+        return (uint32_t)(WE_GetTickMicroseconds64() / 1000);
     }
 #endif /* WE_MICROSECOND_TICK */
 
@@ -38,17 +38,23 @@
 
 #ifdef M0Express
 #include "global_M0Express.h"
+#include "button.h"
 #endif
+#include "fast_gpio.h"
+#include "profile.h"
+#include "event_trace.h"
+#include "memory_usage.h"
+#include "frame_monitor.h"
+
+#if defined(WE_DEBUG)
+#include "debug.h"
+#endif /* WE_DEBUG */
 
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
-#if defined(WE_DEBUG)
-#include "debug.h"
-#endif /* WE_DEBUG */
-
     /**
      * @brief Initialize GPIO pins.
      *
@@ -90,10 +96,20 @@ extern "C"
      */
     extern void WE_Delay(uint16_t sleepForMs);
 
+    /**
+     * @brief Starts the microsecond time base.
+     *
+     * Call first thing in setup(), before any driver reads the clock. Until then, and if the
+     * counter of the software timers can not be started, the clock falls back to micros().
+     *
+     * @return true if the time base runs on the software timer counter, false otherwise
+     */
+    extern bool WE_InitTimebase();
+
     /**
      * @brief Sleep function.
      *
-     * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
+     * Waits on the microsecond time base, so short delays are precise to about one microsecond.
      *
      * @param[in] sleepForUsec Delay in microseconds
      */
@@ -102,6 +118,9 @@ extern "C"
     /**
      * @brief Returns current tick value (in milliseconds).
      *
+     * Derived from WE_GetTickMicroseconds64(), so it keeps counting in standby.
+     * The value wraps around after 49 days, compare ticks by their difference.
+     *
      * @return Current tick value (in milliseconds)
      */
     extern uint32_t WE_GetTick();
@@ -109,12 +128,34 @@ extern "C"
     /**
      * @brief Returns current tick value (in microseconds).
      *
-     * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
+     * Lower 32 bits of WE_GetTickMicroseconds64(), the value wraps around after 71 minutes.
      *
      * @return Current tick value (in microseconds)
      */
     extern uint32_t WE_GetTickMicroseconds();
 
+    /**
+     * @brief Returns the monotonic 64-bit microsecond clock.
+     *
+     * The clock is the hardware counter of the software timers (see soft_timer.h), extended to
+     * 64 bits in its overflow interrupt. It is started by WE_InitTimebase() and never wraps around.
+     *
+     * Define WE_MICROSECOND_TICK to provide the time base elsewhere. The platform then implements
+     * WE_InitTimebase(), WE_DelayMicroseconds(), WE_GetTickMicroseconds() and this function, which
+     * WE_GetTick() is derived from (see global_Base.cpp).
+     *
+     * @return Microseconds since the clock was started
+     */
+    extern uint64_t WE_GetTickMicroseconds64();
+
+    /**
+     * @brief Prints the memory of the objects created by the platform layer and drivers (WE_DEBUG only).
+     *
+     * With WE_STATIC_ALLOCATION these objects live in static pools and the reserved bytes are
+     * the worst case, otherwise they are allocated on the heap and the peak is what was needed so far.
+     */
+    extern void WE_PrintPlatformMemory();
+
 #ifdef __cplusplus
 }
 #endif
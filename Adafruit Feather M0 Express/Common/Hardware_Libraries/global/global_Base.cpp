@@ -0,0 +1,68 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Time base of the host platform (BASE_PLATFORM).
+ */
+
+#include "global.h"
+
+#ifdef BASE_PLATFORM
+
+/* The host clock runs from the start of the process */
+bool WE_InitTimebase()
+{
+    return true;
+}
+
+/* The generic busy wait on the software timer counter would never see the simulated clock move */
+void WE_DelayMicroseconds(uint32_t sleepForUsec)
+{
+    uint64_t end = BaseClock_now() + sleepForUsec;
+
+    /* Whole milliseconds are left to WE_Delay(), which sends debug output meanwhile */
+    uint32_t wholeMs = (sleepForUsec >= 2000) ? (sleepForUsec / 1000 - 1) : 0;
+    while (wholeMs > 0)
+    {
+        uint16_t chunk = (wholeMs > 0xFFFF) ? 0xFFFF : (uint16_t)wholeMs;
+        WE_Delay(chunk);
+        wholeMs -= chunk;
+    }
+
+    BaseClock_waitUntil(end);
+}
+
+uint32_t WE_GetTickMicroseconds()
+{
+    return (uint32_t)BaseClock_now();
+}
+
+uint64_t WE_GetTickMicroseconds64()
+{
+    return BaseClock_now();
+}
+
+#endif /* BASE_PLATFORM */
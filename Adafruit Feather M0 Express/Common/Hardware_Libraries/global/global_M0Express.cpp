@@ -34,94 +34,1112 @@
 
 #include "global.h"
 #include "ConfigPlatform.h"
+#include "ArduinoTimer.h"
+#include "scheduler.h"
+#include "idle.h"
+#include <Adafruit_ZeroDMA.h>
+
+#if defined(UART_RXPin0_TXPin1) || defined(UART_RXPin11_TXPin10)
+
+/* Timer used to detect idle lines and hand received data to the application */
+#ifndef WE_UART_RX_TIMER
+#define WE_UART_RX_TIMER Timer4
+#endif
+
+/* Period of the receive timer in milliseconds */
+#ifndef WE_UART_RX_TICK_MS
+#define WE_UART_RX_TICK_MS 1
+#endif
+
+/* Number of entries of the transmit queue, a scatter-gather transmission takes one entry per segment */
+#ifndef WE_UART_TX_QUEUE_SIZE
+#define WE_UART_TX_QUEUE_SIZE 8
+#endif
+
+/* Time a blocking transmission may take in addition to the transfer time of the queued bytes */
+#ifndef WE_UART_TX_TIMEOUT_MS
+#define WE_UART_TX_TIMEOUT_MS 100
+#endif
+
+/* Entry of the transmit queue */
+typedef struct
+{
+    const uint8_t *data;
+    uint16_t length;
+    WE_UART_TxCallback_t callback; /* Set on the last segment of a transmission only */
+    void *context;
+} WE_UART_TxEntry_t;
+
+/**
+ * @brief State of a UART.
+ *
+ * Receive: A DMA channel copies every received byte from the SERCOM data register into a
+ * circular buffer. The receive timer compares the DMA write position with the last handed over
+ * position and passes the received bytes to the application as (at most two) contiguous
+ * spans once the line has been idle for a timer period or the buffer is half full.
+ * If a receive task is set, the task is notified by an event instead and reads the data itself.
+ * The bytes written by the DMA are counted every timer period. If the unread bytes reach the
+ * buffer size, the DMA has overwritten data that was not read yet and the unread data is dropped.
+ *
+ * Transmit: Queued buffers are written to the SERCOM data register by a second DMA channel,
+ * one queue entry per DMA job. The next entry is started from the completion interrupt of
+ * the previous one. An entry whose DMA job cannot be started is dropped, so the queue never stalls.
+ */
+typedef struct
+{
+    Sercom *sercom;
+    uint32_t baudrate;
+
+    Adafruit_ZeroDMA rxDma;
+    DmacDescriptor *rxDescriptor;
+    uint8_t rxBuffer[WE_UART_RX_BUFFER_SIZE];
+    uint16_t rxTail;
+    uint16_t rxLastHead;
+    uint16_t rxCountedHead;  /* DMA write position up to which rxUnread has been counted */
+    uint32_t rxUnread;       /* Bytes between rxTail and rxCountedHead, may exceed the buffer on overrun */
+    bool rxActive;
+    void (*handleRxData)(const uint8_t *data, uint16_t length);
+    WE_Task_t *rxTask;
+    uint16_t rxSignal;
+    volatile bool rxPosted;
+
+    Adafruit_ZeroDMA txDma;
+    DmacDescriptor *txDescriptor;
+    WE_UART_TxEntry_t txQueue[WE_UART_TX_QUEUE_SIZE];
+    volatile uint8_t txHead;
+    volatile uint8_t txCount;
+    volatile bool txBusy;
+
+    WE_UART_Stats_t stats;
+} WE_UART_t;
 
 #if defined(UART_RXPin0_TXPin1)
+static WE_UART_t uartSERCOM2;
+#endif
+
+#if defined(UART_RXPin11_TXPin10)
+static WE_UART_t uartSERCOM1;
+#endif
+
+static Timer uartRxTimer;
+static uint8_t uartRxActiveCount = 0;
+
+/**
+ * @brief Current write position of the receive DMA channel.
+ *
+ * The remaining beat count is taken from the active channel register while the channel
+ * is being served, otherwise from the channel's write-back descriptor.
+ */
+static uint16_t WE_UART_RxHead(WE_UART_t *uart)
+{
+    uint8_t channel = uart->rxDma.getChannel();
+    uint32_t active = DMAC->ACTIVE.reg;
+    uint16_t remaining;
+
+    if ((active & DMAC_ACTIVE_ABUSY) && ((active & DMAC_ACTIVE_ID_Msk) >> DMAC_ACTIVE_ID_Pos) == channel)
+    {
+        remaining = (uint16_t)((active & DMAC_ACTIVE_BTCNT_Msk) >> DMAC_ACTIVE_BTCNT_Pos);
+    }
+    else
+    {
+        remaining = ((DmacDescriptor *)DMAC->WRBADDR.reg)[channel].BTCNT.reg;
+    }
+
+    return (uint16_t)((WE_UART_RX_BUFFER_SIZE - remaining) % WE_UART_RX_BUFFER_SIZE);
+}
+
+/**
+ * @brief Count the bytes the DMA has written since the last call (interrupts disabled).
+ *
+ * The DMA must not write a whole buffer between two calls, the receive timer calls it every period.
+ *
+ * @param[in] uart UART state
+ * @param[in] head Current DMA write position
+ * @return true if no unread data has been overwritten, false on overrun (the unread data is dropped)
+ */
+static bool WE_UART_RxCount(WE_UART_t *uart, uint16_t head)
+{
+    uart->rxUnread += (uint16_t)((head + WE_UART_RX_BUFFER_SIZE - uart->rxCountedHead) % WE_UART_RX_BUFFER_SIZE);
+    uart->rxCountedHead = head;
+
+    if (uart->rxUnread < WE_UART_RX_BUFFER_SIZE)
+    {
+        return true;
+    }
+
+    uart->stats.rxOverruns++;
+    uart->rxTail = head;
+    uart->rxUnread = 0;
+    return false;
+}
+
+/**
+ * @brief Hand the received bytes to the application if the line is idle or the buffer is half full.
+ */
+static void WE_UART_RxPoll(WE_UART_t *uart)
+{
+    uint16_t head = WE_UART_RxHead(uart);
+
+    bool idle = (head == uart->rxLastHead);
+    uart->rxLastHead = head;
+
+    if (!WE_UART_RxCount(uart, head))
+    {
+        return;
+    }
+
+    uint16_t tail = uart->rxTail;
+    uint16_t pending = (uint16_t)uart->rxUnread;
+
+    if (pending == 0 || (!idle && pending < WE_UART_RX_BUFFER_SIZE / 2))
+    {
+        return;
+    }
+
+    if (uart->rxTask != NULL)
+    {
+        /* One event until the task has read */
+        if (!uart->rxPosted)
+        {
+            uart->rxPosted = WE_Scheduler_Post(uart->rxTask, uart->rxSignal, pending, NULL);
+        }
+        return;
+    }
+
+    if (head < tail)
+    {
+        uart->handleRxData(&uart->rxBuffer[tail], (uint16_t)(WE_UART_RX_BUFFER_SIZE - tail));
+        uart->stats.rxBatches++;
+        tail = 0;
+    }
+    if (head > tail)
+    {
+        uart->handleRxData(&uart->rxBuffer[tail], (uint16_t)(head - tail));
+        uart->stats.rxBatches++;
+    }
+
+    uart->rxTail = head;
+    uart->rxUnread = 0;
+    uart->stats.rxBytes += pending;
+}
+
+/**
+ * @brief Receive timer callback (interrupt context).
+ */
+static void WE_UART_RxTick()
+{
+    WE_TRACE_BEGIN(WE_TRACE_ID_UART_RX);
+    WE_PROFILE_BEGIN(WE_PROFILE_ZONE_UART_RX_ISR);
+    WE_EVENT_BEGIN(WE_EVENT_ID_UART_RX_ISR);
+#if defined(UART_RXPin0_TXPin1)
+    if (uartSERCOM2.rxActive)
+    {
+        WE_UART_RxPoll(&uartSERCOM2);
+    }
+#endif
+#if defined(UART_RXPin11_TXPin10)
+    if (uartSERCOM1.rxActive)
+    {
+        WE_UART_RxPoll(&uartSERCOM1);
+    }
+#endif
+    WE_EVENT_END(WE_EVENT_ID_UART_RX_ISR);
+    WE_PROFILE_END(WE_PROFILE_ZONE_UART_RX_ISR);
+    WE_TRACE_END(WE_TRACE_ID_UART_RX);
+}
+
+/**
+ * @brief Start DMA reception on an initialized SERCOM.
+ *
+ * @param[in] uart UART state
+ * @param[in] sercom SERCOM the UART is running on
+ * @param[in] trigger DMA trigger of the SERCOM's receive data register
+ * @param[in] handleRxData Receive handler of the UART
+ * @return true if request succeeded, false otherwise
+ */
+static bool WE_UART_RxStart(WE_UART_t *uart, Sercom *sercom, uint8_t trigger,
+                            void (*handleRxData)(const uint8_t *data, uint16_t length))
+{
+    uart->sercom = sercom;
+    uart->handleRxData = handleRxData;
+    uart->rxTail = 0;
+    uart->rxLastHead = 0;
+    uart->rxCountedHead = 0;
+    uart->rxUnread = 0;
+    uart->rxPosted = false;
+
+    /* Received bytes are fetched by the DMA, only errors are handled in the SERCOM interrupt */
+    sercom->USART.INTENCLR.reg = SERCOM_USART_INTENCLR_RXC;
+
+    if (uart->rxDescriptor == NULL)
+    {
+        uart->rxDma.setTrigger(trigger);
+        uart->rxDma.setAction(DMA_TRIGGER_ACTON_BEAT);
+        if (uart->rxDma.allocate() != DMA_STATUS_OK)
+        {
+            WE_DEBUG_PRINT("No DMA channel available for UART reception\r\n");
+            return false;
+        }
+        uart->rxDescriptor = uart->rxDma.addDescriptor((void *)&sercom->USART.DATA.reg, uart->rxBuffer, WE_UART_RX_BUFFER_SIZE,
+                                               DMA_BEAT_SIZE_BYTE, false, true);
+        uart->rxDma.loop(true);
+    }
+    else
+    {
+        uart->rxDma.changeDescriptor(uart->rxDescriptor, (void *)&sercom->USART.DATA.reg, uart->rxBuffer, WE_UART_RX_BUFFER_SIZE);
+    }
+
+    if (uart->rxDma.startJob() != DMA_STATUS_OK)
+    {
+        WE_DEBUG_PRINT("UART receive DMA could not be started\r\n");
+        return false;
+    }
+
+    if (uartRxActiveCount == 0)
+    {
+        if (!Timer_create(&uartRxTimer, WE_UART_RX_TIMER) ||
+            !Timer_schedule(&uartRxTimer, false, Timer_Periodic, WE_UART_RX_TICK_MS, WE_UART_RxTick) ||
+            !Timer_start(&uartRxTimer))
+        {
+            WE_DEBUG_PRINT("UART receive timer %d not available\r\n", (int)WE_UART_RX_TIMER);
+            uart->rxDma.abort();
+            return false;
+        }
+    }
+    uartRxActiveCount++;
+    uart->rxActive = true;
+
+    return true;
+}
+
+/**
+ * @brief Stop DMA reception.
+ *
+ * @param[in] uart UART state
+ */
+static void WE_UART_RxStop(WE_UART_t *uart)
+{
+    if (!uart->rxActive)
+    {
+        return;
+    }
+
+    uart->rxActive = false;
+    uart->rxDma.abort();
+
+    if (--uartRxActiveCount == 0)
+    {
+        Timer_stop(&uartRxTimer);
+    }
+}
+
+/**
+ * @brief Notify a scheduler task about received data instead of calling the receive handler.
+ *
+ * @param[in] uart UART state
+ * @param[in] task Task, NULL to use the receive handler
+ * @param[in] signal Signal of the event
+ */
+static void WE_UART_SetRxTask(WE_UART_t *uart, WE_Task_t *task, uint16_t signal)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uart->rxTask = task;
+    uart->rxSignal = signal;
+    uart->rxPosted = false;
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Copy received bytes out of the receive buffer (receive task mode).
+ *
+ * @param[in] uart UART state
+ * @param[out] buffer Destination
+ * @param[in] size Size of the destination
+ * @return Number of bytes copied
+ */
+static uint16_t WE_UART_Read(WE_UART_t *uart, uint8_t *buffer, uint16_t size)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint16_t head = WE_UART_RxHead(uart);
+    WE_UART_RxCount(uart, head);
+    uint16_t tail = uart->rxTail;
+    uint32_t overruns = uart->stats.rxOverruns;
+    __set_PRIMASK(primask);
+
+    uint16_t copied = 0;
+
+    while (tail != head && copied < size)
+    {
+        uint16_t chunk = (uint16_t)(((head > tail) ? head : WE_UART_RX_BUFFER_SIZE) - tail);
+        if (chunk > size - copied)
+        {
+            chunk = (uint16_t)(size - copied);
+        }
+        memcpy(&buffer[copied], &uart->rxBuffer[tail], chunk);
+        copied = (uint16_t)(copied + chunk);
+        tail = (uint16_t)((tail + chunk) % WE_UART_RX_BUFFER_SIZE);
+    }
+
+    __disable_irq();
+    /* The DMA may have overwritten the data while it was copied */
+    if (!WE_UART_RxCount(uart, WE_UART_RxHead(uart)) || uart->stats.rxOverruns != overruns)
+    {
+        copied = 0;
+    }
+    else
+    {
+        uart->rxTail = tail;
+        uart->rxUnread -= copied;
+    }
+    if (copied > 0)
+    {
+        uart->stats.rxBytes += copied;
+        uart->stats.rxBatches++;
+    }
+
+    /* Data that is left or arrives from now on is announced by the next event */
+    uart->rxPosted = false;
+    __set_PRIMASK(primask);
+    return copied;
+}
+
+/**
+ * @brief Count and clear receive errors (SERCOM interrupt context).
+ */
+static void WE_UART_HandleErrors(WE_UART_t *uart)
+{
+    SercomUsart *usart = &uart->sercom->USART;
+
+    if (usart->INTFLAG.bit.ERROR)
+    {
+        uart->stats.rxErrors++;
+        usart->INTFLAG.reg = SERCOM_USART_INTFLAG_ERROR;
+        usart->STATUS.reg = SERCOM_USART_STATUS_BUFOVF | SERCOM_USART_STATUS_FERR | SERCOM_USART_STATUS_PERR;
+    }
+}
+
+/**
+ * @brief Remove the oldest entry from the transmit queue (interrupts disabled).
+ *
+ * @param[in] uart UART state
+ * @param[in] sent false if the entry is dropped without being sent
+ * @return The removed entry
+ */
+static WE_UART_TxEntry_t WE_UART_TxPop(WE_UART_t *uart, bool sent)
+{
+    WE_UART_TxEntry_t entry = uart->txQueue[uart->txHead];
+
+    uart->txHead = (uint8_t)((uart->txHead + 1) % WE_UART_TX_QUEUE_SIZE);
+    uart->txCount--;
+    uart->stats.txBytesInFlight -= entry.length;
+    uart->stats.txQueueDepth = uart->txCount;
+    if (sent)
+    {
+        uart->stats.txBytes += entry.length;
+    }
+    else
+    {
+        uart->stats.txFailed++;
+    }
+    return entry;
+}
+
+/**
+ * @brief Start the DMA job of the oldest queue entry (interrupts disabled).
+ *
+ * Entries whose DMA job cannot be started are dropped and their callbacks are called,
+ * so waiting transmissions return and the following entries are not stuck behind them.
+ */
+static void WE_UART_TxStartNext(WE_UART_t *uart)
+{
+    uart->txBusy = false;
+
+    while (uart->txCount > 0)
+    {
+        WE_UART_TxEntry_t *entry = &uart->txQueue[uart->txHead];
+
+        uart->txDma.changeDescriptor(uart->txDescriptor, (void *)entry->data, (void *)&uart->sercom->USART.DATA.reg, entry->length);
+        if (uart->txDma.startJob() == DMA_STATUS_OK)
+        {
+            uart->txBusy = true;
+            return;
+        }
+
+        WE_UART_TxEntry_t dropped = WE_UART_TxPop(uart, false);
+        if (dropped.callback != NULL)
+        {
+            dropped.callback(dropped.context, false);
+        }
+    }
+}
+
+/**
+ * @brief Drop all queued entries and abort the running DMA job.
+ *
+ * @param[in] uart UART state
+ */
+static void WE_UART_TxFlush(WE_UART_t *uart)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uart->txDma.abort();
+    uart->txBusy = false;
+    while (uart->txCount > 0)
+    {
+        WE_UART_TxEntry_t dropped = WE_UART_TxPop(uart, false);
+        if (dropped.callback != NULL)
+        {
+            dropped.callback(dropped.context, false);
+        }
+    }
+
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Transmit DMA job completed (DMAC interrupt context).
+ */
+static void WE_UART_TxDone(WE_UART_t *uart)
+{
+    if (uart->txCount == 0)
+    {
+        /* The queue has been flushed */
+        return;
+    }
+
+    WE_UART_TxEntry_t entry = WE_UART_TxPop(uart, true);
+    WE_UART_TxStartNext(uart);
+
+    if (entry.callback != NULL)
+    {
+        entry.callback(entry.context, true);
+    }
+}
+
+/**
+ * @brief Append segments to the transmit queue.
+ *
+ * The segments are queued either completely or not at all.
+ *
+ * @param[in] uart UART state
+ * @param[in] segments Buffers to be sent in order
+ * @param[in] count Number of segments
+ * @param[in] callback Called after the last segment has been sent (may be NULL)
+ * @param[in] context Passed to callback
+ * @return true if the segments have been queued, false if the queue is full
+ */
+static bool WE_UART_TxEnqueue(WE_UART_t *uart, const WE_UART_TxSegment_t *segments, uint8_t count,
+                              WE_UART_TxCallback_t callback, void *context)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (uart->txDescriptor == NULL || count > WE_UART_TX_QUEUE_SIZE - uart->txCount)
+    {
+        __set_PRIMASK(primask);
+        return false;
+    }
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        WE_UART_TxEntry_t *entry = &uart->txQueue[(uart->txHead + uart->txCount) % WE_UART_TX_QUEUE_SIZE];
+        entry->data = segments[i].data;
+        entry->length = segments[i].length;
+        entry->callback = (i == count - 1) ? callback : NULL;
+        entry->context = context;
+        uart->txCount++;
+        uart->stats.txBytesInFlight += segments[i].length;
+    }
 
+    uart->stats.txQueueDepth = uart->txCount;
+    if (uart->txCount > uart->stats.txQueueHighWater)
+    {
+        uart->stats.txQueueHighWater = uart->txCount;
+    }
+
+    if (!uart->txBusy)
+    {
+        WE_UART_TxStartNext(uart);
+    }
+
+    __set_PRIMASK(primask);
+    return true;
+}
+
+/**
+ * @brief Queue segments for transmission, see WE_UART_*_TransmitAsync.
+ */
+static bool WE_UART_TransmitAsync(WE_UART_t *uart, const WE_UART_TxSegment_t *segments, uint8_t count,
+                                  WE_UART_TxCallback_t callback, void *context)
+{
+    if (count == 0)
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (segments[i].data == NULL || segments[i].length == 0)
+        {
+            WE_DEBUG_PRINT("UART transmit segment %d is empty\r\n", i);
+            return false;
+        }
+    }
+
+    if (!WE_UART_TxEnqueue(uart, segments, count, callback, context))
+    {
+        uart->stats.txRejected++;
+        return false;
+    }
+    return true;
+}
+
+/* Completion state of a blocking transmission */
+typedef struct
+{
+    volatile bool done;
+    volatile bool sent;
+} WE_UART_TxWait_t;
+
+static void WE_UART_TxSignal(void *context, bool sent)
+{
+    WE_UART_TxWait_t *wait = (WE_UART_TxWait_t *)context;
+    wait->sent = sent;
+    wait->done = true;
+}
+
+/**
+ * @brief Time to wait for the transmission of the queued bytes and length more bytes.
+ *
+ * Transfer time (10 bit times per byte) plus WE_UART_TX_TIMEOUT_MS. With flow control the
+ * peer can hold the transmission off indefinitely, the timeout releases the caller then.
+ */
+static uint32_t WE_UART_TxTimeout(const WE_UART_t *uart, uint16_t length)
+{
+    if (uart->baudrate == 0)
+    {
+        return WE_UART_TX_TIMEOUT_MS;
+    }
+    return WE_UART_TX_TIMEOUT_MS + (uint32_t)(((uint64_t)(uart->stats.txBytesInFlight + length) * 10u * 1000u) / uart->baudrate);
+}
+
+/**
+ * @brief Queue a buffer for transmission and wait until it has been sent, see WE_UART_*_Transmit.
+ */
+static bool WE_UART_Transmit(WE_UART_t *uart, const char *data, uint16_t length)
+{
+    WE_UART_TxWait_t wait = {false, false};
+    WE_UART_TxSegment_t segment = {(const uint8_t *)data, length};
+
+    if (length == 0)
+    {
+        return true;
+    }
+    if (uart->txDescriptor == NULL)
+    {
+        return false;
+    }
+
+    uint32_t timeout = WE_UART_TxTimeout(uart, length);
+    uint32_t start = WE_GetTick();
+
+    /* Wait for a free queue entry */
+    while (!WE_UART_TxEnqueue(uart, &segment, 1, WE_UART_TxSignal, (void *)&wait))
+    {
+        if ((WE_GetTick() - start) >= timeout)
+        {
+            WE_DEBUG_PRINT("UART transmit queue is stuck\r\n");
+            WE_UART_TxFlush(uart);
+            return false;
+        }
+    }
+
+    while (!wait.done)
+    {
+        if ((WE_GetTick() - start) >= timeout)
+        {
+            /* The queue entry points to this stack frame, it must not outlive the call */
+            WE_DEBUG_PRINT("UART transmission timed out\r\n");
+            WE_UART_TxFlush(uart);
+        }
+    }
+    return wait.sent;
+}
+
+/**
+ * @brief Set up the transmit DMA channel.
+ *
+ * @param[in] uart UART state
+ * @param[in] trigger DMA trigger of the SERCOM's transmit data register
+ * @param[in] txDone Completion callback of the UART's DMA channel
+ * @return true if request succeeded, false otherwise
+ */
+static bool WE_UART_TxStart(WE_UART_t *uart, uint8_t trigger, void (*txDone)(Adafruit_ZeroDMA *dma))
+{
+    uart->txHead = 0;
+    uart->txCount = 0;
+    uart->txBusy = false;
+
+    if (uart->txDescriptor != NULL)
+    {
+        return true;
+    }
+
+    uart->txDma.setTrigger(trigger);
+    uart->txDma.setAction(DMA_TRIGGER_ACTON_BEAT);
+    if (uart->txDma.allocate() != DMA_STATUS_OK)
+    {
+        WE_DEBUG_PRINT("No DMA channel available for UART transmission\r\n");
+        return false;
+    }
+    uart->txDescriptor = uart->txDma.addDescriptor(NULL, (void *)&uart->sercom->USART.DATA.reg, 0,
+                                                   DMA_BEAT_SIZE_BYTE, true, false);
+    uart->txDma.setCallback(txDone);
+
+    return true;
+}
+
+/**
+ * @brief Wait for the transmit queue to drain and stop the transmit DMA channel.
+ *
+ * Entries that are not sent within WE_UART_TxTimeout(), e.g. because the peer holds CTS
+ * inactive, are dropped.
+ *
+ * @param[in] uart UART state
+ */
+static void WE_UART_TxStop(WE_UART_t *uart)
+{
+    uint32_t timeout = WE_UART_TxTimeout(uart, 0);
+    uint32_t start = WE_GetTick();
+
+    while (uart->txCount > 0 && uart->txBusy)
+    {
+        if ((WE_GetTick() - start) >= timeout)
+        {
+            WE_DEBUG_PRINT("UART transmit queue did not drain, dropping it\r\n");
+            break;
+        }
+    }
+    WE_UART_TxFlush(uart);
+}
+
+/**
+ * @brief Start DMA reception and transmission on an initialized SERCOM.
+ *
+ * @return true if request succeeded, false otherwise
+ */
+static bool WE_UART_Start(WE_UART_t *uart, Sercom *sercom, uint32_t baudrate, uint8_t rxTrigger, uint8_t txTrigger,
+                          void (*handleRxData)(const uint8_t *data, uint16_t length),
+                          void (*txDone)(Adafruit_ZeroDMA *dma))
+{
+    uart->sercom = sercom;
+    uart->baudrate = baudrate;
+    memset(&uart->stats, 0, sizeof(uart->stats));
+    if (!WE_UART_TxStart(uart, txTrigger, txDone))
+    {
+        return false;
+    }
+    if (!WE_UART_RxStart(uart, sercom, rxTrigger, handleRxData))
+    {
+        WE_UART_TxStop(uart);
+        return false;
+    }
+    /* Reception stops in standby */
+    WE_Idle_LockStandby();
+    return true;
+}
+
+/**
+ * @brief Stop DMA reception and transmission.
+ */
+static void WE_UART_Stop(WE_UART_t *uart)
+{
+    /* Reception is active if and only if WE_UART_Start has succeeded */
+    bool started = uart->rxActive;
+
+    WE_UART_TxStop(uart);
+    WE_UART_RxStop(uart);
+    if (started)
+    {
+        WE_Idle_UnlockStandby();
+    }
+}
+
+/**
+ * @brief Copy the statistics of a UART.
+ */
+static void WE_UART_GetStats(WE_UART_t *uart, WE_UART_Stats_t *stats)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *stats = uart->stats;
+    __set_PRIMASK(primask);
+}
+
+/* Receive state of the loopback test */
+static struct
+{
+    uint32_t seed;
+    volatile uint32_t received;
+    volatile uint32_t errors;
+} uartLoopback;
+
+/**
+ * @brief Next byte of the loopback test pattern.
+ */
+static uint8_t WE_UART_LoopbackNext(uint32_t *seed)
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return (uint8_t)(*seed >> 16);
+}
+
+/**
+ * @brief Receive handler of the loopback test, compares the received bytes with the pattern.
+ */
+static void WE_UART_LoopbackRx(const uint8_t *data, uint16_t length)
+{
+    for (uint16_t i = 0; i < length; i++)
+    {
+        if (data[i] != WE_UART_LoopbackNext(&uartLoopback.seed))
+        {
+            uartLoopback.errors++;
+        }
+    }
+    uartLoopback.received += length;
+}
+
+/**
+ * @brief Loopback stress test, see WE_UART_*_LoopbackTest.
+ */
+static uint32_t WE_UART_LoopbackTest(WE_UART_t *uart,
+                                     bool (*init)(uint32_t baudrate, WE_FlowControl_t fc, WE_Parity_t par),
+                                     void (*deinit)(),
+                                     const uint32_t *baudrates, uint8_t count,
+                                     WE_FlowControl_t fc, uint32_t length)
+{
+    static uint8_t chunk[256];
+    uint32_t best = 0;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        uint32_t seed = baudrates[i];
+
+        if (!init(baudrates[i], fc, WE_Parity_None))
+        {
+            return best;
+        }
+        uartLoopback.seed = seed;
+        uartLoopback.received = 0;
+        uartLoopback.errors = 0;
+        uart->handleRxData = WE_UART_LoopbackRx;
+
+        uint32_t start = WE_GetTick();
+        for (uint32_t sent = 0; sent < length; sent += sizeof(chunk))
+        {
+            uint16_t size = (uint16_t)((length - sent < sizeof(chunk)) ? (length - sent) : sizeof(chunk));
+            for (uint16_t j = 0; j < size; j++)
+            {
+                chunk[j] = WE_UART_LoopbackNext(&seed);
+            }
+            WE_UART_Transmit(uart, (const char *)chunk, size);
+        }
+
+        /* Wait for the last bytes to be handed over after the line went idle */
+        uint32_t sendTime = WE_GetTick() - start;
+        uint32_t waitStart = WE_GetTick();
+        while (uartLoopback.received < length && (WE_GetTick() - waitStart) < 20 + WE_UART_RX_TICK_MS * 2)
+        {
+        }
+
+        WE_UART_Stats_t stats;
+        WE_UART_GetStats(uart, &stats);
+        uint32_t errors = uartLoopback.errors + stats.rxErrors + stats.rxOverruns + (length - uartLoopback.received);
+
+        WE_DEBUG_INFO("UART loopback %lu baud: %lu bytes in %lu ms, %lu errors, %lu lost\r\n", (unsigned long)baudrates[i],
+                      (unsigned long)uartLoopback.received, (unsigned long)sendTime, (unsigned long)errors,
+                      (unsigned long)(length - uartLoopback.received));
+
+        deinit();
+
+        if (errors == 0 && baudrates[i] > best)
+        {
+            best = baudrates[i];
+        }
+    }
+
+    return best;
+}
+
+#endif /* UART_RXPin0_TXPin1 || UART_RXPin11_TXPin10 */
+
+#if defined(UART_RXPin0_TXPin1)
+
+static PlatformPool<Uart> uartPoolSERCOM2;
 Uart *moduleUARTSERCOM2;
 TypeHardwareSerial *serialModuleSERCOM2;
 
 void SERCOM2_Handler()
 {
-    moduleUARTSERCOM2->IrqHandler();
+    WE_PROFILE_BEGIN(WE_PROFILE_ZONE_UART_ERROR_ISR);
+    WE_EVENT_BEGIN(WE_EVENT_ID_UART_ERROR_ISR);
+    WE_UART_HandleErrors(&uartSERCOM2);
+    WE_EVENT_END(WE_EVENT_ID_UART_ERROR_ISR);
+    WE_PROFILE_END(WE_PROFILE_ZONE_UART_ERROR_ISR);
+}
 
-    while (HSerial_available(serialModuleSERCOM2))
+static void WE_UART_SERCOM2_TxDone(Adafruit_ZeroDMA *dma)
+{
+    (void)dma;
+    WE_PROFILE_BEGIN(WE_PROFILE_ZONE_UART_TX_ISR);
+    WE_EVENT_BEGIN(WE_EVENT_ID_UART_TX_ISR);
+    WE_UART_TxDone(&uartSERCOM2);
+    WE_EVENT_END(WE_EVENT_ID_UART_TX_ISR);
+    WE_PROFILE_END(WE_PROFILE_ZONE_UART_TX_ISR);
+}
+
+__attribute__((weak)) void WE_UART_RXPin0_TXPin1_HandleRxByte(uint8_t receivedByte)
+{
+    (void)receivedByte;
+}
+
+__attribute__((weak)) void WE_UART_RXPin0_TXPin1_HandleRxData(const uint8_t *data, uint16_t length)
+{
+    for (uint16_t i = 0; i < length; i++)
     {
-        uint8_t receivedbyte = (uint8_t)HSerial_read(serialModuleSERCOM2);
-        WE_UART_RXPin0_TXPin1_HandleRxByte(receivedbyte);
+        WE_UART_RXPin0_TXPin1_HandleRxByte(data[i]);
     }
 }
 
-void WE_UART_RXPin0_TXPin1_Init(uint32_t baudrate,
+bool WE_UART_RXPin0_TXPin1_Init(uint32_t baudrate,
                           WE_FlowControl_t fc,
                           WE_Parity_t par)
 {
     if (fc != WE_FlowControl_NoFlowControl)
     {
-        WE_DEBUG_PRINT("Flow Control isnt supported \r\n");
+        /* RTS/CTS need SERCOM2 pads 0 and 1, which are connected to the SPI flash */
+        WE_DEBUG_PRINT("Flow Control isnt supported on this UART \r\n");
+    }
+    if (moduleUARTSERCOM2 != NULL)
+    {
+        /* Restart with the new settings */
+        WE_UART_RXPin0_TXPin1_DeInit();
+    }
+    moduleUARTSERCOM2 = uartPoolSERCOM2.create(&sercom2, PIN_SERIAL1_RX, PIN_SERIAL1_TX, PAD_SERIAL1_RX,
+                                               PAD_SERIAL1_TX);
+    serialModuleSERCOM2 = (moduleUARTSERCOM2 != NULL) ? HSerial_create(moduleUARTSERCOM2) : NULL;
+    if (serialModuleSERCOM2 == NULL)
+    {
+        WE_DEBUG_PRINT("UART SERCOM2 could not be allocated \r\n");
+        uartPoolSERCOM2.destroy(moduleUARTSERCOM2);
+        moduleUARTSERCOM2 = NULL;
+        return false;
     }
-    moduleUARTSERCOM2 = new Uart(&sercom2, PIN_SERIAL1_RX, PIN_SERIAL1_TX, PAD_SERIAL1_RX,
-                                 PAD_SERIAL1_TX);
-    serialModuleSERCOM2 = HSerial_create(moduleUARTSERCOM2);
     HSerial_beginP(serialModuleSERCOM2, baudrate, (uint16_t)(HARDSER_STOP_BIT_1 | par | HARDSER_DATA_8));
     pinPeripheral(PIN_SERIAL1_RX, PIO_SERCOM_ALT);
     pinPeripheral(PIN_SERIAL1_TX, PIO_SERCOM_ALT);
+    WE_Memory_AddBuffer("uart-sercom2", sizeof(uartSERCOM2));
+    if (!WE_UART_Start(&uartSERCOM2, SERCOM2, baudrate, SERCOM2_DMAC_ID_RX, SERCOM2_DMAC_ID_TX, WE_UART_RXPin0_TXPin1_HandleRxData, WE_UART_SERCOM2_TxDone))
+    {
+        WE_UART_RXPin0_TXPin1_DeInit();
+        return false;
+    }
+    return true;
 }
 
 void WE_UART_RXPin0_TXPin1_DeInit()
 {
+    if (moduleUARTSERCOM2 == NULL)
+    {
+        return;
+    }
+    WE_UART_Stop(&uartSERCOM2);
     HSerial_end(serialModuleSERCOM2);
-    free(moduleUARTSERCOM2);
+    HSerial_destroy(serialModuleSERCOM2);
+    serialModuleSERCOM2 = NULL;
+    uartPoolSERCOM2.destroy(moduleUARTSERCOM2);
+    moduleUARTSERCOM2 = NULL;
+}
+
+bool WE_UART_RXPin0_TXPin1_Transmit(const char *data, uint16_t length)
+{
+    return WE_UART_Transmit(&uartSERCOM2, data, length);
+}
+
+bool WE_UART_RXPin0_TXPin1_TransmitAsync(const WE_UART_TxSegment_t *segments, uint8_t count,
+                          WE_UART_TxCallback_t callback, void *context)
+{
+    return WE_UART_TransmitAsync(&uartSERCOM2, segments, count, callback, context);
 }
 
-void WE_UART_RXPin0_TXPin1_Transmit(const char *data, uint16_t length)
+void WE_UART_RXPin0_TXPin1_GetStats(WE_UART_Stats_t *stats)
 {
-    HSerial_writeB(serialModuleSERCOM2, data, length);
+    WE_UART_GetStats(&uartSERCOM2, stats);
+}
+
+void WE_UART_RXPin0_TXPin1_SetRxTask(WE_Task_t *task, uint16_t signal)
+{
+    WE_UART_SetRxTask(&uartSERCOM2, task, signal);
+}
+
+uint16_t WE_UART_RXPin0_TXPin1_Read(uint8_t *buffer, uint16_t size)
+{
+    return WE_UART_Read(&uartSERCOM2, buffer, size);
+}
+
+uint32_t WE_UART_RXPin0_TXPin1_LoopbackTest(const uint32_t *baudrates, uint8_t count,
+                          WE_FlowControl_t fc, uint32_t length)
+{
+    return WE_UART_LoopbackTest(&uartSERCOM2, WE_UART_RXPin0_TXPin1_Init, WE_UART_RXPin0_TXPin1_DeInit, baudrates, count, fc, length);
 }
 
 #endif /* UART_RXPin0_TXPin1 */
 
 #if defined(UART_RXPin11_TXPin10)
 
+static PlatformPool<Uart> uartPoolSERCOM1;
 Uart *moduleUARTSERCOM1;
 TypeHardwareSerial *serialModuleSERCOM1;
 
 void SERCOM1_Handler()
 {
-    moduleUARTSERCOM1->IrqHandler();
+    WE_PROFILE_BEGIN(WE_PROFILE_ZONE_UART_ERROR_ISR);
+    WE_EVENT_BEGIN(WE_EVENT_ID_UART_ERROR_ISR);
+    WE_UART_HandleErrors(&uartSERCOM1);
+    WE_EVENT_END(WE_EVENT_ID_UART_ERROR_ISR);
+    WE_PROFILE_END(WE_PROFILE_ZONE_UART_ERROR_ISR);
+}
 
-    while (HSerial_available(serialModuleSERCOM1))
+static void WE_UART_SERCOM1_TxDone(Adafruit_ZeroDMA *dma)
+{
+    (void)dma;
+    WE_PROFILE_BEGIN(WE_PROFILE_ZONE_UART_TX_ISR);
+    WE_EVENT_BEGIN(WE_EVENT_ID_UART_TX_ISR);
+    WE_UART_TxDone(&uartSERCOM1);
+    WE_EVENT_END(WE_EVENT_ID_UART_TX_ISR);
+    WE_PROFILE_END(WE_PROFILE_ZONE_UART_TX_ISR);
+}
+
+__attribute__((weak)) void WE_UART_RXPin11_TXPin10_HandleRxByte(uint8_t receivedByte)
+{
+    (void)receivedByte;
+}
+
+__attribute__((weak)) void WE_UART_RXPin11_TXPin10_HandleRxData(const uint8_t *data, uint16_t length)
+{
+    for (uint16_t i = 0; i < length; i++)
     {
-        uint8_t receivedbyte = (uint8_t)HSerial_read(serialModuleSERCOM1);
-        WE_UART_RXPin11_TXPin10_HandleRxByte(receivedbyte);
+        WE_UART_RXPin11_TXPin10_HandleRxByte(data[i]);
     }
 }
 
-void WE_UART_RXPin11_TXPin10_Init(uint32_t baudrate,
+bool WE_UART_RXPin11_TXPin10_Init(uint32_t baudrate,
                           WE_FlowControl_t fc,
                           WE_Parity_t par)
 {
-    if (fc != WE_FlowControl_NoFlowControl)
+    if (moduleUARTSERCOM1 != NULL)
+    {
+        /* Restart with the new settings */
+        WE_UART_RXPin11_TXPin10_DeInit();
+    }
+    if (fc == WE_FlowControl_NoFlowControl)
+    {
+        moduleUARTSERCOM1 = uartPoolSERCOM1.create(&sercom1, 11, 10, SERCOM_RX_PAD_0,
+                                                   UART_TX_PAD_2);
+    }
+    else
+    {
+        /* Hardware handshaking requires TX on PAD0, RTS on PAD2 and CTS on PAD3, RX moves to PAD1 */
+        moduleUARTSERCOM1 = uartPoolSERCOM1.create(&sercom1, WE_UART_RXPin11_TXPin10_FC_RX_PIN, WE_UART_RXPin11_TXPin10_FC_TX_PIN,
+                                                   SERCOM_RX_PAD_1, UART_TX_RTS_CTS_PAD_0_2_3);
+    }
+    serialModuleSERCOM1 = (moduleUARTSERCOM1 != NULL) ? HSerial_create(moduleUARTSERCOM1) : NULL;
+    if (serialModuleSERCOM1 == NULL)
     {
-        WE_DEBUG_PRINT("Flow Control isnt supported \r\n");
+        WE_DEBUG_PRINT("UART SERCOM1 could not be allocated \r\n");
+        uartPoolSERCOM1.destroy(moduleUARTSERCOM1);
+        moduleUARTSERCOM1 = NULL;
+        return false;
     }
-    moduleUARTSERCOM1 = new Uart(&sercom1, 11, 10, SERCOM_RX_PAD_0,
-                                 UART_TX_PAD_2);
-    serialModuleSERCOM1 = HSerial_create(moduleUARTSERCOM1);
     HSerial_beginP(serialModuleSERCOM1, baudrate, (uint16_t)(HARDSER_STOP_BIT_1 | par | HARDSER_DATA_8));
-    pinPeripheral(11, PIO_SERCOM);
-    pinPeripheral(10, PIO_SERCOM);
+    if (fc == WE_FlowControl_NoFlowControl)
+    {
+        pinPeripheral(11, PIO_SERCOM);
+        pinPeripheral(10, PIO_SERCOM);
+    }
+    else
+    {
+        pinPeripheral(WE_UART_RXPin11_TXPin10_FC_RX_PIN, PIO_SERCOM);
+        pinPeripheral(WE_UART_RXPin11_TXPin10_FC_TX_PIN, PIO_SERCOM);
+        if (fc != WE_FlowControl_CTSOnly)
+        {
+            /* RTS is driven by the SERCOM and goes high while the receive buffer is full */
+            pinPeripheral(WE_UART_RXPin11_TXPin10_FC_RTS_PIN, PIO_SERCOM);
+        }
+        if (fc == WE_FlowControl_RTSOnly)
+        {
+            /* Keep CTS asserted (low) so transmission is never held off */
+            pinMode(WE_UART_RXPin11_TXPin10_FC_CTS_PIN, INPUT_PULLDOWN);
+        }
+        pinPeripheral(WE_UART_RXPin11_TXPin10_FC_CTS_PIN, PIO_SERCOM);
+    }
+    WE_Memory_AddBuffer("uart-sercom1", sizeof(uartSERCOM1));
+    if (!WE_UART_Start(&uartSERCOM1, SERCOM1, baudrate, SERCOM1_DMAC_ID_RX, SERCOM1_DMAC_ID_TX, WE_UART_RXPin11_TXPin10_HandleRxData, WE_UART_SERCOM1_TxDone))
+    {
+        WE_UART_RXPin11_TXPin10_DeInit();
+        return false;
+    }
+    return true;
 }
 
 void WE_UART_RXPin11_TXPin10_DeInit()
 {
+    if (moduleUARTSERCOM1 == NULL)
+    {
+        return;
+    }
+    WE_UART_Stop(&uartSERCOM1);
     HSerial_end(serialModuleSERCOM1);
-    free(moduleUARTSERCOM1);
+    HSerial_destroy(serialModuleSERCOM1);
+    serialModuleSERCOM1 = NULL;
+    uartPoolSERCOM1.destroy(moduleUARTSERCOM1);
+    moduleUARTSERCOM1 = NULL;
+}
+
+bool WE_UART_RXPin11_TXPin10_Transmit(const char *data, uint16_t length)
+{
+    return WE_UART_Transmit(&uartSERCOM1, data, length);
 }
 
-void WE_UART_RXPin11_TXPin10_Transmit(const char *data, uint16_t length)
+bool WE_UART_RXPin11_TXPin10_TransmitAsync(const WE_UART_TxSegment_t *segments, uint8_t count,
+                          WE_UART_TxCallback_t callback, void *context)
 {
-    HSerial_writeB(serialModuleSERCOM1, data, length);
+    return WE_UART_TransmitAsync(&uartSERCOM1, segments, count, callback, context);
 }
+
+void WE_UART_RXPin11_TXPin10_GetStats(WE_UART_Stats_t *stats)
+{
+    WE_UART_GetStats(&uartSERCOM1, stats);
+}
+
+void WE_UART_RXPin11_TXPin10_SetRxTask(WE_Task_t *task, uint16_t signal)
+{
+    WE_UART_SetRxTask(&uartSERCOM1, task, signal);
+}
+
+uint16_t WE_UART_RXPin11_TXPin10_Read(uint8_t *buffer, uint16_t size)
+{
+    return WE_UART_Read(&uartSERCOM1, buffer, size);
+}
+
+uint32_t WE_UART_RXPin11_TXPin10_LoopbackTest(const uint32_t *baudrates, uint8_t count,
+                          WE_FlowControl_t fc, uint32_t length)
+{
+    return WE_UART_LoopbackTest(&uartSERCOM1, WE_UART_RXPin11_TXPin10_Init, WE_UART_RXPin11_TXPin10_DeInit, baudrates, count, fc, length);
+}
+
 #endif /* UART_RXPin11_TXPin10 */
 
 #endif
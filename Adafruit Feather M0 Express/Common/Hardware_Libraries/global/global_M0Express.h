@@ -36,36 +36,272 @@
 #include <stdbool.h>
 
 #include "global_types.h"
+#include "scheduler.h"
+
+/* Size of the circular DMA receive buffer of each UART in bytes */
+#ifndef WE_UART_RX_BUFFER_SIZE
+#define WE_UART_RX_BUFFER_SIZE 1024
+#endif
 
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
+    /**
+     * @brief UART statistics.
+     */
+    typedef struct
+    {
+        uint32_t rxBytes;          /* Bytes handed to the receive handler */
+        uint32_t rxBatches;        /* Calls of the receive handler */
+        uint32_t rxErrors;         /* Frame, parity and buffer overflow errors */
+        uint32_t rxOverruns;       /* Receive buffer overruns, the unread data has been dropped */
+        uint32_t txBytes;          /* Bytes sent */
+        uint32_t txBytesInFlight;  /* Bytes queued but not sent yet */
+        uint32_t txRejected;       /* Transmissions rejected because the queue was full */
+        uint32_t txFailed;         /* Queued segments dropped unsent (DMA start failed or transmit timeout) */
+        uint8_t txQueueDepth;      /* Occupied entries of the transmit queue */
+        uint8_t txQueueHighWater;  /* Maximum of txQueueDepth */
+    } WE_UART_Stats_t;
+
+    /**
+     * @brief Segment of a transmission.
+     */
+    typedef struct
+    {
+        const uint8_t *data;
+        uint16_t length;
+    } WE_UART_TxSegment_t;
+
+    /**
+     * @brief Called from interrupt context once a queued transmission has been sent or dropped.
+     *
+     * @param[in] context Context passed to the transmit function
+     * @param[in] sent false if (part of) the transmission has been dropped without being sent
+     */
+    typedef void (*WE_UART_TxCallback_t)(void *context, bool sent);
+
 #if defined(UART_RXPin0_TXPin1)
 
-    void WE_UART_RXPin0_TXPin1_Init(uint32_t baudrate,
+    /**
+     * @brief Initialize the UART.
+     *
+     * @param[in] baudrate Baud rate
+     * @param[in] fc Flow control (not supported, the SERCOM2 pads for RTS/CTS are used by the SPI flash)
+     * @param[in] par Parity
+     * @return true if the UART and its DMA channels have been started, false otherwise
+     */
+    bool WE_UART_RXPin0_TXPin1_Init(uint32_t baudrate,
                               WE_FlowControl_t fc,
                               WE_Parity_t par);
     void WE_UART_RXPin0_TXPin1_DeInit();
 
-    void WE_UART_RXPin0_TXPin1_Transmit(const char *data, uint16_t length);
+    /**
+     * @brief Send data and wait until it has been sent.
+     *
+     * The data is queued behind pending asynchronous transmissions.
+     * Must not be called with interrupts disabled. If the data has not been sent within
+     * WE_UART_TX_TIMEOUT_MS plus its transfer time, the transmit queue is flushed.
+     *
+     * @param[in] data Data to be sent
+     * @param[in] length Number of bytes
+     * @return true if the data has been sent, false on timeout or DMA error
+     */
+    bool WE_UART_RXPin0_TXPin1_Transmit(const char *data, uint16_t length);
+
+    /**
+     * @brief Queue data for transmission without waiting.
+     *
+     * The segments are sent back to back by DMA. The buffers must stay valid until the
+     * callback has been called.
+     *
+     * @param[in] segments Buffers to be sent in order (one transmit queue entry each)
+     * @param[in] count Number of segments
+     * @param[in] callback Called from interrupt context after the last segment has been sent or dropped (may be NULL)
+     * @param[in] context Passed to callback
+     * @return true if the segments have been queued, false if the transmit queue is full
+     */
+    bool WE_UART_RXPin0_TXPin1_TransmitAsync(const WE_UART_TxSegment_t *segments, uint8_t count,
+                              WE_UART_TxCallback_t callback, void *context);
+
+    /**
+     * @brief Receive handler, called from interrupt context with the bytes received since the last call.
+     *
+     * Bytes are received by DMA and handed over once the line has been idle for a timer period (1 ms)
+     * or half of the receive buffer is filled. The default implementation passes each byte to
+     * WE_UART_RXPin0_TXPin1_HandleRxByte().
+     *
+     * @param[in] data Received bytes
+     * @param[in] length Number of received bytes
+     */
+    void WE_UART_RXPin0_TXPin1_HandleRxData(const uint8_t *data, uint16_t length);
 
     void WE_UART_RXPin0_TXPin1_HandleRxByte(uint8_t receivedByte);
 
+    /**
+     * @brief Post an event to a scheduler task when data has been received, instead of calling
+     * WE_UART_RXPin0_TXPin1_HandleRxData().
+     *
+     * The event's param holds the number of received bytes, the task reads them with
+     * WE_UART_RXPin0_TXPin1_Read(). The next event is posted once the task has read.
+     * If the task does not read before the receive buffer (WE_UART_RX_BUFFER_SIZE) is full, the unread
+     * data is dropped and counted in rxOverruns.
+     *
+     * @param[in] task Task, NULL to use WE_UART_RXPin0_TXPin1_HandleRxData() again
+     * @param[in] signal Signal of the event
+     */
+    void WE_UART_RXPin0_TXPin1_SetRxTask(WE_Task_t *task, uint16_t signal);
+
+    /**
+     * @brief Read received data (receive task mode only).
+     *
+     * @param[out] buffer Destination
+     * @param[in] size Size of the destination
+     * @return Number of bytes read
+     */
+    uint16_t WE_UART_RXPin0_TXPin1_Read(uint8_t *buffer, uint16_t size);
+
+    /**
+     * @brief Get the statistics of the UART.
+     *
+     * @param[out] stats Statistics
+     */
+    void WE_UART_RXPin0_TXPin1_GetStats(WE_UART_Stats_t *stats);
+
+    /**
+     * @brief Loopback stress test.
+     *
+     * Sends a pseudo random pattern at each baud rate and checks the received data. TX has to be
+     * connected to RX (and RTS to CTS if flow control is enabled). The receive handler is bypassed
+     * during the test, the UART is deinitialized afterwards. Results are printed as debug info.
+     *
+     * @param[in] baudrates Baud rates to be tested
+     * @param[in] count Number of baud rates
+     * @param[in] fc Flow control
+     * @param[in] length Number of bytes sent per baud rate
+     * @return Highest baud rate that has been received without errors, 0 if none
+     */
+    uint32_t WE_UART_RXPin0_TXPin1_LoopbackTest(const uint32_t *baudrates, uint8_t count,
+                              WE_FlowControl_t fc, uint32_t length);
+
 #endif /* UART_RXPin0_TXPin1 */
 
 #if defined(UART_RXPin11_TXPin10)
 
-    void WE_UART_RXPin11_TXPin10_Init(uint32_t baudrate,
+/*
+ * Pins of UART_RXPin11_TXPin10 if flow control is enabled.
+ * The SERCOM supports RTS/CTS only with TX on PAD0 (pin 11), RTS on PAD2 (pin 10) and CTS on PAD3 (pin 12),
+ * so RX moves to PAD1 (pin 13).
+ */
+#define WE_UART_RXPin11_TXPin10_FC_TX_PIN 11
+#define WE_UART_RXPin11_TXPin10_FC_RX_PIN 13
+#define WE_UART_RXPin11_TXPin10_FC_RTS_PIN 10
+#define WE_UART_RXPin11_TXPin10_FC_CTS_PIN 12
+
+    /**
+     * @brief Initialize the UART.
+     *
+     * With flow control enabled the UART uses the WE_UART_RXPin11_TXPin10_FC_* pins.
+     *
+     * @param[in] baudrate Baud rate (up to 3 Mbaud)
+     * @param[in] fc Flow control
+     * @param[in] par Parity
+     * @return true if the UART and its DMA channels have been started, false otherwise
+     */
+    bool WE_UART_RXPin11_TXPin10_Init(uint32_t baudrate,
                               WE_FlowControl_t fc,
                               WE_Parity_t par);
     void WE_UART_RXPin11_TXPin10_DeInit();
 
-    void WE_UART_RXPin11_TXPin10_Transmit(const char *data, uint16_t length);
+    /**
+     * @brief Send data and wait until it has been sent.
+     *
+     * The data is queued behind pending asynchronous transmissions.
+     * Must not be called with interrupts disabled. If the data has not been sent within
+     * WE_UART_TX_TIMEOUT_MS plus its transfer time, the transmit queue is flushed.
+     *
+     * @param[in] data Data to be sent
+     * @param[in] length Number of bytes
+     * @return true if the data has been sent, false on timeout or DMA error
+     */
+    bool WE_UART_RXPin11_TXPin10_Transmit(const char *data, uint16_t length);
+
+    /**
+     * @brief Queue data for transmission without waiting.
+     *
+     * The segments are sent back to back by DMA. The buffers must stay valid until the
+     * callback has been called.
+     *
+     * @param[in] segments Buffers to be sent in order (one transmit queue entry each)
+     * @param[in] count Number of segments
+     * @param[in] callback Called from interrupt context after the last segment has been sent or dropped (may be NULL)
+     * @param[in] context Passed to callback
+     * @return true if the segments have been queued, false if the transmit queue is full
+     */
+    bool WE_UART_RXPin11_TXPin10_TransmitAsync(const WE_UART_TxSegment_t *segments, uint8_t count,
+                              WE_UART_TxCallback_t callback, void *context);
+
+    /**
+     * @brief Receive handler, called from interrupt context with the bytes received since the last call.
+     *
+     * Bytes are received by DMA and handed over once the line has been idle for a timer period (1 ms)
+     * or half of the receive buffer is filled. The default implementation passes each byte to
+     * WE_UART_RXPin11_TXPin10_HandleRxByte().
+     *
+     * @param[in] data Received bytes
+     * @param[in] length Number of received bytes
+     */
+    void WE_UART_RXPin11_TXPin10_HandleRxData(const uint8_t *data, uint16_t length);
 
     void WE_UART_RXPin11_TXPin10_HandleRxByte(uint8_t receivedByte);
 
+    /**
+     * @brief Post an event to a scheduler task when data has been received, instead of calling
+     * WE_UART_RXPin11_TXPin10_HandleRxData().
+     *
+     * The event's param holds the number of received bytes, the task reads them with
+     * WE_UART_RXPin11_TXPin10_Read(). The next event is posted once the task has read.
+     * If the task does not read before the receive buffer (WE_UART_RX_BUFFER_SIZE) is full, the unread
+     * data is dropped and counted in rxOverruns.
+     *
+     * @param[in] task Task, NULL to use WE_UART_RXPin11_TXPin10_HandleRxData() again
+     * @param[in] signal Signal of the event
+     */
+    void WE_UART_RXPin11_TXPin10_SetRxTask(WE_Task_t *task, uint16_t signal);
+
+    /**
+     * @brief Read received data (receive task mode only).
+     *
+     * @param[out] buffer Destination
+     * @param[in] size Size of the destination
+     * @return Number of bytes read
+     */
+    uint16_t WE_UART_RXPin11_TXPin10_Read(uint8_t *buffer, uint16_t size);
+
+    /**
+     * @brief Get the statistics of the UART.
+     *
+     * @param[out] stats Statistics
+     */
+    void WE_UART_RXPin11_TXPin10_GetStats(WE_UART_Stats_t *stats);
+
+    /**
+     * @brief Loopback stress test.
+     *
+     * Sends a pseudo random pattern at each baud rate and checks the received data. TX has to be
+     * connected to RX (and RTS to CTS if flow control is enabled). The receive handler is bypassed
+     * during the test, the UART is deinitialized afterwards. Results are printed as debug info.
+     *
+     * @param[in] baudrates Baud rates to be tested
+     * @param[in] count Number of baud rates
+     * @param[in] fc Flow control
+     * @param[in] length Number of bytes sent per baud rate
+     * @return Highest baud rate that has been received without errors, 0 if none
+     */
+    uint32_t WE_UART_RXPin11_TXPin10_LoopbackTest(const uint32_t *baudrates, uint8_t count,
+                              WE_FlowControl_t fc, uint32_t length);
+
 #endif /* UART_RXPin11_TXPin10 */
 
 #ifdef __cplusplus
@@ -0,0 +1,109 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Low power idle between events.
+ */
+
+#ifndef IDLE_H_INCLUDED
+#define IDLE_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Sleep modes used by the idle manager */
+typedef enum WE_Idle_Mode_t
+{
+    WE_Idle_Mode_None,   /* Do not sleep, WE_Idle_Enter() returns right away */
+    WE_Idle_Mode_Sleep,  /* Stop the CPU clock only, all peripherals, DMA and USB keep running */
+    WE_Idle_Mode_Standby /* Enter standby unless a standby lock is held, sleep otherwise */
+} WE_Idle_Mode_t;
+
+/* Time spent asleep vs. active during the last complete measurement window (about one second) */
+typedef struct WE_Idle_Stats_t
+{
+    uint32_t windowUs;  /* Length of the window */
+    uint32_t sleepUs;   /* Time asleep, including standby */
+    uint32_t standbyUs; /* Time in standby */
+    uint32_t activeUs;  /* Time running */
+    uint32_t wakeups;   /* Number of wake-ups */
+} WE_Idle_Stats_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Initialize the idle manager.
+     *
+     * Wake-ups are driven by the software timers (see soft_timer.h), their counter is kept
+     * running in standby so that the MCU resumes right at the next timer event.
+     * Note that standby stops the SysTick (millis() does not advance, WE_GetTick() does) and
+     * disconnects USB.
+     *
+     * @param[in] mode Sleep mode
+     * @return true if request succeeded, false otherwise
+     */
+    extern bool WE_Idle_Init(WE_Idle_Mode_t mode);
+
+    /**
+     * @brief Sleep until the next interrupt.
+     *
+     * Must be called with interrupts disabled, the interrupt that ends the sleep runs once
+     * interrupts are enabled again. WE_Scheduler_Idle() calls this function.
+     */
+    extern void WE_Idle_Enter(void);
+
+    /**
+     * @brief Prevent standby, e.g. while a DMA transfer is running.
+     *
+     * Locks are counted and may be taken from interrupt context. Sleep is still allowed.
+     */
+    extern void WE_Idle_LockStandby(void);
+
+    /**
+     * @brief Release a lock taken with WE_Idle_LockStandby().
+     */
+    extern void WE_Idle_UnlockStandby(void);
+
+    /**
+     * @brief Time spent asleep vs. active during the last complete second.
+     *
+     * @param[out] stats Statistics
+     */
+    extern void WE_Idle_GetStats(WE_Idle_Stats_t *stats);
+
+    /**
+     * @brief Print the statistics of the last complete second (WE_DEBUG only).
+     */
+    extern void WE_Idle_PrintStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IDLE_H_INCLUDED */
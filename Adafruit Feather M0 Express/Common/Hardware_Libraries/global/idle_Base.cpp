@@ -0,0 +1,188 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Idle between events on the host (BASE_PLATFORM).
+ *
+ * The host has no interrupts to return to a busy loop, so the firmware always waits for the
+ * next clock event here. The mode only selects how the time is accounted: waiting counts as
+ * active time with WE_Idle_Mode_None, as standby time with WE_Idle_Mode_Standby if no standby
+ * lock is held and as sleep time otherwise.
+ */
+
+#include <string.h>
+#include "idle.h"
+
+#ifdef BASE_PLATFORM
+
+#include "ConfigPlatform.h"
+#include "ArduinoStatusLED.h"
+#include "debug.h"
+#include "scheduler.h"
+#include "soft_timer.h"
+
+/* Length of the measurement window (one second) */
+#define WE_IDLE_WINDOW_TICKS (1000000UL * WE_SOFTTIMER_TICKS_PER_US)
+
+static WE_Idle_Mode_t idleMode = WE_Idle_Mode_None;
+static volatile uint8_t idleStandbyLocks = 0;
+
+static uint64_t idleWindowStart = 0;
+static uint32_t idleWindowSleep = 0;
+static uint32_t idleWindowStandby = 0;
+static uint32_t idleWindowWakeups = 0;
+static WE_Idle_Stats_t idleStats;
+
+static void WE_Idle_Account(uint64_t now);
+
+bool WE_Idle_Init(WE_Idle_Mode_t mode)
+{
+    if (!WE_SoftTimer_Init())
+    {
+        return false;
+    }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    idleMode = mode;
+    idleWindowStart = WE_SoftTimer_GetTicks();
+    idleWindowSleep = 0;
+    idleWindowStandby = 0;
+    idleWindowWakeups = 0;
+    memset(&idleStats, 0, sizeof(idleStats));
+
+    __set_PRIMASK(primask);
+    return true;
+}
+
+void WE_Idle_Enter(void)
+{
+#if defined(WE_DEBUG)
+    bool debugPending = WE_Debug_Process();
+#else
+    bool debugPending = false;
+#endif
+
+    bool standby = (WE_Idle_Mode_Standby == idleMode) && (0 == idleStandbyLocks) && !StatusLED_isBusy() && !debugPending;
+    uint64_t start = WE_SoftTimer_GetTicks();
+
+    __WFI();
+
+    uint64_t end = WE_SoftTimer_GetTicks();
+    uint32_t slept = (uint32_t)(end - start);
+
+    if (WE_Idle_Mode_None != idleMode)
+    {
+        idleWindowSleep += slept;
+        if (standby)
+        {
+            idleWindowStandby += slept;
+        }
+    }
+    idleWindowWakeups++;
+
+    WE_Idle_Account(end);
+}
+
+void WE_Idle_LockStandby(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    idleStandbyLocks++;
+    __set_PRIMASK(primask);
+}
+
+void WE_Idle_UnlockStandby(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (idleStandbyLocks > 0)
+    {
+        idleStandbyLocks--;
+    }
+    __set_PRIMASK(primask);
+}
+
+void WE_Idle_GetStats(WE_Idle_Stats_t *stats)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    WE_Idle_Account(WE_SoftTimer_GetTicks());
+    *stats = idleStats;
+
+    __set_PRIMASK(primask);
+}
+
+void WE_Idle_PrintStats(void)
+{
+#if defined(WE_DEBUG)
+    WE_Idle_Stats_t stats;
+    WE_Idle_GetStats(&stats);
+
+    uint32_t permille = (stats.windowUs > 0) ? (uint32_t)(((uint64_t)stats.sleepUs * 1000) / stats.windowUs) : 0;
+    WE_DEBUG_INFO("Idle: asleep %lu us (standby %lu us), active %lu us, %lu wake-ups in %lu us (%lu.%lu%% asleep)\r\n",
+                  (unsigned long)stats.sleepUs, (unsigned long)stats.standbyUs, (unsigned long)stats.activeUs,
+                  (unsigned long)stats.wakeups, (unsigned long)stats.windowUs,
+                  (unsigned long)(permille / 10), (unsigned long)(permille % 10));
+#endif
+}
+
+/* Wait for the next event whenever the scheduler has no pending event */
+void WE_Scheduler_Idle(void)
+{
+    WE_Idle_Enter();
+}
+
+/**
+ * @brief Close the measurement window once it is complete.
+ *
+ * Must be called with interrupts disabled.
+ *
+ * @param[in] now Current time in ticks
+ */
+static void WE_Idle_Account(uint64_t now)
+{
+    uint64_t elapsed = now - idleWindowStart;
+    if (elapsed < WE_IDLE_WINDOW_TICKS)
+    {
+        return;
+    }
+
+    idleStats.windowUs = (uint32_t)(elapsed / WE_SOFTTIMER_TICKS_PER_US);
+    idleStats.sleepUs = idleWindowSleep / WE_SOFTTIMER_TICKS_PER_US;
+    idleStats.standbyUs = idleWindowStandby / WE_SOFTTIMER_TICKS_PER_US;
+    idleStats.activeUs = idleStats.windowUs - idleStats.sleepUs;
+    idleStats.wakeups = idleWindowWakeups;
+
+    idleWindowStart = now;
+    idleWindowSleep = 0;
+    idleWindowStandby = 0;
+    idleWindowWakeups = 0;
+}
+
+#endif /* BASE_PLATFORM */
@@ -0,0 +1,241 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Low power idle between events (M0Express).
+ */
+
+#include <string.h>
+#include "idle.h"
+
+#ifdef M0Express
+
+#include <Arduino.h>
+#include "ArduinoStatusLED.h"
+#include "debug.h"
+#include "scheduler.h"
+#include "soft_timer.h"
+
+/* Length of the measurement window (one second) */
+#define WE_IDLE_WINDOW_TICKS (1000000UL * WE_SOFTTIMER_TICKS_PER_US)
+
+static WE_Idle_Mode_t idleMode = WE_Idle_Mode_None;
+static volatile uint8_t idleStandbyLocks = 0;
+
+static uint64_t idleWindowStart = 0;
+static uint32_t idleWindowSleep = 0;
+static uint32_t idleWindowStandby = 0;
+static uint32_t idleWindowWakeups = 0;
+static WE_Idle_Stats_t idleStats;
+
+static void WE_Idle_KeepCounterClockInStandby(void);
+static void WE_Idle_Account(uint64_t now);
+
+bool WE_Idle_Init(WE_Idle_Mode_t mode)
+{
+    if (!WE_SoftTimer_Init())
+    {
+        return false;
+    }
+
+    if (WE_Idle_Mode_Standby == mode)
+    {
+        WE_Idle_KeepCounterClockInStandby();
+    }
+
+    /* Errata: the device may not wake up from sleep if the NVM is in its low power mode */
+    NVMCTRL->CTRLB.bit.SLEEPPRM = NVMCTRL_CTRLB_SLEEPPRM_DISABLED_Val;
+
+    /* IDLE0 only stops the CPU clock */
+    PM->SLEEP.reg = PM_SLEEP_IDLE_CPU;
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    idleMode = mode;
+    idleWindowStart = WE_SoftTimer_GetTicks();
+    idleWindowSleep = 0;
+    idleWindowStandby = 0;
+    idleWindowWakeups = 0;
+    memset(&idleStats, 0, sizeof(idleStats));
+
+    __set_PRIMASK(primask);
+    return true;
+}
+
+void WE_Idle_Enter(void)
+{
+    if (WE_Idle_Mode_None == idleMode)
+    {
+        return;
+    }
+
+#if defined(WE_DEBUG)
+    /* Firmware that sleeps here does not call WE_Delay(), send the queued debug output first */
+    bool debugPending = WE_Debug_Process();
+#else
+    bool debugPending = false;
+#endif
+
+    /* A status LED update or debug output would be cut short as well */
+    bool standby = (WE_Idle_Mode_Standby == idleMode) && (0 == idleStandbyLocks) && !StatusLED_isBusy() && !debugPending;
+    uint64_t start = WE_SoftTimer_GetTicks();
+
+    if (standby)
+    {
+        SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+        /* The SysTick stops in standby anyway, a pending tick must not end standby right away */
+        SysTick->CTRL &= ~SysTick_CTRL_TICKINT_Msk;
+    }
+    else
+    {
+        SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+    }
+
+    __DSB();
+    __WFI();
+
+    if (standby)
+    {
+        SysTick->CTRL |= SysTick_CTRL_TICKINT_Msk;
+    }
+
+    uint64_t end = WE_SoftTimer_GetTicks();
+    uint32_t slept = (uint32_t)(end - start);
+
+    idleWindowSleep += slept;
+    if (standby)
+    {
+        idleWindowStandby += slept;
+    }
+    idleWindowWakeups++;
+
+    WE_Idle_Account(end);
+}
+
+void WE_Idle_LockStandby(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    idleStandbyLocks++;
+    __set_PRIMASK(primask);
+}
+
+void WE_Idle_UnlockStandby(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (idleStandbyLocks > 0)
+    {
+        idleStandbyLocks--;
+    }
+    __set_PRIMASK(primask);
+}
+
+void WE_Idle_GetStats(WE_Idle_Stats_t *stats)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    /* Close the window even if the MCU has not been idle for a while */
+    WE_Idle_Account(WE_SoftTimer_GetTicks());
+    *stats = idleStats;
+
+    __set_PRIMASK(primask);
+}
+
+void WE_Idle_PrintStats(void)
+{
+#if defined(WE_DEBUG)
+    WE_Idle_Stats_t stats;
+    WE_Idle_GetStats(&stats);
+
+    uint32_t permille = (stats.windowUs > 0) ? (uint32_t)(((uint64_t)stats.sleepUs * 1000) / stats.windowUs) : 0;
+    WE_DEBUG_INFO("Idle: asleep %lu us (standby %lu us), active %lu us, %lu wake-ups in %lu us (%lu.%lu%% asleep)\r\n",
+                  (unsigned long)stats.sleepUs, (unsigned long)stats.standbyUs, (unsigned long)stats.activeUs,
+                  (unsigned long)stats.wakeups, (unsigned long)stats.windowUs,
+                  (unsigned long)(permille / 10), (unsigned long)(permille % 10));
+#endif
+}
+
+/* Sleep whenever the scheduler has no pending event */
+void WE_Scheduler_Idle(void)
+{
+    WE_Idle_Enter();
+}
+
+/**
+ * @brief Keep the clock of the software timer counter running in standby.
+ *
+ * The counter is clocked by generic clock generator 0 from the DFLL48M. Peripherals that do
+ * not run in standby do not request the clock, so only the counter keeps it alive.
+ */
+static void WE_Idle_KeepCounterClockInStandby(void)
+{
+    SYSCTRL->DFLLCTRL.bit.RUNSTDBY = 1;
+    while (0 == SYSCTRL->PCLKSR.bit.DFLLRDY)
+    {
+    }
+
+    /* Select generator 0 for reading, then write it back with RUNSTDBY set */
+    *((volatile uint8_t *)&GCLK->GENCTRL.reg) = GCLK_GENCTRL_ID(0);
+    while (GCLK->STATUS.bit.SYNCBUSY)
+    {
+    }
+    GCLK->GENCTRL.reg |= GCLK_GENCTRL_RUNSTDBY;
+    while (GCLK->STATUS.bit.SYNCBUSY)
+    {
+    }
+}
+
+/**
+ * @brief Close the measurement window once it is complete.
+ *
+ * Must be called with interrupts disabled.
+ *
+ * @param[in] now Current time in ticks
+ */
+static void WE_Idle_Account(uint64_t now)
+{
+    uint64_t elapsed = now - idleWindowStart;
+    if (elapsed < WE_IDLE_WINDOW_TICKS)
+    {
+        return;
+    }
+
+    idleStats.windowUs = (uint32_t)(elapsed / WE_SOFTTIMER_TICKS_PER_US);
+    idleStats.sleepUs = idleWindowSleep / WE_SOFTTIMER_TICKS_PER_US;
+    idleStats.standbyUs = idleWindowStandby / WE_SOFTTIMER_TICKS_PER_US;
+    idleStats.activeUs = idleStats.windowUs - idleStats.sleepUs;
+    idleStats.wakeups = idleWindowWakeups;
+
+    idleWindowStart = now;
+    idleWindowSleep = 0;
+    idleWindowStandby = 0;
+    idleWindowWakeups = 0;
+}
+
+#endif /* M0Express */
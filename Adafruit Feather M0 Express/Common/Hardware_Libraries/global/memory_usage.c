@@ -0,0 +1,119 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Registered buffers and report of the RAM usage.
+ */
+
+#include <string.h>
+#include "memory_usage.h"
+#include "event_trace.h"
+#include "profile.h"
+#include "frame_monitor.h"
+
+#if defined(WE_DEBUG)
+#include "debug.h"
+#include "global.h"
+#endif
+
+/* Buffers of the global library are known at compile time, drivers add theirs when initialized */
+static WE_Memory_Buffer_t memoryBuffers[WE_MEMORY_MAX_BUFFERS] = {
+#if defined(WE_DEBUG)
+    {"debug-ring", WE_DEBUG_RING_SIZE},
+#endif
+#ifdef WE_EVENT_TRACE
+    {"event-trace", WE_EVENT_TRACE_SIZE * sizeof(WE_EventTrace_Event_t)},
+#endif
+#ifdef WE_PROFILE
+    {"profile", WE_PROFILE_MAX_ZONES * sizeof(WE_Profile_Zone_t)},
+#endif
+#ifdef WE_FRAME_MONITOR
+    {"frame-monitor", sizeof(WE_FrameMonitor_Stats_t)},
+#endif
+};
+
+bool WE_Memory_AddBuffer(const char *name, uint32_t size)
+{
+    for (uint8_t i = 0; i < WE_MEMORY_MAX_BUFFERS; i++)
+    {
+        if ((NULL == memoryBuffers[i].name) || (0 == strcmp(memoryBuffers[i].name, name)))
+        {
+            memoryBuffers[i].name = name;
+            memoryBuffers[i].size = size;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool WE_Memory_GetBuffer(uint8_t index, WE_Memory_Buffer_t *buffer)
+{
+    if ((index >= WE_MEMORY_MAX_BUFFERS) || (NULL == memoryBuffers[index].name))
+    {
+        return false;
+    }
+    *buffer = memoryBuffers[index];
+    return true;
+}
+
+void WE_Memory_Print(void)
+{
+#if defined(WE_DEBUG)
+    WE_Memory_Stats_t stats;
+    WE_Memory_GetStats(&stats);
+
+    if (0 != stats.ramSize)
+    {
+        WE_DEBUG_INFO("RAM: %lu bytes, static %lu, heap %lu (%lu allocated), stack %lu (peak %lu)\r\n",
+                      (unsigned long)stats.ramSize, (unsigned long)stats.staticSize, (unsigned long)stats.heapSize,
+                      (unsigned long)stats.heapUsed, (unsigned long)stats.stackUsed, (unsigned long)stats.stackPeak);
+        WE_DEBUG_INFO("RAM free: %lu bytes now, %lu at the stack peak\r\n", (unsigned long)stats.freeNow,
+                      (unsigned long)stats.freeMin);
+        if (stats.freeMin < WE_MEMORY_STACK_WARNING)
+        {
+            WE_DEBUG_WARNING("Less than %d bytes were left between heap and stack\r\n", WE_MEMORY_STACK_WARNING);
+        }
+    }
+    else
+    {
+        WE_DEBUG_INFO("RAM: static %lu, heap %lu (%lu allocated)\r\n", (unsigned long)stats.staticSize,
+                      (unsigned long)stats.heapSize, (unsigned long)stats.heapUsed);
+    }
+    WE_Debug_Flush();
+
+    uint32_t total = 0;
+    WE_Memory_Buffer_t buffer;
+    for (uint8_t i = 0; WE_Memory_GetBuffer(i, &buffer); i++)
+    {
+        WE_DEBUG_INFO("  %-16s %6lu\r\n", buffer.name, (unsigned long)buffer.size);
+        total += buffer.size;
+    }
+    WE_DEBUG_INFO("  %-16s %6lu\r\n", "buffers total", (unsigned long)total);
+    WE_Debug_Flush();
+
+    WE_PrintPlatformMemory();
+#endif
+}
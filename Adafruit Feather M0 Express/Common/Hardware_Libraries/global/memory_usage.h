@@ -0,0 +1,126 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief RAM usage: static data, heap, stack high-water mark and the buffers of the drivers.
+ *
+ * On the M0Express the free RAM between the heap and the stack is filled with a pattern before
+ * the constructors run. The stack high-water mark is the deepest address where the pattern has
+ * been overwritten since. Drivers register their large buffers with WE_Memory_AddBuffer(), so
+ * the report shows what each subsystem takes. Common/Utilities/memory_map/memory_map.py
+ * reports the same from the linker map at build time.
+ */
+
+#ifndef MEMORY_USAGE_H_INCLUDED
+#define MEMORY_USAGE_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Number of buffers that can be registered */
+#ifndef WE_MEMORY_MAX_BUFFERS
+#define WE_MEMORY_MAX_BUFFERS 16
+#endif
+
+/* WE_Memory_Print() warns if less RAM than this was left between heap and stack */
+#ifndef WE_MEMORY_STACK_WARNING
+#define WE_MEMORY_STACK_WARNING 1024
+#endif
+
+/* Fill pattern of the unused stack */
+#define WE_MEMORY_STACK_PATTERN 0xA5A5A5A5UL
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* RAM usage in bytes, 0 if not available on the platform */
+    typedef struct
+    {
+        uint32_t ramSize;    /* RAM available to the firmware */
+        uint32_t staticSize; /* Initialized and zeroed data (.data, .bss) */
+        uint32_t heapSize;   /* Heap taken from the free RAM so far */
+        uint32_t heapUsed;   /* Heap allocated now */
+        uint32_t stackUsed;  /* Stack in use by the caller */
+        uint32_t stackPeak;  /* Stack high-water mark since boot or WE_Memory_PaintStack() */
+        uint32_t freeNow;    /* RAM between heap and stack now */
+        uint32_t freeMin;    /* RAM between heap and the stack high-water mark */
+    } WE_Memory_Stats_t;
+
+    /* Buffer registered by a driver */
+    typedef struct
+    {
+        const char *name;
+        uint32_t size;
+    } WE_Memory_Buffer_t;
+
+    /**
+     * @brief Fill the free stack with the pattern again, the high-water mark starts over.
+     *
+     * Done at boot already. Call it e.g. after initialization to measure the main loop alone.
+     */
+    extern void WE_Memory_PaintStack(void);
+
+    /**
+     * @brief Get the RAM usage.
+     *
+     * Scans the free RAM for the pattern, which takes about 1 ms on the M0Express.
+     *
+     * @param[out] stats RAM usage
+     */
+    extern void WE_Memory_GetStats(WE_Memory_Stats_t *stats);
+
+    /**
+     * @brief Register a buffer for the report, a buffer registered again under the same name is updated.
+     *
+     * @param[in] name Name, the string is not copied
+     * @param[in] size Size in bytes
+     * @return true if request succeeded, false if the table is full
+     */
+    extern bool WE_Memory_AddBuffer(const char *name, uint32_t size);
+
+    /**
+     * @brief Get a registered buffer.
+     *
+     * @param[in] index Index, starting at 0
+     * @param[out] buffer Buffer
+     * @return true if request succeeded, false if there is no buffer with this index
+     */
+    extern bool WE_Memory_GetBuffer(uint8_t index, WE_Memory_Buffer_t *buffer);
+
+    /**
+     * @brief Print the RAM usage and the registered buffers on the debug serial (WE_DEBUG only).
+     *
+     * Also printed by WE_Debug_Poll() on receiving 'm'.
+     */
+    extern void WE_Memory_Print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MEMORY_USAGE_H_INCLUDED */
@@ -0,0 +1,99 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief RAM usage (M0Express).
+ *
+ * Layout of the RAM given by the linker script of the Arduino core: .data and .bss from
+ * __data_start__ to __bss_end__, the heap from __end__ up to sbrk(0), the stack from
+ * __StackTop (end of RAM) down.
+ */
+
+#include "memory_usage.h"
+
+#ifdef M0Express
+
+#include <Arduino.h>
+#include <malloc.h>
+
+/* The stack of the function that paints is kept */
+#define WE_MEMORY_PAINT_MARGIN 64
+
+extern "C" char __data_start__;
+extern "C" char __bss_end__;
+extern "C" char __end__;
+extern "C" char __StackTop;
+extern "C" char *sbrk(int increment);
+
+/**
+ * @brief Returns the first word above the heap.
+ */
+static uint32_t *WE_Memory_HeapEnd()
+{
+    return (uint32_t *)(((uintptr_t)sbrk(0) + 3) & ~(uintptr_t)3);
+}
+
+void WE_Memory_PaintStack(void)
+{
+    uint32_t *end = (uint32_t *)((__get_MSP() - WE_MEMORY_PAINT_MARGIN) & ~(uintptr_t)3);
+    for (uint32_t *word = WE_Memory_HeapEnd(); word < end; word++)
+    {
+        *word = WE_MEMORY_STACK_PATTERN;
+    }
+}
+
+/**
+ * @brief Paint the stack before the constructors of the application run.
+ */
+static void __attribute__((constructor(101))) WE_Memory_PaintAtBoot()
+{
+    WE_Memory_PaintStack();
+}
+
+void WE_Memory_GetStats(WE_Memory_Stats_t *stats)
+{
+    uint32_t *heapEnd = WE_Memory_HeapEnd();
+    uint32_t sp = __get_MSP();
+
+    /* The deepest stack use is where the pattern ends, the heap may have grown into it */
+    uint32_t *peak = heapEnd;
+    while (((uintptr_t)peak < sp) && (WE_MEMORY_STACK_PATTERN == *peak))
+    {
+        peak++;
+    }
+
+    uintptr_t top = (uintptr_t)&__StackTop;
+    stats->ramSize = (uint32_t)(top - (uintptr_t)&__data_start__);
+    stats->staticSize = (uint32_t)((uintptr_t)&__bss_end__ - (uintptr_t)&__data_start__);
+    stats->heapSize = (uint32_t)((uintptr_t)heapEnd - (uintptr_t)&__end__);
+    stats->heapUsed = (uint32_t)mallinfo().uordblks;
+    stats->stackUsed = (uint32_t)(top - sp);
+    stats->stackPeak = (uint32_t)(top - (uintptr_t)peak);
+    stats->freeNow = (uint32_t)(sp - (uintptr_t)heapEnd);
+    stats->freeMin = (uint32_t)((uintptr_t)peak - (uintptr_t)heapEnd);
+}
+
+#endif /* M0Express */
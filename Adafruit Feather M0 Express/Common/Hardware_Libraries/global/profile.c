@@ -0,0 +1,179 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Profiling zones with cycle counts.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "profile.h"
+
+#ifdef WE_PROFILE
+
+#if defined(WE_DEBUG)
+#include "debug.h"
+#endif
+
+#if defined(M0Express) || defined(BASE_PLATFORM)
+#include <Arduino.h>
+#define WE_PROFILE_LOCK()                \
+    uint32_t primask = __get_PRIMASK(); \
+    __disable_irq()
+#define WE_PROFILE_UNLOCK() __set_PRIMASK(primask)
+#else
+#define WE_PROFILE_LOCK()
+#define WE_PROFILE_UNLOCK()
+#endif
+
+/* Every member is given, the sources are also built as C++ with -Wextra */
+#define WE_PROFILE_ZONE_INIT(zoneName) {zoneName, 0, 0, 0, 0, {0}}
+
+/* In the order of the WE_PROFILE_ZONE_* numbers */
+static WE_Profile_Zone_t profileZones[WE_PROFILE_MAX_ZONES] = {
+    WE_PROFILE_ZONE_INIT("icled-encode"),
+    WE_PROFILE_ZONE_INIT("icled-hsv"),
+    WE_PROFILE_ZONE_INIT("uart-rx-isr"),
+    WE_PROFILE_ZONE_INIT("uart-tx-isr"),
+    WE_PROFILE_ZONE_INIT("uart-err-isr"),
+    WE_PROFILE_ZONE_INIT("i2c-isr"),
+    WE_PROFILE_ZONE_INIT("i2c-transfer"),
+    WE_PROFILE_ZONE_INIT("atca-command"),
+};
+
+static void WE_Profile_ClearZone(WE_Profile_Zone_t *zone);
+
+void WE_Profile_Record(uint8_t zone, uint32_t cycles)
+{
+    if (zone >= WE_PROFILE_MAX_ZONES)
+    {
+        return;
+    }
+
+    /* Bin 0 below 2^SHIFT cycles, then one bin per power of two */
+    uint32_t scaled = cycles >> WE_PROFILE_HISTOGRAM_SHIFT;
+    uint8_t bin = (0 == scaled) ? 0 : (uint8_t)(32 - __builtin_clz(scaled));
+    if (bin >= WE_PROFILE_HISTOGRAM_BINS)
+    {
+        bin = WE_PROFILE_HISTOGRAM_BINS - 1;
+    }
+
+    WE_Profile_Zone_t *z = &profileZones[zone];
+
+    WE_PROFILE_LOCK();
+    if ((0 == z->count) || (cycles < z->minCycles))
+    {
+        z->minCycles = cycles;
+    }
+    if (cycles > z->maxCycles)
+    {
+        z->maxCycles = cycles;
+    }
+    z->count++;
+    z->totalCycles += cycles;
+    if (z->histogram[bin] < UINT16_MAX)
+    {
+        z->histogram[bin]++;
+    }
+    WE_PROFILE_UNLOCK();
+}
+
+void WE_Profile_SetName(uint8_t zone, const char *name)
+{
+    if (zone < WE_PROFILE_MAX_ZONES)
+    {
+        profileZones[zone].name = name;
+    }
+}
+
+bool WE_Profile_GetZone(uint8_t zone, WE_Profile_Zone_t *stats)
+{
+    if (zone >= WE_PROFILE_MAX_ZONES)
+    {
+        return false;
+    }
+
+    WE_PROFILE_LOCK();
+    *stats = profileZones[zone];
+    WE_PROFILE_UNLOCK();
+    return true;
+}
+
+void WE_Profile_Reset(void)
+{
+    for (uint8_t i = 0; i < WE_PROFILE_MAX_ZONES; i++)
+    {
+        WE_PROFILE_LOCK();
+        WE_Profile_ClearZone(&profileZones[i]);
+        WE_PROFILE_UNLOCK();
+    }
+}
+
+void WE_Profile_Print(void)
+{
+#if defined(WE_DEBUG)
+    WE_DEBUG_INFO("Profile [cycles, %d per us]: zone count min avg max\r\n", WE_PROFILE_CYCLES_PER_US);
+
+    for (uint8_t i = 0; i < WE_PROFILE_MAX_ZONES; i++)
+    {
+        WE_Profile_Zone_t zone;
+        WE_Profile_GetZone(i, &zone);
+        if (0 == zone.count)
+        {
+            continue;
+        }
+
+        char histogram[WE_PROFILE_HISTOGRAM_BINS * 6 + 1];
+        size_t length = 0;
+        for (uint8_t bin = 0; bin < WE_PROFILE_HISTOGRAM_BINS; bin++)
+        {
+            length += (size_t)snprintf(&histogram[length], sizeof(histogram) - length, " %u", (unsigned)zone.histogram[bin]);
+        }
+
+        WE_DEBUG_INFO("%2u %-12s %8lu %8lu %8lu %8lu\r\n", (unsigned)i, (NULL != zone.name) ? zone.name : "",
+                      (unsigned long)zone.count, (unsigned long)zone.minCycles,
+                      (unsigned long)(zone.totalCycles / zone.count), (unsigned long)zone.maxCycles);
+        WE_DEBUG_INFO("   histogram (<2^%d, then x2):%s\r\n", WE_PROFILE_HISTOGRAM_SHIFT, histogram);
+
+        /* The table does not fit into the debug ring buffer at once */
+        WE_Debug_Flush();
+    }
+#endif
+}
+
+/**
+ * @brief Clear the statistics of a zone, the name is kept.
+ *
+ * @param[in] zone Zone
+ */
+static void WE_Profile_ClearZone(WE_Profile_Zone_t *zone)
+{
+    const char *name = zone->name;
+    memset(zone, 0, sizeof(*zone));
+    zone->name = name;
+}
+
+#endif /* WE_PROFILE */
@@ -0,0 +1,151 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Profiling zones with cycle counts.
+ *
+ * A zone measures the CPU cycles between WE_PROFILE_BEGIN() and WE_PROFILE_END() and keeps
+ * count, minimum, maximum, total and a histogram in a fixed table. Zones may be used in
+ * interrupts. Without WE_PROFILE defined all macros compile to nothing.
+ */
+
+#ifndef PROFILE_H_INCLUDED
+#define PROFILE_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Number of zones */
+#ifndef WE_PROFILE_MAX_ZONES
+#define WE_PROFILE_MAX_ZONES 12
+#endif
+
+/* Histogram bins, bin 0 counts runs below 2^WE_PROFILE_HISTOGRAM_SHIFT cycles, each further bin doubles
+   the limit, the last bin counts everything above (by default 256 cycles to 2^20 cycles, 21.8 ms at 48 MHz) */
+#ifndef WE_PROFILE_HISTOGRAM_BINS
+#define WE_PROFILE_HISTOGRAM_BINS 14
+#endif
+#ifndef WE_PROFILE_HISTOGRAM_SHIFT
+#define WE_PROFILE_HISTOGRAM_SHIFT 8
+#endif
+
+/* CPU clock, used to convert cycles for printing */
+#ifndef WE_PROFILE_CYCLES_PER_US
+#define WE_PROFILE_CYCLES_PER_US 48
+#endif
+
+/* Zones measured by the SDK, the remaining zones are free for the application */
+#define WE_PROFILE_ZONE_ICLED_ENCODE 0    /* Pixel buffer encoded into the SPI buffer */
+#define WE_PROFILE_ZONE_ICLED_HSV 1       /* HSV to RGB conversion of one pixel */
+#define WE_PROFILE_ZONE_UART_RX_ISR 2     /* UART receive timer interrupt */
+#define WE_PROFILE_ZONE_UART_TX_ISR 3     /* UART transmit DMA complete interrupt */
+#define WE_PROFILE_ZONE_UART_ERROR_ISR 4  /* UART SERCOM interrupt */
+#define WE_PROFILE_ZONE_I2C_ISR 5         /* I2C SERCOM interrupt */
+#define WE_PROFILE_ZONE_I2C_TRANSFER 6    /* Blocking I2C transfer, e.g. ReadReg() */
+#define WE_PROFILE_ZONE_ATCA_COMMAND 7    /* CryptoAuth command including its execution time */
+#define WE_PROFILE_ZONE_APP 8             /* First zone of the application */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Statistics of a zone */
+    typedef struct WE_Profile_Zone_t
+    {
+        const char *name;
+        uint32_t count;
+        uint32_t minCycles;
+        uint32_t maxCycles;
+        uint64_t totalCycles;
+        uint16_t histogram[WE_PROFILE_HISTOGRAM_BINS]; /* Saturates at 65535 */
+    } WE_Profile_Zone_t;
+
+#ifdef WE_PROFILE
+    /**
+     * @brief Returns the CPU cycle counter.
+     *
+     * The counter wraps around after 2^32 cycles (89 s at 48 MHz), use it for differences only.
+     * On the M0Express it is derived from the SysTick, which stops in standby.
+     *
+     * @return Cycles
+     */
+    extern uint32_t WE_Profile_GetCycles(void);
+
+    /**
+     * @brief Add a run to the statistics of a zone.
+     *
+     * @param[in] zone Zone
+     * @param[in] cycles Length of the run
+     */
+    extern void WE_Profile_Record(uint8_t zone, uint32_t cycles);
+
+    /**
+     * @brief Name a zone for WE_Profile_Print(), the SDK zones are named already.
+     *
+     * @param[in] zone Zone
+     * @param[in] name Name, the string is not copied
+     */
+    extern void WE_Profile_SetName(uint8_t zone, const char *name);
+
+    /**
+     * @brief Copy the statistics of a zone.
+     *
+     * @param[in] zone Zone
+     * @param[out] stats Statistics
+     * @return true if request succeeded, false otherwise
+     */
+    extern bool WE_Profile_GetZone(uint8_t zone, WE_Profile_Zone_t *stats);
+
+    /**
+     * @brief Clear the statistics of all zones.
+     */
+    extern void WE_Profile_Reset(void);
+
+    /**
+     * @brief Print the statistics of all zones that ran on the debug serial (WE_DEBUG only).
+     *
+     * Also printed by WE_Debug_Poll() on receiving 'p', 'r' resets the statistics.
+     */
+    extern void WE_Profile_Print(void);
+
+/* Measure the section between begin and end, both in the same scope. The zone must be a name
+   (macro or enumerator), e.g. WE_PROFILE_BEGIN(WE_PROFILE_ZONE_APP) */
+#define WE_PROFILE_BEGIN(zone) uint32_t WE_profileStart_##zone = WE_Profile_GetCycles()
+#define WE_PROFILE_END(zone) WE_Profile_Record((zone), WE_Profile_GetCycles() - WE_profileStart_##zone)
+#else
+#define WE_PROFILE_BEGIN(zone) ((void)0)
+#define WE_PROFILE_END(zone) ((void)0)
+#define WE_Profile_SetName(zone, name) ((void)0)
+#define WE_Profile_Reset() ((void)0)
+#define WE_Profile_Print() ((void)0)
+#endif /* WE_PROFILE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROFILE_H_INCLUDED */
@@ -0,0 +1,323 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Cooperative run-to-completion scheduler.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "scheduler.h"
+
+#if defined(WE_DEBUG)
+#include "debug.h"
+#endif
+
+#if defined(M0Express) || defined(BASE_PLATFORM)
+#include <Arduino.h>
+#define WE_SCHEDULER_LOCK()              \
+    uint32_t primask = __get_PRIMASK(); \
+    __disable_irq()
+#define WE_SCHEDULER_UNLOCK() __set_PRIMASK(primask)
+#define WE_SCHEDULER_WAIT() \
+    __enable_irq();         \
+    __disable_irq()
+#else
+#define WE_SCHEDULER_LOCK()
+#define WE_SCHEDULER_UNLOCK()
+#define WE_SCHEDULER_WAIT()
+#endif
+
+static WE_Task_t *schedulerTasks[WE_SCHEDULER_MAX_TASKS];
+static volatile uint32_t schedulerReady = 0;
+
+static void WE_Scheduler_TimerExpired(WE_SoftTimer_t *timer, void *context);
+static void WE_Scheduler_ResetTaskStats(WE_Task_t *task);
+static void WE_Scheduler_Record(WE_Task_t *task, uint32_t latency, uint32_t run);
+
+bool WE_Scheduler_Init(void)
+{
+    memset(schedulerTasks, 0, sizeof(schedulerTasks));
+    schedulerReady = 0;
+    return WE_SoftTimer_Init();
+}
+
+bool WE_Scheduler_AddTask(WE_Task_t *task, const char *name, uint8_t priority, WE_Event_t *queue, uint8_t queueSize, WE_Task_Handler_t handler, void *context)
+{
+    if ((NULL == task) || (NULL == queue) || (0 == queueSize) || (NULL == handler))
+    {
+        return false;
+    }
+
+    if ((priority >= WE_SCHEDULER_MAX_TASKS) || (NULL != schedulerTasks[priority]))
+    {
+#if defined(WE_DEBUG)
+        WE_DEBUG_PRINT("Scheduler priority %d is not available\r\n", priority);
+#endif
+        return false;
+    }
+
+    task->name = name;
+    task->handler = handler;
+    task->context = context;
+    task->queue = queue;
+    task->queueSize = queueSize;
+    task->head = 0;
+    task->count = 0;
+    task->priority = priority;
+    WE_Scheduler_ResetTaskStats(task);
+
+    WE_SCHEDULER_LOCK();
+    schedulerTasks[priority] = task;
+    WE_SCHEDULER_UNLOCK();
+    return true;
+}
+
+void WE_Scheduler_RemoveTask(WE_Task_t *task)
+{
+    WE_SCHEDULER_LOCK();
+    if (schedulerTasks[task->priority] == task)
+    {
+        schedulerTasks[task->priority] = NULL;
+        schedulerReady &= ~(1UL << task->priority);
+        task->count = 0;
+    }
+    WE_SCHEDULER_UNLOCK();
+}
+
+bool WE_Scheduler_Post(WE_Task_t *task, uint16_t signal, uint32_t param, void *data)
+{
+    uint32_t now = (uint32_t)WE_SoftTimer_GetTicks();
+
+    WE_SCHEDULER_LOCK();
+
+    /* A removed task, e.g. posted to by a timer that is still running */
+    if ((task->priority >= WE_SCHEDULER_MAX_TASKS) || (schedulerTasks[task->priority] != task))
+    {
+        WE_SCHEDULER_UNLOCK();
+        return false;
+    }
+
+    if (task->count >= task->queueSize)
+    {
+        task->stats.dropped++;
+        WE_SCHEDULER_UNLOCK();
+        return false;
+    }
+
+    WE_Event_t *event = &task->queue[(task->head + task->count) % task->queueSize];
+    event->signal = signal;
+    event->param = param;
+    event->data = data;
+    event->timestamp = now;
+
+    task->count++;
+    if (task->count > task->stats.queueHighWater)
+    {
+        task->stats.queueHighWater = task->count;
+    }
+    schedulerReady |= 1UL << task->priority;
+
+    WE_SCHEDULER_UNLOCK();
+    return true;
+}
+
+bool WE_Scheduler_RunOnce(void)
+{
+    WE_SCHEDULER_LOCK();
+
+    /* Highest ready priority, a ready bit without a task is dropped */
+    WE_Task_t *task = NULL;
+    while ((0 != schedulerReady) && (NULL == task))
+    {
+        uint8_t priority = (uint8_t)(31 - __builtin_clz(schedulerReady));
+        task = schedulerTasks[priority];
+        if (NULL == task)
+        {
+            schedulerReady &= ~(1UL << priority);
+        }
+    }
+
+    if (NULL == task)
+    {
+        WE_SCHEDULER_UNLOCK();
+        return false;
+    }
+
+    WE_Event_t event = task->queue[task->head];
+    task->head = (uint8_t)((task->head + 1) % task->queueSize);
+    task->count--;
+    if (0 == task->count)
+    {
+        schedulerReady &= ~(1UL << task->priority);
+    }
+
+    WE_SCHEDULER_UNLOCK();
+
+    uint32_t start = (uint32_t)WE_SoftTimer_GetTicks();
+    task->handler(task, &event);
+    uint32_t end = (uint32_t)WE_SoftTimer_GetTicks();
+
+    WE_Scheduler_Record(task, (start - event.timestamp) / WE_SOFTTIMER_TICKS_PER_US, (end - start) / WE_SOFTTIMER_TICKS_PER_US);
+    return true;
+}
+
+void WE_Scheduler_Run(void)
+{
+    for (;;)
+    {
+        while (WE_Scheduler_RunOnce())
+        {
+        }
+
+#if defined(WE_DEBUG)
+        /* WE_Delay() is not used here, send the queued debug output before going idle */
+        WE_Debug_Process();
+#endif
+
+        /* Check again with interrupts disabled, so that no event can be posted unnoticed before going idle */
+        WE_SCHEDULER_LOCK();
+        while (0 == schedulerReady)
+        {
+            WE_Scheduler_Idle();
+            /* Let pending interrupts run */
+            WE_SCHEDULER_WAIT();
+        }
+        WE_SCHEDULER_UNLOCK();
+    }
+}
+
+__attribute__((weak)) void WE_Scheduler_Idle(void)
+{
+}
+
+bool WE_Scheduler_StartTimer(WE_Scheduler_Timer_t *timer, WE_Task_t *task, uint16_t signal, uint32_t delay_us, uint32_t period_us)
+{
+    WE_Scheduler_StopTimer(timer);
+
+    timer->task = task;
+    timer->signal = signal;
+    timer->param = 0;
+    return WE_SoftTimer_Start(&timer->timer, delay_us, period_us, WE_Scheduler_TimerExpired, timer);
+}
+
+bool WE_Scheduler_StopTimer(WE_Scheduler_Timer_t *timer)
+{
+    return WE_SoftTimer_Stop(&timer->timer);
+}
+
+void WE_Scheduler_GetStats(const WE_Task_t *task, WE_Task_Stats_t *stats)
+{
+    WE_SCHEDULER_LOCK();
+    *stats = task->stats;
+    WE_SCHEDULER_UNLOCK();
+}
+
+void WE_Scheduler_ResetStats(void)
+{
+    for (uint8_t i = 0; i < WE_SCHEDULER_MAX_TASKS; i++)
+    {
+        if (NULL != schedulerTasks[i])
+        {
+            WE_SCHEDULER_LOCK();
+            WE_Scheduler_ResetTaskStats(schedulerTasks[i]);
+            WE_SCHEDULER_UNLOCK();
+        }
+    }
+}
+
+void WE_Scheduler_PrintStats(void)
+{
+#if defined(WE_DEBUG)
+    WE_DEBUG_INFO("Task          Events Dropped Queue  Latency min/avg/max [us]  Run max [us]\r\n");
+    for (int8_t i = WE_SCHEDULER_MAX_TASKS - 1; i >= 0; i--)
+    {
+        if (NULL == schedulerTasks[i])
+        {
+            continue;
+        }
+
+        WE_Task_Stats_t stats;
+        WE_Scheduler_GetStats(schedulerTasks[i], &stats);
+        uint32_t average = (0 != stats.handled) ? (uint32_t)(stats.latencySum / stats.handled) : 0;
+        WE_DEBUG_INFO("%-12s %7lu %7lu %5d  %8lu %6lu %8lu  %12lu\r\n", schedulerTasks[i]->name, (unsigned long)stats.handled,
+                      (unsigned long)stats.dropped, stats.queueHighWater, (unsigned long)((0 != stats.handled) ? stats.latencyMin : 0),
+                      (unsigned long)average, (unsigned long)stats.latencyMax, (unsigned long)stats.runMax);
+    }
+#endif
+}
+
+/**
+ * @brief Software timer callback (interrupt context), posts the event of a scheduler timer.
+ *
+ * @param[in] timer Software timer
+ * @param[in] context Scheduler timer
+ */
+static void WE_Scheduler_TimerExpired(WE_SoftTimer_t *timer, void *context)
+{
+    (void)timer;
+    WE_Scheduler_Timer_t *schedulerTimer = (WE_Scheduler_Timer_t *)context;
+
+    schedulerTimer->param++;
+    WE_Scheduler_Post(schedulerTimer->task, schedulerTimer->signal, schedulerTimer->param, schedulerTimer);
+}
+
+/**
+ * @brief Reset the statistics of a task.
+ *
+ * @param[in] task Task
+ */
+static void WE_Scheduler_ResetTaskStats(WE_Task_t *task)
+{
+    memset(&task->stats, 0, sizeof(task->stats));
+    task->stats.latencyMin = UINT32_MAX;
+}
+
+/**
+ * @brief Add the latency and run time of a handled event to the statistics of a task.
+ *
+ * @param[in] task Task
+ * @param[in] latency Time from posting to start of the handler in microseconds
+ * @param[in] run Run time of the handler in microseconds
+ */
+static void WE_Scheduler_Record(WE_Task_t *task, uint32_t latency, uint32_t run)
+{
+    uint8_t bucket = (0 == latency) ? 0 : (uint8_t)(32 - __builtin_clz(latency));
+    if (bucket >= WE_SCHEDULER_LATENCY_BUCKETS)
+    {
+        bucket = WE_SCHEDULER_LATENCY_BUCKETS - 1;
+    }
+
+    WE_SCHEDULER_LOCK();
+    WE_Task_Stats_t *stats = &task->stats;
+    stats->handled++;
+    stats->latencySum += latency;
+    stats->latencyMin = (latency < stats->latencyMin) ? latency : stats->latencyMin;
+    stats->latencyMax = (latency > stats->latencyMax) ? latency : stats->latencyMax;
+    stats->runMax = (run > stats->runMax) ? run : stats->runMax;
+    stats->latencyHistogram[bucket]++;
+    WE_SCHEDULER_UNLOCK();
+}
@@ -0,0 +1,222 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Cooperative run-to-completion scheduler.
+ *
+ * Tasks have a fixed priority and an event queue. Events are posted from interrupt handlers
+ * (UART, timers, ...) or from other tasks and are handled one after another by the task's
+ * handler, the highest priority task with a pending event first. Handlers are never
+ * interrupted by other handlers, so the latency of an event is bounded by the longest handler.
+ */
+
+#ifndef SCHEDULER_H_INCLUDED
+#define SCHEDULER_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "soft_timer.h"
+
+/* Number of priorities, each priority can be taken by one task (0 is the lowest priority) */
+#ifndef WE_SCHEDULER_MAX_TASKS
+#define WE_SCHEDULER_MAX_TASKS 8
+#endif
+
+/* Buckets of the latency histogram, bucket n counts latencies of [2^(n-1), 2^n) microseconds */
+#define WE_SCHEDULER_LATENCY_BUCKETS 16
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Event.
+     */
+    typedef struct
+    {
+        uint16_t signal;    /* Meaning of the event, defined by the receiving task */
+        uint32_t param;     /* Signal specific value */
+        void *data;         /* Signal specific data */
+        uint32_t timestamp; /* Time of posting (software timer ticks) */
+    } WE_Event_t;
+
+    typedef struct WE_Task WE_Task_t;
+
+    /**
+     * @brief Handles one event of a task.
+     */
+    typedef void (*WE_Task_Handler_t)(WE_Task_t *task, const WE_Event_t *event);
+
+    /**
+     * @brief Task statistics, times in microseconds.
+     */
+    typedef struct
+    {
+        uint32_t handled;          /* Events handled */
+        uint32_t dropped;          /* Events dropped because the queue was full */
+        uint8_t queueHighWater;    /* Maximum number of queued events */
+        uint32_t latencyMin;       /* Minimum time from posting to start of the handler */
+        uint32_t latencyMax;       /* Maximum time from posting to start of the handler */
+        uint64_t latencySum;       /* Sum of all latencies */
+        uint32_t runMax;           /* Maximum run time of the handler */
+        uint32_t latencyHistogram[WE_SCHEDULER_LATENCY_BUCKETS];
+    } WE_Task_Stats_t;
+
+    /**
+     * @brief Task, the storage is owned by the caller. All fields are private to the scheduler.
+     */
+    struct WE_Task
+    {
+        const char *name;
+        WE_Task_Handler_t handler;
+        void *context;
+        WE_Event_t *queue;
+        uint8_t queueSize;
+        uint8_t head;
+        uint8_t count;
+        uint8_t priority;
+        WE_Task_Stats_t stats;
+    };
+
+    /**
+     * @brief Timer posting an event to a task, the storage is owned by the caller.
+     */
+    typedef struct
+    {
+        WE_SoftTimer_t timer;
+        WE_Task_t *task;
+        uint16_t signal;
+        uint32_t param;
+    } WE_Scheduler_Timer_t;
+
+    /**
+     * @brief Initialize the scheduler and start the software timers.
+     *
+     * @return true if request succeeded, false otherwise
+     */
+    extern bool WE_Scheduler_Init(void);
+
+    /**
+     * @brief Add a task.
+     *
+     * @param[out] task Task
+     * @param[in] name Name used in statistics output
+     * @param[in] priority Priority (0 ... WE_SCHEDULER_MAX_TASKS - 1), must not be used by another task
+     * @param[in] queue Event queue storage
+     * @param[in] queueSize Number of events of the queue
+     * @param[in] handler Event handler
+     * @param[in] context Task specific data for the handler
+     * @return true if request succeeded, false otherwise
+     */
+    extern bool WE_Scheduler_AddTask(WE_Task_t *task, const char *name, uint8_t priority, WE_Event_t *queue, uint8_t queueSize, WE_Task_Handler_t handler, void *context);
+
+    /**
+     * @brief Remove a task, pending events are discarded.
+     *
+     * @param[in] task Task
+     */
+    extern void WE_Scheduler_RemoveTask(WE_Task_t *task);
+
+    /**
+     * @brief Post an event to a task.
+     *
+     * Can be called from interrupt context.
+     *
+     * @param[in] task Task
+     * @param[in] signal Signal
+     * @param[in] param Signal specific value
+     * @param[in] data Signal specific data
+     * @return true if the event was queued, false if the queue was full or the task is not added
+     */
+    extern bool WE_Scheduler_Post(WE_Task_t *task, uint16_t signal, uint32_t param, void *data);
+
+    /**
+     * @brief Handle the next event of the highest priority task with pending events.
+     *
+     * @return true if an event was handled, false if no event was pending
+     */
+    extern bool WE_Scheduler_RunOnce(void);
+
+    /**
+     * @brief Handle events forever, WE_Scheduler_Idle() is called whenever no event is pending.
+     */
+    extern void WE_Scheduler_Run(void);
+
+    /**
+     * @brief Called with interrupts disabled when no event is pending.
+     *
+     * The weak default returns right away. An implementation may wait for an interrupt,
+     * interrupts are enabled again after it returns.
+     */
+    extern void WE_Scheduler_Idle(void);
+
+    /**
+     * @brief Start a timer posting an event to a task.
+     *
+     * The event's param is set to the number of the expiry (starting at 1).
+     *
+     * @param[in] timer Timer, zero initialized before its first use
+     * @param[in] task Task receiving the event
+     * @param[in] signal Signal of the event
+     * @param[in] delay_us Delay until the first event in microseconds
+     * @param[in] period_us Period in microseconds (max. WE_SOFTTIMER_MAX_PERIOD_US) for periodic timers, 0 for one-shot timers
+     * @return true if the timer has been started, false if the period is too long
+     */
+    extern bool WE_Scheduler_StartTimer(WE_Scheduler_Timer_t *timer, WE_Task_t *task, uint16_t signal, uint32_t delay_us, uint32_t period_us);
+
+    /**
+     * @brief Stop a timer.
+     *
+     * @param[in] timer Timer
+     * @return true if the timer was running, false otherwise
+     */
+    extern bool WE_Scheduler_StopTimer(WE_Scheduler_Timer_t *timer);
+
+    /**
+     * @brief Get the statistics of a task.
+     *
+     * @param[in] task Task
+     * @param[out] stats Statistics
+     */
+    extern void WE_Scheduler_GetStats(const WE_Task_t *task, WE_Task_Stats_t *stats);
+
+    /**
+     * @brief Reset the statistics of all tasks.
+     */
+    extern void WE_Scheduler_ResetStats(void);
+
+    /**
+     * @brief Print the statistics of all tasks as debug output.
+     */
+    extern void WE_Scheduler_PrintStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHEDULER_H_INCLUDED */
@@ -0,0 +1,124 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Software timers multiplexed onto one hardware timer.
+ */
+
+#ifndef SOFT_TIMER_H_INCLUDED
+#define SOFT_TIMER_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "timer_wheel.h"
+
+/* Resolution of the software timers, the hardware counter runs at 3 MHz */
+#define WE_SOFTTIMER_TICKS_PER_US 3
+
+/* Longest period of WE_SoftTimer_Start (about 1431 s), the timer wheel keeps periods as 32 bit ticks */
+#define WE_SOFTTIMER_MAX_PERIOD_US (UINT32_MAX / WE_SOFTTIMER_TICKS_PER_US)
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Start the hardware timer of the software timers.
+     *
+     * The hardware timer is selected by WE_SOFTTIMER_TIMER (default Timer3).
+     * Calling this function again has no effect.
+     *
+     * @return true if request succeeded, false otherwise
+     */
+    extern bool WE_SoftTimer_Init(void);
+
+    /**
+     * @brief Start (or restart) a software timer.
+     *
+     * The callback is called from interrupt context. Timers with a delay shorter
+     * than a few microseconds expire a few microseconds late.
+     *
+     * @param[in] timer Timer, zero initialized before its first use
+     * @param[in] delay_us Delay until the first expiry in microseconds
+     * @param[in] period_us Period in microseconds (max. WE_SOFTTIMER_MAX_PERIOD_US) for periodic timers, 0 for one-shot timers
+     * @param[in] callback Function called on expiry
+     * @param[in] context Passed to the callback
+     * @return true if the timer has been started, false if the period is too long
+     */
+    extern bool WE_SoftTimer_Start(WE_SoftTimer_t *timer, uint32_t delay_us, uint32_t period_us, WE_SoftTimer_Callback_t callback, void *context);
+
+    /**
+     * @brief Start (or restart) a software timer at an absolute time.
+     *
+     * Useful to schedule periodic work without drift, e.g. relative to the previous expiry.
+     *
+     * @param[in] timer Timer, zero initialized before its first use
+     * @param[in] expiry Expiry time in ticks of WE_SoftTimer_GetTicks()
+     * @param[in] period Period in ticks for periodic timers, 0 for one-shot timers
+     * @param[in] callback Function called on expiry
+     * @param[in] context Passed to the callback
+     */
+    extern void WE_SoftTimer_StartAt(WE_SoftTimer_t *timer, uint64_t expiry, uint32_t period, WE_SoftTimer_Callback_t callback, void *context);
+
+    /**
+     * @brief Stop a software timer.
+     *
+     * @param[in] timer Timer
+     * @return true if the timer was running, false otherwise
+     */
+    extern bool WE_SoftTimer_Stop(WE_SoftTimer_t *timer);
+
+    /**
+     * @brief Check whether a software timer is running.
+     *
+     * @param[in] timer Timer
+     * @return true if the timer is running, false otherwise
+     */
+    extern bool WE_SoftTimer_IsActive(const WE_SoftTimer_t *timer);
+
+    /**
+     * @brief Current time of the software timers.
+     *
+     * The time continues the micros() clock at WE_SoftTimer_Init().
+     *
+     * @return Ticks (WE_SOFTTIMER_TICKS_PER_US per microsecond) since the start of the MCU
+     */
+    extern uint64_t WE_SoftTimer_GetTicks(void);
+
+    /**
+     * @brief Number of running software timers.
+     *
+     * @return Number of running software timers
+     */
+    extern uint32_t WE_SoftTimer_GetActiveCount(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SOFT_TIMER_H_INCLUDED */
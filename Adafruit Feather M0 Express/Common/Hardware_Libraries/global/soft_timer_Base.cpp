@@ -0,0 +1,146 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Software timers driven by the host clock (BASE_PLATFORM).
+ */
+
+#include "soft_timer.h"
+
+#ifdef BASE_PLATFORM
+
+#include "ConfigPlatform.h"
+#include "event_trace.h"
+
+static WE_TimerWheel_t softTimerWheel;
+static BaseClock_Source softTimerSource;
+static bool softTimerStarted = false;
+
+static uint64_t WE_SoftTimer_NextEvent(void *context);
+static void WE_SoftTimer_Service(void *context, uint64_t now);
+
+bool WE_SoftTimer_Init(void)
+{
+    if (softTimerStarted)
+    {
+        return true;
+    }
+
+    WE_TimerWheel_Init(&softTimerWheel, WE_SoftTimer_GetTicks());
+
+    softTimerSource.nextEvent = WE_SoftTimer_NextEvent;
+    softTimerSource.service = WE_SoftTimer_Service;
+    softTimerSource.fd = -1;
+    BaseClock_addSource(&softTimerSource);
+
+    softTimerStarted = true;
+    return true;
+}
+
+bool WE_SoftTimer_Start(WE_SoftTimer_t *timer, uint32_t delay_us, uint32_t period_us, WE_SoftTimer_Callback_t callback, void *context)
+{
+    if (period_us > WE_SOFTTIMER_MAX_PERIOD_US)
+    {
+        return false;
+    }
+
+    WE_SoftTimer_Init();
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint64_t now = WE_SoftTimer_GetTicks();
+    WE_TimerWheel_Start(&softTimerWheel, timer, now + (uint64_t)delay_us * WE_SOFTTIMER_TICKS_PER_US, period_us * WE_SOFTTIMER_TICKS_PER_US, callback, context);
+
+    __set_PRIMASK(primask);
+    return true;
+}
+
+void WE_SoftTimer_StartAt(WE_SoftTimer_t *timer, uint64_t expiry, uint32_t period, WE_SoftTimer_Callback_t callback, void *context)
+{
+    WE_SoftTimer_Init();
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    WE_TimerWheel_Start(&softTimerWheel, timer, expiry, period, callback, context);
+
+    __set_PRIMASK(primask);
+}
+
+bool WE_SoftTimer_Stop(WE_SoftTimer_t *timer)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    bool wasActive = WE_TimerWheel_Cancel(&softTimerWheel, timer);
+
+    __set_PRIMASK(primask);
+    return wasActive;
+}
+
+bool WE_SoftTimer_IsActive(const WE_SoftTimer_t *timer)
+{
+    return WE_TimerWheel_IsActive(timer);
+}
+
+uint64_t WE_SoftTimer_GetTicks(void)
+{
+    return BaseClock_now() * WE_SOFTTIMER_TICKS_PER_US;
+}
+
+uint32_t WE_SoftTimer_GetActiveCount(void)
+{
+    return softTimerWheel.active;
+}
+
+/**
+ * @brief Next event of the wheel in microseconds, rounded up so that it is due when serviced.
+ */
+static uint64_t WE_SoftTimer_NextEvent(void *context)
+{
+    (void)context;
+    uint64_t next = WE_TimerWheel_NextEvent(&softTimerWheel);
+    if (UINT64_MAX == next)
+    {
+        return UINT64_MAX;
+    }
+    return (next + WE_SOFTTIMER_TICKS_PER_US - 1) / WE_SOFTTIMER_TICKS_PER_US;
+}
+
+/**
+ * @brief Clock source service: advance the wheel and call the expired timers.
+ */
+static void WE_SoftTimer_Service(void *context, uint64_t now)
+{
+    (void)context;
+    (void)now;
+    WE_EVENT_BEGIN(WE_EVENT_ID_SOFTTIMER_ISR);
+    WE_TimerWheel_Advance(&softTimerWheel, WE_SoftTimer_GetTicks());
+    WE_EVENT_END(WE_EVENT_ID_SOFTTIMER_ISR);
+}
+
+#endif /* BASE_PLATFORM */
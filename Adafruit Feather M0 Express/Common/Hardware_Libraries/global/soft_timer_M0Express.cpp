@@ -0,0 +1,215 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Software timers multiplexed onto one hardware timer (M0Express).
+ */
+
+#include "soft_timer.h"
+
+#ifdef M0Express
+
+#include <Arduino.h>
+#include "ArduinoTimer.h"
+#include "event_trace.h"
+#include "fast_gpio.h"
+
+/* Hardware timer running the software timers */
+#ifndef WE_SOFTTIMER_TIMER
+#define WE_SOFTTIMER_TIMER Timer3
+#endif
+
+/* Events closer than this (8 us) are handled right away instead of by a compare match,
+   so that the compare value is written well before the counter reaches it */
+#define WE_SOFTTIMER_MIN_TICKS (8 * WE_SOFTTIMER_TICKS_PER_US)
+
+#define WE_SOFTTIMER_COUNTER_RANGE 0x10000
+
+static Timer softTimerHardware;
+static WE_TimerWheel_t softTimerWheel;
+static volatile uint32_t softTimerOverflows = 0;
+static bool softTimerStarted = false;
+
+static void WE_SoftTimer_Arm(uint64_t now);
+static void WE_SoftTimer_Service(void);
+static void WE_SoftTimer_HandleOverflow(void);
+
+bool WE_SoftTimer_Init(void)
+{
+    if (softTimerStarted)
+    {
+        return true;
+    }
+
+    if (!Timer_create(&softTimerHardware, WE_SOFTTIMER_TIMER))
+    {
+        return false;
+    }
+
+    /* The counter starts at zero. The overflows continue the micros() clock (rounded up), which
+     * WE_GetTickMicroseconds64() uses before the counter runs, so the time never goes back. */
+    softTimerOverflows = (uint32_t)((((uint64_t)micros() * WE_SOFTTIMER_TICKS_PER_US) >> 16) + 1);
+    WE_TimerWheel_Init(&softTimerWheel, (uint64_t)softTimerOverflows << 16);
+
+    /* The counter keeps running in standby so that it can wake up the MCU (see idle.h) */
+    if (!Timer_startCounter(&softTimerHardware, true, WE_SoftTimer_HandleOverflow, WE_SoftTimer_Service))
+    {
+        return false;
+    }
+
+    softTimerStarted = true;
+    return true;
+}
+
+bool WE_SoftTimer_Start(WE_SoftTimer_t *timer, uint32_t delay_us, uint32_t period_us, WE_SoftTimer_Callback_t callback, void *context)
+{
+    if (period_us > WE_SOFTTIMER_MAX_PERIOD_US)
+    {
+        return false;
+    }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint64_t now = WE_SoftTimer_GetTicks();
+    WE_TimerWheel_Start(&softTimerWheel, timer, now + (uint64_t)delay_us * WE_SOFTTIMER_TICKS_PER_US, period_us * WE_SOFTTIMER_TICKS_PER_US, callback, context);
+    WE_SoftTimer_Arm(now);
+
+    __set_PRIMASK(primask);
+    return true;
+}
+
+void WE_SoftTimer_StartAt(WE_SoftTimer_t *timer, uint64_t expiry, uint32_t period, WE_SoftTimer_Callback_t callback, void *context)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    WE_TimerWheel_Start(&softTimerWheel, timer, expiry, period, callback, context);
+    WE_SoftTimer_Arm(WE_SoftTimer_GetTicks());
+
+    __set_PRIMASK(primask);
+}
+
+bool WE_SoftTimer_Stop(WE_SoftTimer_t *timer)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    /* A compare match of a cancelled timer only advances the wheel */
+    bool wasActive = WE_TimerWheel_Cancel(&softTimerWheel, timer);
+
+    __set_PRIMASK(primask);
+    return wasActive;
+}
+
+bool WE_SoftTimer_IsActive(const WE_SoftTimer_t *timer)
+{
+    return WE_TimerWheel_IsActive(timer);
+}
+
+uint64_t WE_SoftTimer_GetTicks(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint32_t overflows = softTimerOverflows;
+    uint16_t count = Timer_readCounter(&softTimerHardware);
+
+    /* A pending overflow belongs to this count unless the count was read just before the wrap around */
+    if (Timer_isOverflowPending(&softTimerHardware) && (count < WE_SOFTTIMER_COUNTER_RANGE / 2))
+    {
+        overflows++;
+    }
+
+    __set_PRIMASK(primask);
+
+    return ((uint64_t)overflows << 16) | count;
+}
+
+uint32_t WE_SoftTimer_GetActiveCount(void)
+{
+    return softTimerWheel.active;
+}
+
+/**
+ * @brief Program the compare match for the next event of the wheel.
+ *
+ * Events beyond the range of the 16-bit counter are picked up by the overflow interrupt.
+ * Must be called with interrupts disabled or from the timer interrupt.
+ *
+ * @param[in] now Current time in ticks
+ */
+static void WE_SoftTimer_Arm(uint64_t now)
+{
+    uint64_t next = WE_TimerWheel_NextEvent(&softTimerWheel);
+
+    if (next < now + WE_SOFTTIMER_MIN_TICKS)
+    {
+        next = now + WE_SOFTTIMER_MIN_TICKS;
+    }
+
+    if (next - now >= WE_SOFTTIMER_COUNTER_RANGE)
+    {
+        Timer_disableCompare(&softTimerHardware);
+        return;
+    }
+
+    Timer_setCompare(&softTimerHardware, (uint16_t)next);
+}
+
+/**
+ * @brief Compare match: advance the wheel and call the expired timers.
+ */
+static void WE_SoftTimer_Service(void)
+{
+    WE_TRACE_BEGIN(WE_TRACE_ID_SOFTTIMER_ISR);
+    WE_EVENT_BEGIN(WE_EVENT_ID_SOFTTIMER_ISR);
+    for (;;)
+    {
+        WE_TimerWheel_Advance(&softTimerWheel, WE_SoftTimer_GetTicks());
+
+        /* Callbacks may have taken a while, events that are due by now are handled in this loop */
+        uint64_t now = WE_SoftTimer_GetTicks();
+        if (WE_TimerWheel_NextEvent(&softTimerWheel) >= now + WE_SOFTTIMER_MIN_TICKS)
+        {
+            WE_SoftTimer_Arm(now);
+            WE_EVENT_END(WE_EVENT_ID_SOFTTIMER_ISR);
+            WE_TRACE_END(WE_TRACE_ID_SOFTTIMER_ISR);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Counter overflow: extend the counter and check for events that are in range now.
+ */
+static void WE_SoftTimer_HandleOverflow(void)
+{
+    softTimerOverflows++;
+    WE_SoftTimer_Service();
+}
+
+#endif /* M0Express */
@@ -0,0 +1,313 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Hierarchical timer wheel for software timers.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "timer_wheel.h"
+
+/* Values of WE_SoftTimer_t.level besides the wheel levels (stored as level + 1) */
+#define WE_TIMERWHEEL_LEVEL_NONE 0
+#define WE_TIMERWHEEL_LEVEL_OVERFLOW (WE_TIMERWHEEL_LEVELS + 1)
+#define WE_TIMERWHEEL_LEVEL_EXPIRED 0xFF
+
+#define WE_TIMERWHEEL_SLOT_MASK (WE_TIMERWHEEL_SLOTS - 1)
+#define WE_TIMERWHEEL_SPAN_BITS (WE_TIMERWHEEL_SLOT_BITS * WE_TIMERWHEEL_LEVELS)
+
+static void WE_TimerWheel_Link(WE_SoftTimer_t **head, WE_SoftTimer_t *timer);
+static void WE_TimerWheel_Unlink(WE_SoftTimer_t *timer);
+static void WE_TimerWheel_Enqueue(WE_TimerWheel_t *wheel, WE_SoftTimer_t *timer);
+static void WE_TimerWheel_Cascade(WE_TimerWheel_t *wheel, WE_SoftTimer_t *list);
+static uint64_t WE_TimerWheel_NextSlot(const WE_TimerWheel_t *wheel);
+static void WE_TimerWheel_Process(WE_TimerWheel_t *wheel, uint64_t time);
+static uint32_t WE_TimerWheel_Expire(WE_TimerWheel_t *wheel, uint64_t now);
+
+void WE_TimerWheel_Init(WE_TimerWheel_t *wheel, uint64_t now)
+{
+    memset(wheel, 0, sizeof(*wheel));
+    wheel->now = now;
+}
+
+void WE_TimerWheel_Start(WE_TimerWheel_t *wheel, WE_SoftTimer_t *timer, uint64_t expiry, uint32_t period, WE_SoftTimer_Callback_t callback, void *context)
+{
+    WE_TimerWheel_Cancel(wheel, timer);
+
+    timer->expiry = expiry;
+    timer->period = period;
+    timer->callback = callback;
+    timer->context = context;
+    wheel->active++;
+
+    WE_TimerWheel_Enqueue(wheel, timer);
+}
+
+bool WE_TimerWheel_Cancel(WE_TimerWheel_t *wheel, WE_SoftTimer_t *timer)
+{
+    if (WE_TIMERWHEEL_LEVEL_NONE == timer->level)
+    {
+        return false;
+    }
+
+    WE_TimerWheel_Unlink(timer);
+
+    if (timer->level <= WE_TIMERWHEEL_LEVELS)
+    {
+        uint8_t level = timer->level - 1;
+        if (NULL == wheel->slots[level][timer->slot])
+        {
+            wheel->occupied[level] &= ~(1UL << timer->slot);
+        }
+    }
+
+    timer->level = WE_TIMERWHEEL_LEVEL_NONE;
+    wheel->active--;
+    return true;
+}
+
+bool WE_TimerWheel_IsActive(const WE_SoftTimer_t *timer)
+{
+    return WE_TIMERWHEEL_LEVEL_NONE != timer->level;
+}
+
+uint32_t WE_TimerWheel_Advance(WE_TimerWheel_t *wheel, uint64_t now)
+{
+    uint32_t fired = WE_TimerWheel_Expire(wheel, now);
+
+    uint64_t next;
+    while ((next = WE_TimerWheel_NextSlot(wheel)) <= now)
+    {
+        WE_TimerWheel_Process(wheel, next);
+        fired += WE_TimerWheel_Expire(wheel, now);
+    }
+
+    if (now > wheel->now)
+    {
+        wheel->now = now;
+    }
+
+    return fired;
+}
+
+uint64_t WE_TimerWheel_NextEvent(const WE_TimerWheel_t *wheel)
+{
+    if (NULL != wheel->expired)
+    {
+        return wheel->now;
+    }
+
+    return WE_TimerWheel_NextSlot(wheel);
+}
+
+/**
+ * @brief Insert a timer at the head of a list.
+ *
+ * @param[in] head List head
+ * @param[in] timer Timer to insert
+ */
+static void WE_TimerWheel_Link(WE_SoftTimer_t **head, WE_SoftTimer_t *timer)
+{
+    timer->next = *head;
+    if (NULL != timer->next)
+    {
+        timer->next->pprev = &timer->next;
+    }
+    timer->pprev = head;
+    *head = timer;
+}
+
+/**
+ * @brief Remove a timer from the list it is part of.
+ *
+ * @param[in] timer Timer to remove
+ */
+static void WE_TimerWheel_Unlink(WE_SoftTimer_t *timer)
+{
+    *timer->pprev = timer->next;
+    if (NULL != timer->next)
+    {
+        timer->next->pprev = timer->pprev;
+    }
+    timer->next = NULL;
+    timer->pprev = NULL;
+}
+
+/**
+ * @brief Put a timer into the slot matching its expiry relative to the current time of the wheel.
+ *
+ * @param[in] wheel Timer wheel
+ * @param[in] timer Timer
+ */
+static void WE_TimerWheel_Enqueue(WE_TimerWheel_t *wheel, WE_SoftTimer_t *timer)
+{
+    if (timer->expiry <= wheel->now)
+    {
+        timer->level = WE_TIMERWHEEL_LEVEL_EXPIRED;
+        WE_TimerWheel_Link(&wheel->expired, timer);
+        return;
+    }
+
+    /* The highest bit that differs from the current time selects the level */
+    uint8_t level = (uint8_t)((63 - __builtin_clzll(timer->expiry ^ wheel->now)) / WE_TIMERWHEEL_SLOT_BITS);
+    if (level >= WE_TIMERWHEEL_LEVELS)
+    {
+        timer->level = WE_TIMERWHEEL_LEVEL_OVERFLOW;
+        WE_TimerWheel_Link(&wheel->overflow, timer);
+        return;
+    }
+
+    uint8_t slot = (uint8_t)((timer->expiry >> (level * WE_TIMERWHEEL_SLOT_BITS)) & WE_TIMERWHEEL_SLOT_MASK);
+    timer->level = level + 1;
+    timer->slot = slot;
+    WE_TimerWheel_Link(&wheel->slots[level][slot], timer);
+    wheel->occupied[level] |= 1UL << slot;
+}
+
+/**
+ * @brief Enqueue all timers of a list again.
+ *
+ * @param[in] wheel Timer wheel
+ * @param[in] list Detached list of timers
+ */
+static void WE_TimerWheel_Cascade(WE_TimerWheel_t *wheel, WE_SoftTimer_t *list)
+{
+    while (NULL != list)
+    {
+        WE_SoftTimer_t *timer = list;
+        list = timer->next;
+        WE_TimerWheel_Enqueue(wheel, timer);
+    }
+}
+
+/**
+ * @brief Time of the next occupied slot.
+ *
+ * Lower levels always end before the next slot of a higher level starts,
+ * so the first occupied slot found from the lowest level upwards is the next one.
+ *
+ * @param[in] wheel Timer wheel
+ * @return Start time of the next occupied slot, UINT64_MAX if there is none
+ */
+static uint64_t WE_TimerWheel_NextSlot(const WE_TimerWheel_t *wheel)
+{
+    for (uint8_t level = 0; level < WE_TIMERWHEEL_LEVELS; level++)
+    {
+        uint8_t shift = level * WE_TIMERWHEEL_SLOT_BITS;
+        uint32_t current = (uint32_t)((wheel->now >> shift) & WE_TIMERWHEEL_SLOT_MASK);
+        uint32_t pending = wheel->occupied[level] & ~((2UL << current) - 1);
+
+        if (0 != pending)
+        {
+            uint64_t block = wheel->now & ~((1ULL << (shift + WE_TIMERWHEEL_SLOT_BITS)) - 1);
+            return block | ((uint64_t)__builtin_ctzl(pending) << shift);
+        }
+    }
+
+    if (NULL != wheel->overflow)
+    {
+        return (wheel->now | ((1ULL << WE_TIMERWHEEL_SPAN_BITS) - 1)) + 1;
+    }
+
+    return UINT64_MAX;
+}
+
+/**
+ * @brief Move the wheel to the start of the next occupied slot and move its timers down.
+ *
+ * @param[in] wheel Timer wheel
+ * @param[in] time Start time of the next occupied slot
+ */
+static void WE_TimerWheel_Process(WE_TimerWheel_t *wheel, uint64_t time)
+{
+    wheel->now = time;
+
+    if ((NULL != wheel->overflow) && (0 == (time & ((1ULL << WE_TIMERWHEEL_SPAN_BITS) - 1))))
+    {
+        WE_SoftTimer_t *list = wheel->overflow;
+        wheel->overflow = NULL;
+        WE_TimerWheel_Cascade(wheel, list);
+    }
+
+    /* Higher levels first, their timers may end up in the current slot of a lower level */
+    for (int8_t level = WE_TIMERWHEEL_LEVELS - 1; level >= 0; level--)
+    {
+        uint8_t shift = level * WE_TIMERWHEEL_SLOT_BITS;
+        if (0 != (time & ((1ULL << shift) - 1)))
+        {
+            continue;
+        }
+
+        uint8_t slot = (uint8_t)((time >> shift) & WE_TIMERWHEEL_SLOT_MASK);
+        WE_SoftTimer_t *list = wheel->slots[level][slot];
+        if (NULL != list)
+        {
+            wheel->slots[level][slot] = NULL;
+            wheel->occupied[level] &= ~(1UL << slot);
+            WE_TimerWheel_Cascade(wheel, list);
+        }
+    }
+}
+
+/**
+ * @brief Call the callbacks of all expired timers.
+ *
+ * @param[in] wheel Timer wheel
+ * @param[in] now Time the wheel is advanced to
+ * @return Number of callbacks called
+ */
+static uint32_t WE_TimerWheel_Expire(WE_TimerWheel_t *wheel, uint64_t now)
+{
+    uint32_t fired = 0;
+
+    while (NULL != wheel->expired)
+    {
+        WE_SoftTimer_t *timer = wheel->expired;
+        WE_TimerWheel_Unlink(timer);
+
+        if (0 != timer->period)
+        {
+            timer->expiry += timer->period;
+            if (timer->expiry <= now)
+            {
+                /* Skip missed periods */
+                timer->expiry += ((now - timer->expiry) / timer->period + 1) * timer->period;
+            }
+            WE_TimerWheel_Enqueue(wheel, timer);
+        }
+        else
+        {
+            timer->level = WE_TIMERWHEEL_LEVEL_NONE;
+            wheel->active--;
+        }
+
+        timer->callback(timer, timer->context);
+        fired++;
+    }
+
+    return fired;
+}
@@ -0,0 +1,160 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Hierarchical timer wheel for software timers.
+ */
+
+#ifndef TIMER_WHEEL_H_INCLUDED
+#define TIMER_WHEEL_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Number of slots per level (as power of two) */
+#ifndef WE_TIMERWHEEL_SLOT_BITS
+#define WE_TIMERWHEEL_SLOT_BITS 5
+#endif
+
+/* Number of levels, the wheel covers 2^(SLOT_BITS * LEVELS) ticks, later timers wait in an overflow list */
+#ifndef WE_TIMERWHEEL_LEVELS
+#define WE_TIMERWHEEL_LEVELS 5
+#endif
+
+#define WE_TIMERWHEEL_SLOTS (1 << WE_TIMERWHEEL_SLOT_BITS)
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct WE_SoftTimer WE_SoftTimer_t;
+
+    /**
+     * @brief Called when a software timer expires.
+     */
+    typedef void (*WE_SoftTimer_Callback_t)(WE_SoftTimer_t *timer, void *context);
+
+    /**
+     * @brief Software timer, the storage is owned by the caller.
+     *
+     * All fields are private to the timer wheel. A timer has to be zero initialized before it is
+     * started for the first time.
+     */
+    struct WE_SoftTimer
+    {
+        WE_SoftTimer_t *next;
+        WE_SoftTimer_t **pprev;
+        uint64_t expiry;
+        uint32_t period;
+        WE_SoftTimer_Callback_t callback;
+        void *context;
+        uint8_t level;
+        uint8_t slot;
+    };
+
+    /**
+     * @brief Timer wheel.
+     *
+     * Level n has slots of 2^(SLOT_BITS * n) ticks. A timer is kept on the lowest level whose slot
+     * contains the expiry and lies in the same block of the next level as the current time, so
+     * inserting and cancelling are O(1). Timers move down one or more levels when their slot is reached.
+     */
+    typedef struct
+    {
+        WE_SoftTimer_t *slots[WE_TIMERWHEEL_LEVELS][WE_TIMERWHEEL_SLOTS];
+        uint32_t occupied[WE_TIMERWHEEL_LEVELS];
+        WE_SoftTimer_t *overflow;
+        WE_SoftTimer_t *expired;
+        uint64_t now;
+        uint32_t active;
+    } WE_TimerWheel_t;
+
+    /**
+     * @brief Initialize a timer wheel.
+     *
+     * @param[out] wheel Timer wheel
+     * @param[in] now Current time in ticks
+     */
+    extern void WE_TimerWheel_Init(WE_TimerWheel_t *wheel, uint64_t now);
+
+    /**
+     * @brief Start (or restart) a software timer.
+     *
+     * @param[in] wheel Timer wheel
+     * @param[in] timer Timer to start
+     * @param[in] expiry Absolute expiry time in ticks, a time in the past expires with the next call of WE_TimerWheel_Advance()
+     * @param[in] period Period in ticks for periodic timers, 0 for one-shot timers
+     * @param[in] callback Function called on expiry
+     * @param[in] context Passed to the callback
+     */
+    extern void WE_TimerWheel_Start(WE_TimerWheel_t *wheel, WE_SoftTimer_t *timer, uint64_t expiry, uint32_t period, WE_SoftTimer_Callback_t callback, void *context);
+
+    /**
+     * @brief Cancel a software timer.
+     *
+     * @param[in] wheel Timer wheel
+     * @param[in] timer Timer to cancel
+     * @return true if the timer was running, false otherwise
+     */
+    extern bool WE_TimerWheel_Cancel(WE_TimerWheel_t *wheel, WE_SoftTimer_t *timer);
+
+    /**
+     * @brief Check whether a software timer is running.
+     *
+     * @param[in] timer Timer
+     * @return true if the timer is running, false otherwise
+     */
+    extern bool WE_TimerWheel_IsActive(const WE_SoftTimer_t *timer);
+
+    /**
+     * @brief Advance the wheel to the given time and call the callbacks of all expired timers.
+     *
+     * Callbacks may start and cancel timers (including their own). Periodic timers are restarted
+     * before their callback is called, missed periods are skipped.
+     *
+     * @param[in] wheel Timer wheel
+     * @param[in] now Current time in ticks
+     * @return Number of callbacks called
+     */
+    extern uint32_t WE_TimerWheel_Advance(WE_TimerWheel_t *wheel, uint64_t now);
+
+    /**
+     * @brief Time of the next event of the wheel.
+     *
+     * This is the next expiry or the time at which timers of a higher level have to be moved down,
+     * the hardware timer has to call WE_TimerWheel_Advance() at this time.
+     *
+     * @param[in] wheel Timer wheel
+     * @return Time of the next event in ticks, UINT64_MAX if no timer is running
+     */
+    extern uint64_t WE_TimerWheel_NextEvent(const WE_TimerWheel_t *wheel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMER_WHEEL_H_INCLUDED */
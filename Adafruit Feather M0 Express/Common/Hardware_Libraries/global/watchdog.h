@@ -0,0 +1,84 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Hardware watchdog.
+ *
+ * Resets the MCU unless WE_Watchdog_Feed() is called within the timeout. On the M0Express the
+ * WDT is clocked from the ultra low power 32 kHz oscillator through generic clock generator 2
+ * and keeps running in standby, so a firmware that hangs asleep is reset as well.
+ */
+
+#ifndef WATCHDOG_H_INCLUDED
+#define WATCHDOG_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Longest timeout (16384 cycles of the 1024 Hz watchdog clock) */
+#define WE_WATCHDOG_MAX_TIMEOUT_MS 16000
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Start the watchdog or change its timeout.
+     *
+     * The hardware supports timeouts of 8 to 16384 cycles in powers of two, the timeout is rounded
+     * up to the next one (e.g. 100 ms become 125 ms).
+     *
+     * @param[in] timeoutMs Timeout in milliseconds (max. WE_WATCHDOG_MAX_TIMEOUT_MS)
+     * @return true if request succeeded, false otherwise
+     */
+    extern bool WE_Watchdog_Start(uint32_t timeoutMs);
+
+    /**
+     * @brief Stop the watchdog.
+     */
+    extern void WE_Watchdog_Stop(void);
+
+    /**
+     * @brief Restart the timeout, may be called from interrupts.
+     *
+     * Returns right away while the previous feed is still being synchronized to the watchdog
+     * clock (up to a few milliseconds), the timeout is restarted by that one.
+     */
+    extern void WE_Watchdog_Feed(void);
+
+    /**
+     * @brief Check whether the last reset was caused by the watchdog.
+     *
+     * @return true if the watchdog reset the MCU, false otherwise
+     */
+    extern bool WE_Watchdog_CausedReset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WATCHDOG_H_INCLUDED */
@@ -0,0 +1,108 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Watchdog on the host (BASE_PLATFORM).
+ *
+ * A software timer restarted by every feed. When it expires the firmware is restarted like by
+ * NVIC_SystemReset(), WE_Watchdog_CausedReset() reports it after the restart. The timer only
+ * runs while the firmware waits for the clock, so it catches a loop that stops feeding while
+ * it keeps waiting (e.g. for input), not a busy loop.
+ */
+
+#include "watchdog.h"
+
+#ifdef BASE_PLATFORM
+
+#include <stdlib.h>
+#include "ConfigPlatform.h"
+#include "debug.h"
+#include "soft_timer.h"
+
+/* Passed to the restarted process */
+#define WE_WATCHDOG_RESET_VARIABLE "WE_WATCHDOG_RESET"
+
+static WE_SoftTimer_t watchdogTimer;
+static uint32_t watchdogTimeoutUs = 0;
+
+static void WE_Watchdog_Expired(WE_SoftTimer_t *timer, void *context);
+
+bool WE_Watchdog_Start(uint32_t timeoutMs)
+{
+    if (timeoutMs > WE_WATCHDOG_MAX_TIMEOUT_MS)
+    {
+        return false;
+    }
+
+    watchdogTimeoutUs = timeoutMs * 1000;
+    WE_Watchdog_Feed();
+    return true;
+}
+
+void WE_Watchdog_Stop(void)
+{
+    watchdogTimeoutUs = 0;
+    WE_SoftTimer_Stop(&watchdogTimer);
+}
+
+void WE_Watchdog_Feed(void)
+{
+    if (0 != watchdogTimeoutUs)
+    {
+        WE_SoftTimer_Start(&watchdogTimer, watchdogTimeoutUs, 0, WE_Watchdog_Expired, NULL);
+    }
+}
+
+bool WE_Watchdog_CausedReset(void)
+{
+    static int causedReset = -1;
+
+    /* Read once, a later restart by NVIC_SystemReset() must not report it again */
+    if (causedReset < 0)
+    {
+        causedReset = (NULL != getenv(WE_WATCHDOG_RESET_VARIABLE)) ? 1 : 0;
+        unsetenv(WE_WATCHDOG_RESET_VARIABLE);
+    }
+    return 1 == causedReset;
+}
+
+/**
+ * @brief Restart the firmware, called by the software timer.
+ */
+static void WE_Watchdog_Expired(WE_SoftTimer_t *timer, void *context)
+{
+    (void)timer;
+    (void)context;
+
+#if defined(WE_DEBUG)
+    WE_DEBUG_PRINT("Watchdog expired, restarting.\r\n");
+    WE_Debug_Flush();
+#endif
+    setenv(WE_WATCHDOG_RESET_VARIABLE, "1", 1);
+    NVIC_SystemReset();
+}
+
+#endif /* BASE_PLATFORM */
@@ -0,0 +1,112 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Hardware watchdog (M0Express).
+ */
+
+#include "watchdog.h"
+
+#ifdef M0Express
+
+#include <Arduino.h>
+
+/* Generic clock generator of the watchdog, 0, 1 and 3 are used by the Arduino core */
+#define WE_WATCHDOG_GCLK 2
+
+/* OSCULP32K divided by 2^(4 + 1) */
+#define WE_WATCHDOG_CLOCK_HZ 1024
+#define WE_WATCHDOG_CLOCK_DIV 4
+
+/* Shortest timeout in watchdog clock cycles, PER doubles it per step up to 0xB */
+#define WE_WATCHDOG_MIN_CYCLES 8
+#define WE_WATCHDOG_MAX_PER 0xB
+
+static void WE_Watchdog_Sync(void);
+
+bool WE_Watchdog_Start(uint32_t timeoutMs)
+{
+    if (timeoutMs > WE_WATCHDOG_MAX_TIMEOUT_MS)
+    {
+        return false;
+    }
+
+    uint32_t cycles = (timeoutMs * WE_WATCHDOG_CLOCK_HZ + 999) / 1000;
+    uint8_t per = 0;
+    while ((per < WE_WATCHDOG_MAX_PER) && (((uint32_t)WE_WATCHDOG_MIN_CYCLES << per) < cycles))
+    {
+        per++;
+    }
+
+    GCLK->GENDIV.reg = GCLK_GENDIV_ID(WE_WATCHDOG_GCLK) | GCLK_GENDIV_DIV(WE_WATCHDOG_CLOCK_DIV);
+    GCLK->GENCTRL.reg = GCLK_GENCTRL_ID(WE_WATCHDOG_GCLK) | GCLK_GENCTRL_GENEN | GCLK_GENCTRL_SRC_OSCULP32K |
+                        GCLK_GENCTRL_DIVSEL | GCLK_GENCTRL_RUNSTDBY;
+    while (GCLK->STATUS.bit.SYNCBUSY)
+    {
+    }
+    GCLK->CLKCTRL.reg = (uint16_t)(GCLK_CLKCTRL_ID_WDT | GCLK_CLKCTRL_CLKEN | GCLK_CLKCTRL_GEN(WE_WATCHDOG_GCLK));
+
+    /* The period can only be changed while the watchdog is disabled */
+    WDT->CTRL.reg = 0;
+    WE_Watchdog_Sync();
+    WDT->CONFIG.reg = WDT_CONFIG_PER(per);
+    WDT->INTENCLR.reg = WDT_INTENCLR_EW;
+    WDT->CTRL.reg = WDT_CTRL_ENABLE;
+    WE_Watchdog_Sync();
+
+    return true;
+}
+
+void WE_Watchdog_Stop(void)
+{
+    WDT->CTRL.reg = 0;
+    WE_Watchdog_Sync();
+}
+
+void WE_Watchdog_Feed(void)
+{
+    if (!WDT->STATUS.bit.SYNCBUSY)
+    {
+        WDT->CLEAR.reg = WDT_CLEAR_CLEAR_KEY;
+    }
+}
+
+bool WE_Watchdog_CausedReset(void)
+{
+    return 0 != (PM->RCAUSE.reg & PM_RCAUSE_WDT);
+}
+
+/**
+ * @brief Wait until a write to the watchdog is synchronized to its clock.
+ */
+static void WE_Watchdog_Sync(void)
+{
+    while (WDT->STATUS.bit.SYNCBUSY)
+    {
+    }
+}
+
+#endif /* M0Express */
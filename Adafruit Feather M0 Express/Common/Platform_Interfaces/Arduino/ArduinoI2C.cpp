@@ -0,0 +1,320 @@
+/**
+ * \file
+ * \brief Interrupt driven I2C master for Adafruit M0 feather.
+ *
+ * This code is abstraction of arduino peripheral drivers for Adafruit feather
+ * MO board.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+#include <Arduino.h>
+#include <wiring_private.h>
+#include "ArduinoPlatform.h"
+#include "ArduinoI2C.h"
+#include "event_trace.h"
+#include "profile.h"
+
+#define I2CASYNC_SERCOM SERCOM3
+#define I2CASYNC_SERCOM_CLASS sercom3
+#define I2CASYNC_IRQn SERCOM3_IRQn
+
+#define CMD_ACK_READ 2
+#define CMD_STOP 3
+
+static I2CAsync_Transaction *queueHead = NULL;
+static I2CAsync_Transaction *queueTail = NULL;
+static uint16_t txIndex = 0;
+static uint16_t rxIndex = 0;
+static uint32_t busClock = 0;
+
+/* private function definition */
+static void I2CAsync_setup(uint32_t clock);
+static void I2CAsync_start(I2CAsync_Transaction *transaction);
+static void I2CAsync_finish(int8_t status);
+static void I2CAsync_command(uint8_t command, bool nack);
+static void I2CAsync_writeAddress(uint32_t address);
+
+void SERCOM3_Handler()
+{
+  SercomI2cm *i2c = &I2CASYNC_SERCOM->I2CM;
+  I2CAsync_Transaction *transaction = queueHead;
+  uint8_t flags = i2c->INTFLAG.reg;
+  uint16_t status = i2c->STATUS.reg;
+  WE_PROFILE_BEGIN(WE_PROFILE_ZONE_I2C_ISR);
+  WE_EVENT_BEGIN(WE_EVENT_ID_I2C_ISR);
+
+  if (transaction == NULL)
+  {
+    i2c->INTFLAG.reg = flags;
+    WE_EVENT_END(WE_EVENT_ID_I2C_ISR);
+    WE_PROFILE_END(WE_PROFILE_ZONE_I2C_ISR);
+    return;
+  }
+
+  if (flags & SERCOM_I2CM_INTFLAG_ERROR)
+  {
+    /* Bus error, arbitration lost or SCL low timeout */
+    i2c->INTFLAG.reg = SERCOM_I2CM_INTFLAG_ERROR | SERCOM_I2CM_INTFLAG_MB | SERCOM_I2CM_INTFLAG_SB;
+    i2c->STATUS.reg = SERCOM_I2CM_STATUS_BUSERR | SERCOM_I2CM_STATUS_ARBLOST | SERCOM_I2CM_STATUS_LOWTOUT;
+    I2CAsync_finish(WE_FAIL);
+  }
+  else if (flags & SERCOM_I2CM_INTFLAG_MB)
+  {
+    if (status & (SERCOM_I2CM_STATUS_BUSERR | SERCOM_I2CM_STATUS_ARBLOST))
+    {
+      i2c->INTFLAG.reg = SERCOM_I2CM_INTFLAG_MB;
+      I2CAsync_finish(WE_FAIL);
+    }
+    else if (status & SERCOM_I2CM_STATUS_RXNACK)
+    {
+      /* Address or data byte not acknowledged */
+      I2CAsync_command(CMD_STOP, false);
+      I2CAsync_finish(WE_FAIL);
+    }
+    else if (txIndex < transaction->txPrefixLength)
+    {
+      i2c->DATA.reg = transaction->txPrefix[txIndex++];
+    }
+    else if (txIndex < transaction->txPrefixLength + transaction->txLength)
+    {
+      i2c->DATA.reg = transaction->txData[txIndex++ - transaction->txPrefixLength];
+    }
+    else if (transaction->rxLength > 0)
+    {
+      /* Repeated start for the read phase */
+      I2CAsync_writeAddress(((uint32_t)transaction->address << 1) | 1);
+    }
+    else
+    {
+      I2CAsync_command(CMD_STOP, false);
+      I2CAsync_finish(WE_SUCCESS);
+    }
+  }
+  else if (flags & SERCOM_I2CM_INTFLAG_SB)
+  {
+    transaction->rxData[rxIndex++] = i2c->DATA.reg;
+    if (rxIndex < transaction->rxLength)
+    {
+      I2CAsync_command(CMD_ACK_READ, false);
+    }
+    else
+    {
+      /* NACK the last byte and release the bus */
+      I2CAsync_command(CMD_STOP, true);
+      I2CAsync_finish(WE_SUCCESS);
+    }
+  }
+  WE_EVENT_END(WE_EVENT_ID_I2C_ISR);
+  WE_PROFILE_END(WE_PROFILE_ZONE_I2C_ISR);
+}
+
+bool I2CAsync_init(uint32_t clock)
+{
+  I2CAsync_reset();
+  I2CAsync_setup(clock);
+  return true;
+}
+
+bool I2CAsync_setClock(uint32_t clock)
+{
+  if (busClock == 0)
+  {
+    return false;
+  }
+  while (!I2CAsync_isIdle())
+  {
+  }
+  I2CAsync_setup(clock);
+  return true;
+}
+
+bool I2CAsync_submit(I2CAsync_Transaction *transaction)
+{
+  if ((busClock == 0) || (transaction == NULL) ||
+      ((transaction->txPrefixLength > 0) && (transaction->txPrefix == NULL)) ||
+      ((transaction->txLength > 0) && (transaction->txData == NULL)) ||
+      ((transaction->rxLength > 0) && (transaction->rxData == NULL)))
+  {
+    return false;
+  }
+
+  transaction->status = I2CASYNC_PENDING;
+  transaction->next = NULL;
+
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  if (queueTail == NULL)
+  {
+    queueHead = transaction;
+    queueTail = transaction;
+    I2CAsync_start(transaction);
+  }
+  else
+  {
+    queueTail->next = transaction;
+    queueTail = transaction;
+  }
+  __set_PRIMASK(primask);
+
+  return true;
+}
+
+bool I2CAsync_isIdle(void) { return queueHead == NULL; }
+
+int8_t I2CAsync_wait(I2CAsync_Transaction *transaction, uint32_t timeout_ms)
+{
+  unsigned long start = millis();
+  while (transaction->status == I2CASYNC_PENDING)
+  {
+    if (millis() - start > timeout_ms)
+    {
+      I2CAsync_reset();
+      break;
+    }
+  }
+  return transaction->status;
+}
+
+void I2CAsync_reset(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  I2CAsync_Transaction *pending = queueHead;
+  queueHead = NULL;
+  queueTail = NULL;
+  __set_PRIMASK(primask);
+
+  if (busClock != 0)
+  {
+    I2CAsync_setup(busClock);
+  }
+
+  while (pending != NULL)
+  {
+    I2CAsync_Transaction *next = pending->next;
+    pending->status = WE_FAIL;
+    if (pending->callback != NULL)
+    {
+      pending->callback(pending);
+    }
+    pending = next;
+  }
+}
+
+/**
+ * @brief  Configure SERCOM3 as interrupt driven I2C master
+ * @param  clock Bus clock in Hz
+ * @retval None
+ */
+static void I2CAsync_setup(uint32_t clock)
+{
+  NVIC_DisableIRQ(I2CASYNC_IRQn);
+
+  I2CASYNC_SERCOM_CLASS.resetWIRE();
+  I2CASYNC_SERCOM_CLASS.initMasterWIRE(clock);
+  /* Report a bus held low by a slave as error instead of hanging. The SCL low time-out
+   * (25-35 ms) is counted on the SERCOM slow clock, which is shared by all SERCOMs and
+   * taken from the 32 kHz generator GCLK1 that the Arduino core keeps running. */
+  GCLK->CLKCTRL.reg = (uint16_t)(GCLK_CLKCTRL_CLKEN | GCLK_CLKCTRL_GEN_GCLK1 | GCLK_CLKCTRL_ID_SERCOMX_SLOW);
+  while (GCLK->STATUS.bit.SYNCBUSY)
+  {
+  }
+  I2CASYNC_SERCOM->I2CM.CTRLA.reg |= SERCOM_I2CM_CTRLA_LOWTOUTEN;
+  I2CASYNC_SERCOM_CLASS.enableWIRE();
+
+  pinPeripheral(PIN_WIRE_SDA, g_APinDescription[PIN_WIRE_SDA].ulPinType);
+  pinPeripheral(PIN_WIRE_SCL, g_APinDescription[PIN_WIRE_SCL].ulPinType);
+
+  I2CASYNC_SERCOM->I2CM.INTENSET.reg = SERCOM_I2CM_INTENSET_MB | SERCOM_I2CM_INTENSET_SB | SERCOM_I2CM_INTENSET_ERROR;
+  NVIC_ClearPendingIRQ(I2CASYNC_IRQn);
+  NVIC_SetPriority(I2CASYNC_IRQn, SERCOM_NVIC_PRIORITY);
+  NVIC_EnableIRQ(I2CASYNC_IRQn);
+
+  busClock = clock;
+}
+
+/**
+ * @brief  Start a transaction by sending the address (interrupts disabled)
+ * @param  transaction Transaction at the head of the queue
+ * @retval None
+ */
+static void I2CAsync_start(I2CAsync_Transaction *transaction)
+{
+  txIndex = 0;
+  rxIndex = 0;
+
+  bool read = (transaction->txPrefixLength == 0) && (transaction->txLength == 0) && (transaction->rxLength > 0);
+  I2CAsync_writeAddress(((uint32_t)transaction->address << 1) | (read ? 1 : 0));
+}
+
+/**
+ * @brief  Complete the transaction at the head of the queue and start the next one
+ * @param  status WE_SUCCESS or WE_FAIL
+ * @retval None
+ */
+static void I2CAsync_finish(int8_t status)
+{
+  I2CAsync_Transaction *transaction = queueHead;
+
+  queueHead = transaction->next;
+  if (queueHead == NULL)
+  {
+    queueTail = NULL;
+  }
+  else
+  {
+    I2CAsync_start(queueHead);
+  }
+
+  transaction->status = status;
+  if (transaction->callback != NULL)
+  {
+    transaction->callback(transaction);
+  }
+}
+
+/**
+ * @brief  Issue a bus command
+ * @param  command CMD_ACK_READ or CMD_STOP
+ * @param  nack Send NACK instead of ACK for the last received byte
+ * @retval None
+ */
+static void I2CAsync_command(uint8_t command, bool nack)
+{
+  I2CASYNC_SERCOM->I2CM.CTRLB.reg = SERCOM_I2CM_CTRLB_CMD(command) | (nack ? SERCOM_I2CM_CTRLB_ACKACT : 0);
+  while (I2CASYNC_SERCOM->I2CM.SYNCBUSY.bit.SYSOP)
+  {
+  }
+}
+
+/**
+ * @brief  Send a (repeated) start condition and the address byte
+ * @param  address Address byte including the read bit
+ * @retval None
+ */
+static void I2CAsync_writeAddress(uint32_t address)
+{
+  I2CASYNC_SERCOM->I2CM.ADDR.reg = SERCOM_I2CM_ADDR_ADDR(address);
+  while (I2CASYNC_SERCOM->I2CM.SYNCBUSY.bit.SYSOP)
+  {
+  }
+}
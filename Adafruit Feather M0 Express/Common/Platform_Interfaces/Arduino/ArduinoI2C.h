@@ -0,0 +1,88 @@
+/**
+ * \file
+ * \brief Interrupt driven I2C master for Adafruit M0 feather.
+ *
+ * This code is abstraction of arduino peripheral drivers for Adafruit feather
+ * MO board.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+
+#ifndef ARDUINOI2C_H
+#define ARDUINOI2C_H
+
+/**         Includes         */
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+/* Runs on the Wire pins (SERCOM3, PA22 SDA, PA23 SCL) and owns SERCOM3_Handler,
+ * so it can not be used together with the Arduino Wire library. */
+#define I2CASYNC_PENDING 1
+
+#ifndef WE_SUCCESS
+#define WE_SUCCESS 0
+#define WE_FAIL -1
+#endif
+
+  struct I2CAsync_Transaction;
+  typedef void (*I2CAsync_Callback)(struct I2CAsync_Transaction *transaction);
+
+  /* A write (rxLength 0), read (txLength 0) or write followed by a repeated start and a read.
+   * The transaction and its buffers are owned by the caller and must stay valid until it is done. */
+  typedef struct I2CAsync_Transaction
+  {
+    uint8_t address; /* 7 bit address */
+    /* Sent in front of txData, e.g. a register address, so the payload needs no copy */
+    const uint8_t *txPrefix;
+    uint8_t txPrefixLength;
+    const uint8_t *txData;
+    uint16_t txLength;
+    uint8_t *rxData;
+    uint16_t rxLength;
+    I2CAsync_Callback callback; /* Called from interrupt context when done, may be NULL */
+    void *context;
+    /* I2CASYNC_PENDING while queued, then WE_SUCCESS or WE_FAIL */
+    volatile int8_t status;
+    struct I2CAsync_Transaction *next;
+  } I2CAsync_Transaction;
+
+  bool I2CAsync_init(uint32_t clock);
+  /* Waits for the queue to drain before the clock is changed. */
+  bool I2CAsync_setClock(uint32_t clock);
+
+  /* Appends a transaction to the queue and returns immediately. */
+  bool I2CAsync_submit(I2CAsync_Transaction *transaction);
+  bool I2CAsync_isIdle(void);
+  /* Waits for a submitted transaction. On timeout the bus is reset and all queued transactions fail. */
+  int8_t I2CAsync_wait(I2CAsync_Transaction *transaction, uint32_t timeout_ms);
+  /* Fails all queued transactions and reinitializes the bus. */
+  void I2CAsync_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARDUINOI2C_H */
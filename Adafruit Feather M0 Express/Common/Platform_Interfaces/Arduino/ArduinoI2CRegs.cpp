@@ -0,0 +1,151 @@
+/**
+ * \file
+ * \brief Register access on top of the I2C transaction engine.
+ *
+ * This code is abstraction of arduino peripheral drivers for Adafruit feather
+ * MO board.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+#include <stddef.h>
+#include "ArduinoI2CRegs.h"
+
+#define I2CREGS_TIMEOUT_MS 1000
+
+/* private function definition */
+static int8_t I2CRegs_waitAll(I2CAsync_Transaction *transactions, uint8_t count);
+
+int8_t I2CRegs_read(uint8_t address, uint8_t reg, uint8_t *data, uint16_t length)
+{
+  I2CAsync_Transaction transaction = {};
+  transaction.address = address;
+  transaction.txPrefix = &reg;
+  transaction.txPrefixLength = 1;
+  transaction.rxData = data;
+  transaction.rxLength = length;
+
+  if ((length == 0) || !I2CAsync_submit(&transaction))
+  {
+    return WE_FAIL;
+  }
+  return I2CAsync_wait(&transaction, I2CREGS_TIMEOUT_MS);
+}
+
+int8_t I2CRegs_write(uint8_t address, uint8_t reg, const uint8_t *data, uint16_t length)
+{
+  I2CAsync_Transaction transaction = {};
+  transaction.address = address;
+  transaction.txPrefix = &reg;
+  transaction.txPrefixLength = 1;
+  transaction.txData = data;
+  transaction.txLength = length;
+
+  if (!I2CAsync_submit(&transaction))
+  {
+    return WE_FAIL;
+  }
+  return I2CAsync_wait(&transaction, I2CREGS_TIMEOUT_MS);
+}
+
+int8_t I2CRegs_writeList(uint8_t address, const I2CRegs_Value *list, uint16_t count)
+{
+  I2CAsync_Transaction transactions[I2CREGS_MAX_BATCH] = {};
+  uint8_t regs[I2CREGS_MAX_BATCH];
+  uint8_t values[I2CREGS_BUFFER_SIZE];
+  uint8_t queued = 0;
+  uint16_t used = 0;
+  int8_t result = WE_SUCCESS;
+
+  for (uint16_t i = 0; i < count;)
+  {
+    /* Longest run of consecutive registers that fits into the value buffer */
+    uint16_t run = 1;
+    while ((i + run < count) && (run < I2CREGS_BUFFER_SIZE) &&
+           (list[i + run].reg == (uint8_t)(list[i].reg + run)))
+    {
+      run++;
+    }
+
+    if ((queued == I2CREGS_MAX_BATCH) || (used + run > I2CREGS_BUFFER_SIZE))
+    {
+      /* Buffers are full, wait for the queued bursts before reusing them */
+      if (I2CRegs_waitAll(transactions, queued) != WE_SUCCESS)
+      {
+        result = WE_FAIL;
+      }
+      queued = 0;
+      used = 0;
+      continue;
+    }
+
+    I2CAsync_Transaction *transaction = &transactions[queued];
+    regs[queued] = list[i].reg;
+    for (uint16_t j = 0; j < run; j++)
+    {
+      values[used + j] = list[i + j].value;
+    }
+
+    transaction->address = address;
+    transaction->txPrefix = &regs[queued];
+    transaction->txPrefixLength = 1;
+    transaction->txData = &values[used];
+    transaction->txLength = run;
+    transaction->rxData = NULL;
+    transaction->rxLength = 0;
+    transaction->callback = NULL;
+
+    if (!I2CAsync_submit(transaction))
+    {
+      result = WE_FAIL;
+      break;
+    }
+
+    queued++;
+    used += run;
+    i += run;
+  }
+
+  if (I2CRegs_waitAll(transactions, queued) != WE_SUCCESS)
+  {
+    result = WE_FAIL;
+  }
+  return result;
+}
+
+/**
+ * @brief  Wait for queued transactions
+ * @param  transactions Transactions in submission order
+ * @param  count Number of transactions
+ * @retval WE_SUCCESS if all transactions succeeded, WE_FAIL otherwise
+ */
+static int8_t I2CRegs_waitAll(I2CAsync_Transaction *transactions, uint8_t count)
+{
+  int8_t result = WE_SUCCESS;
+  for (uint8_t i = 0; i < count; i++)
+  {
+    if (I2CAsync_wait(&transactions[i], I2CREGS_TIMEOUT_MS) != WE_SUCCESS)
+    {
+      result = WE_FAIL;
+    }
+  }
+  return result;
+}
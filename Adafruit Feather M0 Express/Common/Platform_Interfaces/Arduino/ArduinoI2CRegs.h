@@ -0,0 +1,68 @@
+/**
+ * \file
+ * \brief Register access on top of the I2C transaction engine.
+ *
+ * This code is abstraction of arduino peripheral drivers for Adafruit feather
+ * MO board.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+
+#ifndef ARDUINOI2CREGS_H
+#define ARDUINOI2CREGS_H
+
+/**         Includes         */
+#include <stdint.h>
+#include "ArduinoI2C.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+/* Transactions of a register list that are queued at once */
+#ifndef I2CREGS_MAX_BATCH
+#define I2CREGS_MAX_BATCH 8
+#endif
+/* Register values of a register list that are queued at once */
+#ifndef I2CREGS_BUFFER_SIZE
+#define I2CREGS_BUFFER_SIZE 64
+#endif
+
+  typedef struct
+  {
+    uint8_t reg;
+    uint8_t value;
+  } I2CRegs_Value;
+
+  /* Reads length bytes starting at reg (write then read with repeated start). */
+  int8_t I2CRegs_read(uint8_t address, uint8_t reg, uint8_t *data, uint16_t length);
+  /* Writes length bytes starting at reg in one transaction (device auto increments the register address). */
+  int8_t I2CRegs_write(uint8_t address, uint8_t reg, const uint8_t *data, uint16_t length);
+  /* Writes a register table. Entries with consecutive register addresses are merged into one burst
+   * and the bursts are queued back to back. Returns WE_FAIL if any of the writes failed. */
+  int8_t I2CRegs_writeList(uint8_t address, const I2CRegs_Value *list, uint16_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARDUINOI2CREGS_H */
@@ -29,23 +29,20 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <stdarg.h> // for printf
-#include <Adafruit_NeoPixel.h>
-#include <Wire.h>
 #include "ArduinoPlatform.h"
-#include <EasyButton.h>
+#include "ArduinoI2C.h"
+#include "ArduinoI2CRegs.h"
+#include "ArduinoStatusLED.h"
+#include "event_trace.h"
+#include "profile.h"
 
 #define TIMEOUT 1000
-// When setting up the NeoPixel library, we tell it how many pixels,
-// and which pin to use to send signals. Note that for older NeoPixel
-// strips you might need to change the third parameter -- see the
-// strandtest example for more information on possible values.
-Adafruit_NeoPixel pixels(1 /* LED_COUNT - 1 in case of feather m0 */,
-                         8 /* LED_PIN = 8 in case of feather M0 express */,
-                         NEO_GRB + NEO_KHZ800);
-
-uint32_t NeoPixelColor;
 int deviceAddress = 0; // device Address
 
+static PlatformPool<TypeSerial, PLATFORM_SSERIAL_COUNT> sserialPool;
+static PlatformPool<TypeHardwareSerial, PLATFORM_HSERIAL_COUNT> hserialPool;
+static TypePlatformMemory platformMemory;
+
 /**
  * @brief  Software reset for the MCU
  * @retval none
@@ -56,22 +53,25 @@ void soft_reset()
 }
 
 /**
- * @brief  Create a serial port object for handling strings and allocate memory
+ * @brief  Create a serial port object for handling strings
  * @param  ser Pointer to serial object
- * @retval Created serial port
+ * @retval Created serial port, NULL if all PLATFORM_SSERIAL_COUNT handles are in use
  */
 TypeSerial *SSerial_create(void *ser)
 {
   TypeSerial *m;
 
-  m = (typeof(m))malloc(sizeof(*m));
-  m->obj = ser;
+  m = sserialPool.create();
+  if (m != NULL)
+  {
+    m->obj = ser;
+  }
 
   return m;
 }
 
 /**
- * @brief  Free memory allocated to serial port
+ * @brief  Release a serial port object
  * @param  m Pointer to serial object
  * @retval none
  */
@@ -79,14 +79,9 @@ void SSerial_destroy(TypeSerial *m)
 {
   /* We do not create any instance of Serial_ with new, so we don't need to
    * delete. In addition Serial_ has no callable destructor
-   * Only needs to clean up pointer m.*/
-
-  if (m == NULL)
-  {
-    return;
-  }
+   * Only the handle m is released.*/
 
-  free(m);
+  sserialPool.destroy(m);
 }
 
 /**
@@ -183,6 +178,22 @@ int SSerial_available(TypeSerial *m)
   return obj->available();
 }
 
+/**
+ * @brief  Serial check availability for write
+ * @param  m Pointer to serial object
+ * @retval Number of bytes available
+ */
+int SSerial_availableForWrite(TypeSerial *m)
+{
+  Serial_ *obj;
+
+  if (m == NULL)
+    return 0;
+
+  obj = static_cast<Serial_ *>(m->obj);
+  return obj->availableForWrite();
+}
+
 /**
  * @brief  Serial flush
  * @param  m Pointer to serial object
@@ -261,22 +272,25 @@ int SSerial_read(TypeSerial *m)
 }
 
 /**
- * @brief  Create a serial port object for handling bytes and allocate memory
+ * @brief  Create a serial port object for handling bytes
  * @param  ser Pointer to serial object
- * @retval Created serial port
+ * @retval Created serial port, NULL if all PLATFORM_HSERIAL_COUNT handles are in use
  */
 TypeHardwareSerial *HSerial_create(void *ser)
 {
   TypeHardwareSerial *m;
 
-  m = (typeof(m))malloc(sizeof(*m));
-  m->obj = ser;
+  m = hserialPool.create();
+  if (m != NULL)
+  {
+    m->obj = ser;
+  }
 
   return m;
 }
 
 /**
- * @brief  Free memory allocated to serial port
+ * @brief  Release a serial port object
  * @param  m Pointer to serial object
  * @retval none
  */
@@ -284,14 +298,9 @@ void HSerial_destroy(TypeHardwareSerial *m)
 {
   /* We do not create any instance of HardwareSerial with new, so we don't
    * need to delete. In addition HardwareSerial has no callable destructor
-   * Only needs to clean up pointer m.*/
+   * Only the handle m is released.*/
 
-  if (m == NULL)
-  {
-    return;
-  }
-
-  free(m);
+  hserialPool.destroy(m);
 }
 
 /**
@@ -457,6 +466,35 @@ int HSerial_read(TypeHardwareSerial *m)
   return obj->read();
 }
 
+/**
+ * @brief  Run a single transaction on the I2C engine and wait for it
+ * @param  txData : data to send
+ *         txLength : number of bytes to send
+ *         rxData : buffer for received data
+ *         rxLength : number of bytes to receive
+ * @retval Error Code
+ */
+static int8_t I2CTransfer(const uint8_t *txData, int txLength, uint8_t *rxData, int rxLength)
+{
+  I2CAsync_Transaction transaction = {};
+  transaction.address = (uint8_t)deviceAddress;
+  transaction.txData = txData;
+  transaction.txLength = (uint16_t)txLength;
+  transaction.rxData = rxData;
+  transaction.rxLength = (uint16_t)rxLength;
+
+  WE_PROFILE_BEGIN(WE_PROFILE_ZONE_I2C_TRANSFER);
+  if (!I2CAsync_submit(&transaction))
+  {
+    return WE_FAIL;
+  }
+  WE_EVENT_BEGIN(WE_EVENT_ID_I2C_TRANSFER);
+  int8_t status = I2CAsync_wait(&transaction, TIMEOUT);
+  WE_EVENT_END(WE_EVENT_ID_I2C_TRANSFER);
+  WE_PROFILE_END(WE_PROFILE_ZONE_I2C_TRANSFER);
+  return status;
+}
+
 /**
  * @brief  Initialize the I2C Interface
  * @param  I2C address
@@ -464,8 +502,10 @@ int HSerial_read(TypeHardwareSerial *m)
  */
 int8_t I2CInit()
 {
-  Wire.begin();
-  Wire.setClock(I2C_CLOCK_SPEED_FAST);
+  if (!I2CAsync_init(I2C_CLOCK_SPEED_FAST))
+  {
+    return WE_FAIL;
+  }
   return WE_SUCCESS;
 }
 
@@ -476,7 +516,7 @@ int8_t I2CInit()
  */
 void I2CSetClock(uint32_t baudrate)
 {
-  Wire.setClock(baudrate);
+  I2CAsync_setClock(baudrate);
 }
 /**
  * @brief  Set I2C bus Address
@@ -496,17 +536,7 @@ void I2CSetAddress(int address)
  */
 int8_t I2CSend(uint8_t *data, int datalen)
 {
-  Wire.beginTransmission(deviceAddress);
-
-  if (datalen != 0)
-  {
-    Wire.write(data, datalen);
-  }
-  if (Wire.endTransmission() != 0)
-  {
-    return WE_FAIL;
-  }
-  return WE_SUCCESS;
+  return I2CTransfer(data, datalen, NULL, 0);
 }
 /**
  * @brief  Receive data over I2C bus
@@ -516,17 +546,11 @@ int8_t I2CSend(uint8_t *data, int datalen)
  */
 int8_t I2CReceive(uint8_t *data, int datalen)
 {
-  int bytesAvailable =
-      Wire.requestFrom(deviceAddress, datalen); // request Bytes
-  if (bytesAvailable != datalen)
+  if (datalen <= 0)
   {
     return WE_FAIL;
   }
-  for (int index = 0; index < bytesAvailable; index++)
-  {
-    data[index] = Wire.read();
-  }
-  return WE_SUCCESS;
+  return I2CTransfer(NULL, 0, data, datalen);
 }
 
 /**
@@ -538,24 +562,20 @@ int8_t I2CReceive(uint8_t *data, int datalen)
  */
 int8_t ReadReg(uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
 {
-  Wire.beginTransmission(deviceAddress); // set sensor target
-  Wire.write(RegAdr);                    // set memory pointer
-  unsigned long start = millis();
-  while (Wire.endTransmission() && millis() - start <= TIMEOUT)
-    ;
-  int n = Wire.requestFrom(deviceAddress, NumByteToRead); // request Bytes
-
-  if (n != NumByteToRead)
+  if (NumByteToRead <= 0)
   {
     return WE_FAIL;
   }
 
-  for (int i = 0; i < n; i++)
+  /* Register address and data in one transaction with repeated start, retried while the device is busy */
+  unsigned long start = millis();
+  int8_t status;
+  do
   {
-    Data[i] = Wire.read();
-  }
+    status = I2CRegs_read((uint8_t)deviceAddress, RegAdr, Data, (uint16_t)NumByteToRead);
+  } while (status != WE_SUCCESS && millis() - start <= TIMEOUT);
 
-  return WE_SUCCESS;
+  return status;
 }
 
 /**
@@ -567,15 +587,27 @@ int8_t ReadReg(uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
  */
 int8_t WriteReg(int RegAdr, int NumByteToWrite, uint8_t *Data)
 {
-  Wire.beginTransmission(deviceAddress);
-  Wire.write(RegAdr);
-  Wire.write(*Data);
-  if (Wire.endTransmission())
+  if (NumByteToWrite <= 0)
   {
     return WE_FAIL;
   }
+  /* Register address followed by the whole payload in one transaction */
+  return I2CRegs_write((uint8_t)deviceAddress, (uint8_t)RegAdr, Data, (uint16_t)NumByteToWrite);
+}
 
-  return WE_SUCCESS;
+/**
+ * @brief  Write a table of register values
+ * @param  -list : register address and value pairs
+ *         -count : number of entries
+ * @retval Error Code
+ */
+int8_t WriteRegList(const I2CRegs_Value *list, int count)
+{
+  if (count <= 0)
+  {
+    return WE_SUCCESS;
+  }
+  return I2CRegs_writeList((uint8_t)deviceAddress, list, (uint16_t)count);
 }
 
 int8_t SetPinMode(uint8_t pin, uint8_t mode)
@@ -603,64 +635,82 @@ int8_t readPin(uint8_t pin, uint8_t *pinLevelP)
  */
 void neopixelInit()
 {
-  pixels.begin(); // INITIALIZE NeoPixel strip object (REQUIRED)
-  pixels.clear();
-  NeoPixelColor = (uint32_t)0;
-  pixels.show(); // Send the updated pixel colors to the hardware.
+  /* SPI and DMA instead of bit-banging, see ArduinoStatusLED.h */
+  StatusLED_init();
+  StatusLED_set(0);
 }
 
 /**
- * @brief  Set neopixel color
- * @param  -color : color to set
+ * @brief  Set neopixel color, returns without waiting for the transfer
+ * @param  -color : color to set (0x00RRGGBB)
  * @retval None
  */
 void neopixelSet(uint32_t color)
 {
-  NeoPixelColor = color;
-  pixels.setPixelColor(0, NeoPixelColor); /* led index (always 0),
-                                                    red, green, blue - green */
-  pixels.show();
+  StatusLED_set(color);
 }
 
-EasyButton *button;
-
 /**
- * @brief  ISR for button
- * @param  None
+ * @brief  Memory of the objects created through a PlatformPool
+ * @param  memory Filled with the current values
  * @retval None
  */
-void buttonISR()
+void PlatformMemory_get(TypePlatformMemory *memory)
 {
-  button->read();
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  *memory = platformMemory;
+  __set_PRIMASK(primask);
 }
 
 /**
- * @brief  Initialise button
- * @param  Pin number
- * @param  OnBtnPress callback on button press
- * @param  OnBtnLongPress callback on button long press
+ * @brief  Account a static pool, called by its constructor
+ * @param  bytes Size of the pool
  * @retval None
  */
-
-void buttonInit(uint8_t pin, void (*OnBtnPress)(), void (*OnBtnLongPress)())
+void PlatformMemory_reserve(uint32_t bytes)
 {
-  button = new EasyButton(pin);
+  platformMemory.reservedBytes += bytes;
+}
 
-  button->begin();
-  button->onPressedFor(BTN_LONG_PRESS_DURATION_MS, OnBtnLongPress);
-  button->onPressed(OnBtnPress);
-  if (button->supportsInterrupt())
+/**
+ * @brief  Account an object created by a PlatformPool
+ * @param  bytes Size of the object
+ * @param  created false if the pool was exhausted or the heap is out of memory
+ * @retval None
+ */
+void PlatformMemory_created(uint32_t bytes, bool created)
+{
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  if (!created)
+  {
+    platformMemory.failures++;
+  }
+  else
   {
-    button->enableInterrupt(buttonISR);
+    platformMemory.objects++;
+    platformMemory.usedBytes += bytes;
+    if (platformMemory.usedBytes > platformMemory.peakBytes)
+    {
+      platformMemory.peakBytes = platformMemory.usedBytes;
+    }
   }
+  __set_PRIMASK(primask);
 }
 
 /**
- * @brief  Update button - should be called in the main loop
+ * @brief  Account an object destroyed by a PlatformPool
+ * @param  bytes Size of the object
  * @retval None
  */
-void buttonUpdate()
+void PlatformMemory_destroyed(uint32_t bytes)
 {
-  button->update();
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  platformMemory.objects--;
+  platformMemory.usedBytes -= bytes;
+  __set_PRIMASK(primask);
 }
+
 /**         EOF         */
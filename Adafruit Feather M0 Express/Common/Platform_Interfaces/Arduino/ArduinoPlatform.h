@@ -32,6 +32,7 @@
 #include <stdint.h>
 #include <Arduino.h>
 #include <wiring_private.h>
+#include "ArduinoI2CRegs.h"
 
 #define WE_SUCCESS 0
 #define WE_FAIL -1
@@ -47,6 +48,14 @@
 
 #define BTN_LONG_PRESS_DURATION_MS 2000
 
+/* Number of handles SSerial_create() and HSerial_create() can hand out */
+#ifndef PLATFORM_SSERIAL_COUNT
+#define PLATFORM_SSERIAL_COUNT 2
+#endif
+#ifndef PLATFORM_HSERIAL_COUNT
+#define PLATFORM_HSERIAL_COUNT 2
+#endif
+
 /**         Functions definition         */
 
 #ifdef __cplusplus
@@ -68,6 +77,7 @@ extern "C"
     void SSerial_begin(TypeSerial *m, uint32_t baud_count);
     void SSerial_beginP(TypeSerial *m, uint32_t baud_count, uint16_t parameter);
     int SSerial_available(TypeSerial *m);
+    int SSerial_availableForWrite(TypeSerial *m);
     void SSerial_flush(TypeSerial *m);
     void SSerial_printf(TypeSerial *m, const char format[], ...);
     void SSerial_vprintf(TypeSerial *m, const char format[], va_list ap);
@@ -97,6 +107,7 @@ extern "C"
     void I2CSetClock(uint32_t baudrate);
     int8_t ReadReg(uint8_t RegAdr, int NumByteToRead, uint8_t *Data);
     int8_t WriteReg(int RegAdr, int NumByteToWrite, uint8_t *Data);
+    int8_t WriteRegList(const I2CRegs_Value *list, int count);
     int8_t SetPinMode(uint8_t pin, uint8_t mode);
     int8_t WritePin(uint8_t pin, uint8_t pinLevel);
     int8_t readPin(uint8_t pin, uint8_t *pinLevelP);
@@ -107,11 +118,89 @@ extern "C"
     void neopixelInit();
     void neopixelSet(uint32_t color);
 
-    void buttonInit(uint8_t pin, void (*OnBtnPress)(), void (*OnBtnLongPress)());
-    void buttonUpdate();
+    /* buttonInit() and buttonUpdate() are provided by the button driver (button.h) */
+
+    /* Memory of the objects created through a PlatformPool */
+    typedef struct
+    {
+        uint32_t reservedBytes; /* Static pools (WE_STATIC_ALLOCATION), the worst case */
+        uint32_t usedBytes;     /* Objects in use */
+        uint32_t peakBytes;     /* Maximum of usedBytes */
+        uint16_t objects;       /* Number of objects in use */
+        uint16_t failures;      /* Failed creations, pool exhausted or out of heap */
+    } TypePlatformMemory;
+
+    void PlatformMemory_get(TypePlatformMemory *memory);
+    void PlatformMemory_reserve(uint32_t bytes);
+    void PlatformMemory_created(uint32_t bytes, bool created);
+    void PlatformMemory_destroyed(uint32_t bytes);
 
 #ifdef __cplusplus
 }
+
+#include <new>
+
+/**
+ * @brief  Storage for up to N objects of type T created and destroyed at runtime
+ *
+ * With WE_STATIC_ALLOCATION the objects are constructed in a static pool,
+ * otherwise they are allocated on the heap. create() returns NULL once N
+ * objects exist in both modes, so a missing destroy() shows up right away.
+ */
+template <typename T, uint8_t N = 1>
+class PlatformPool
+{
+public:
+#ifdef WE_STATIC_ALLOCATION
+  PlatformPool() { PlatformMemory_reserve(sizeof(slots)); }
+#endif
+
+  template <typename... Args>
+  T *create(Args... args)
+  {
+    T *object = NULL;
+    for (uint8_t i = 0; i < N; i++)
+    {
+      if (objects[i] == NULL)
+      {
+#ifdef WE_STATIC_ALLOCATION
+        object = new (slots[i]) T(args...);
+#else
+        object = new T(args...);
+#endif
+        objects[i] = object;
+        break;
+      }
+    }
+    PlatformMemory_created(sizeof(T), object != NULL);
+    return object;
+  }
+
+  void destroy(T *object)
+  {
+    for (uint8_t i = 0; (object != NULL) && (i < N); i++)
+    {
+      if (objects[i] == object)
+      {
+#ifdef WE_STATIC_ALLOCATION
+        object->~T();
+#else
+        delete object;
+#endif
+        objects[i] = NULL;
+        PlatformMemory_destroyed(sizeof(T));
+        return;
+      }
+    }
+  }
+
+private:
+#ifdef WE_STATIC_ALLOCATION
+  alignas(T) uint8_t slots[N][sizeof(T)];
+#endif
+  T *objects[N] = {};
+};
+
 #endif
 
 #endif /* ARDUINOPLATFORM_H */
@@ -0,0 +1,299 @@
+/**
+ * \file
+ * \brief Arduino SPI flash driver for Adafruit M0 feather express.
+ *
+ * This code is abstraction of arduino peripheral drivers for Adafruit feather
+ * MO board.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+#include <Arduino.h>
+#include <SPI.h>
+#include <Adafruit_ZeroDMA.h>
+#include "ArduinoSPIFlash.h"
+
+#ifdef EXTERNAL_FLASH_USE_SPI
+#define SPIFLASH_SPI EXTERNAL_FLASH_USE_SPI
+#define SPIFLASH_CS_PIN EXTERNAL_FLASH_USE_CS
+#else
+#define SPIFLASH_SPI SPI1
+#define SPIFLASH_CS_PIN SS1
+#endif
+
+#define SPIFLASH_SERCOM SERCOM2
+#define SPIFLASH_DMAC_ID_TX SERCOM2_DMAC_ID_TX
+#define SPIFLASH_DMAC_ID_RX SERCOM2_DMAC_ID_RX
+
+#define CMD_READ 0x03
+#define CMD_PAGE_PROGRAM 0x02
+#define CMD_SECTOR_ERASE 0x20
+#define CMD_WRITE_ENABLE 0x06
+#define CMD_READ_STATUS 0x05
+#define CMD_READ_JEDEC_ID 0x9F
+#define STATUS_BUSY 0x01
+
+#define PROGRAM_TIMEOUT_MS 10
+#define ERASE_TIMEOUT_MS 500
+
+static uint32_t flashSize = 0;
+
+/* Reads clock out a constant dummy byte on TX while RX copies the data */
+static Adafruit_ZeroDMA dmaTx;
+static Adafruit_ZeroDMA dmaRx;
+static DmacDescriptor *descTx = NULL;
+static DmacDescriptor *descRx = NULL;
+static const uint8_t dummyByte = 0xFF;
+static volatile bool readBusy = false;
+
+/* private function definition */
+static void SPIFlash_select(void);
+static void SPIFlash_deselect(void);
+static void SPIFlash_sendCommand(uint8_t command, uint32_t address);
+static bool SPIFlash_waitReady(uint32_t timeout_ms);
+static void SPIFlash_readDone(Adafruit_ZeroDMA *dma);
+
+bool SPIFlash_init(void)
+{
+  uint8_t id[3];
+
+  pinMode(SPIFLASH_CS_PIN, OUTPUT);
+  digitalWrite(SPIFLASH_CS_PIN, HIGH);
+  SPIFLASH_SPI.begin();
+
+  SPIFlash_select();
+  SPIFLASH_SPI.transfer(CMD_READ_JEDEC_ID);
+  id[0] = SPIFLASH_SPI.transfer(0xFF);
+  id[1] = SPIFLASH_SPI.transfer(0xFF);
+  id[2] = SPIFLASH_SPI.transfer(0xFF);
+  SPIFlash_deselect();
+
+  /* Third ID byte is log2 of the capacity */
+  if ((id[0] == 0x00) || (id[0] == 0xFF) || (id[2] < 16) || (id[2] > 28))
+  {
+    return false;
+  }
+  flashSize = (uint32_t)1 << id[2];
+
+  dmaTx.setTrigger(SPIFLASH_DMAC_ID_TX);
+  dmaTx.setAction(DMA_TRIGGER_ACTON_BEAT);
+  dmaRx.setTrigger(SPIFLASH_DMAC_ID_RX);
+  dmaRx.setAction(DMA_TRIGGER_ACTON_BEAT);
+  if ((dmaTx.allocate() != DMA_STATUS_OK) || (dmaRx.allocate() != DMA_STATUS_OK))
+  {
+    SPIFlash_deinit();
+    return false;
+  }
+
+  descTx = dmaTx.addDescriptor((void *)&dummyByte,
+                               (void *)(&SPIFLASH_SERCOM->SPI.DATA.reg), 1,
+                               DMA_BEAT_SIZE_BYTE, false, false);
+  descRx = dmaRx.addDescriptor((void *)(&SPIFLASH_SERCOM->SPI.DATA.reg), NULL,
+                               1, DMA_BEAT_SIZE_BYTE, false, true);
+  if ((descTx == NULL) || (descRx == NULL))
+  {
+    SPIFlash_deinit();
+    return false;
+  }
+  dmaRx.setCallback(SPIFlash_readDone);
+
+  return true;
+}
+
+bool SPIFlash_deinit(void)
+{
+  dmaTx.abort();
+  dmaRx.abort();
+  dmaTx.free();
+  dmaRx.free();
+  descTx = NULL;
+  descRx = NULL;
+  readBusy = false;
+  digitalWrite(SPIFLASH_CS_PIN, HIGH);
+  SPIFLASH_SPI.end();
+  flashSize = 0;
+  return true;
+}
+
+uint32_t SPIFlash_getSize(void) { return flashSize; }
+
+bool SPIFlash_read(uint32_t address, uint8_t *data, uint32_t length)
+{
+  if (address + length > flashSize)
+  {
+    return false;
+  }
+  do
+  {
+    uint32_t chunk = (length > SPIFLASH_MAX_ASYNC_READ) ? SPIFLASH_MAX_ASYNC_READ : length;
+    if (!SPIFlash_readAsync(address, data, chunk))
+    {
+      return false;
+    }
+    while (SPIFlash_isBusy())
+    {
+    }
+    address += chunk;
+    data += chunk;
+    length -= chunk;
+  } while (length > 0);
+  return true;
+}
+
+bool SPIFlash_readAsync(uint32_t address, uint8_t *data, uint32_t length)
+{
+  if ((descRx == NULL) || readBusy || (address + length > flashSize) ||
+      (length > SPIFLASH_MAX_ASYNC_READ))
+  {
+    return false;
+  }
+  if (length == 0)
+  {
+    return true;
+  }
+
+  SPIFlash_select();
+  SPIFlash_sendCommand(CMD_READ, address);
+
+  readBusy = true;
+  dmaTx.changeDescriptor(descTx, (void *)&dummyByte, NULL, length);
+  dmaRx.changeDescriptor(descRx, NULL, data, length);
+  /* RX has to be armed before TX starts clocking */
+  dmaRx.startJob();
+  dmaTx.startJob();
+  return true;
+}
+
+bool SPIFlash_isBusy(void) { return readBusy; }
+
+bool SPIFlash_program(uint32_t address, const uint8_t *data, uint32_t length)
+{
+  if (readBusy || (address + length > flashSize) ||
+      ((address % SPIFLASH_PAGE_SIZE) + length > SPIFLASH_PAGE_SIZE))
+  {
+    return false;
+  }
+
+  SPIFlash_select();
+  SPIFLASH_SPI.transfer(CMD_WRITE_ENABLE);
+  SPIFlash_deselect();
+
+  SPIFlash_select();
+  SPIFlash_sendCommand(CMD_PAGE_PROGRAM, address);
+  for (uint32_t i = 0; i < length; i++)
+  {
+    SPIFLASH_SPI.transfer(data[i]);
+  }
+  SPIFlash_deselect();
+
+  return SPIFlash_waitReady(PROGRAM_TIMEOUT_MS);
+}
+
+bool SPIFlash_eraseSector(uint32_t address)
+{
+  if (readBusy || (address >= flashSize) ||
+      ((address % SPIFLASH_SECTOR_SIZE) != 0))
+  {
+    return false;
+  }
+
+  SPIFlash_select();
+  SPIFLASH_SPI.transfer(CMD_WRITE_ENABLE);
+  SPIFlash_deselect();
+
+  SPIFlash_select();
+  SPIFlash_sendCommand(CMD_SECTOR_ERASE, address);
+  SPIFlash_deselect();
+
+  return SPIFlash_waitReady(ERASE_TIMEOUT_MS);
+}
+
+/**
+ * @brief  Select the flash and start an SPI transaction
+ * @retval none
+ */
+static void SPIFlash_select(void)
+{
+  SPIFLASH_SPI.beginTransaction(SPISettings(SPIFLASH_CLOCK, MSBFIRST, SPI_MODE0));
+  digitalWrite(SPIFLASH_CS_PIN, LOW);
+}
+
+/**
+ * @brief  Deselect the flash and end the SPI transaction
+ * @retval none
+ */
+static void SPIFlash_deselect(void)
+{
+  digitalWrite(SPIFLASH_CS_PIN, HIGH);
+  SPIFLASH_SPI.endTransaction();
+}
+
+/**
+ * @brief  Send a command with 24 bit address
+ * @param  command Command byte
+ * @param  address Flash address
+ * @retval none
+ */
+static void SPIFlash_sendCommand(uint8_t command, uint32_t address)
+{
+  SPIFLASH_SPI.transfer(command);
+  SPIFLASH_SPI.transfer((address >> 16) & 0xFF);
+  SPIFLASH_SPI.transfer((address >> 8) & 0xFF);
+  SPIFLASH_SPI.transfer(address & 0xFF);
+}
+
+/**
+ * @brief  Poll the status register until a program or erase has finished
+ * @param  timeout_ms Timeout in ms
+ * @retval true if the flash is ready, false on timeout
+ */
+static bool SPIFlash_waitReady(uint32_t timeout_ms)
+{
+  uint32_t start = millis();
+  uint8_t status;
+
+  do
+  {
+    SPIFlash_select();
+    SPIFLASH_SPI.transfer(CMD_READ_STATUS);
+    status = SPIFLASH_SPI.transfer(0xFF);
+    SPIFlash_deselect();
+
+    if ((status & STATUS_BUSY) == 0)
+    {
+      return true;
+    }
+  } while ((millis() - start) < timeout_ms);
+
+  return false;
+}
+
+/**
+ * @brief  DMA callback, the last byte of a read has been received
+ * @param  dma DMA channel
+ * @retval none
+ */
+static void SPIFlash_readDone(Adafruit_ZeroDMA *dma)
+{
+  (void)dma;
+  SPIFlash_deselect();
+  readBusy = false;
+}
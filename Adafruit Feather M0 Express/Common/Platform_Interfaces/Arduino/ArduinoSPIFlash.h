@@ -0,0 +1,68 @@
+/**
+ * \file
+ * \brief Arduino SPI flash driver for Adafruit M0 feather express.
+ *
+ * This code is abstraction of arduino peripheral drivers for Adafruit feather
+ * MO board.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+
+#ifndef ARDUINOSPIFLASH_H
+#define ARDUINOSPIFLASH_H
+
+/**         Includes         */
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+/* 2 MB GD25Q16C on SPI1 (SERCOM2, PA08 MOSI, PA09 SCK, PA14 MISO, PA13 CS).
+ * SERCOM2 is shared with the UART on pins 0/1 (UART_RXPin0_TXPin1). */
+#define SPIFLASH_PAGE_SIZE 256
+#define SPIFLASH_SECTOR_SIZE 4096
+#define SPIFLASH_CLOCK 12000000
+/* A DMA transfer moves at most 65535 bytes (16 bit BTCNT) */
+#define SPIFLASH_MAX_ASYNC_READ 0xFFFF
+
+  bool SPIFlash_init(void);
+  bool SPIFlash_deinit(void);
+  uint32_t SPIFlash_getSize(void);
+
+  /* Blocking read of any length, split into DMA reads of up to SPIFLASH_MAX_ASYNC_READ bytes. */
+  bool SPIFlash_read(uint32_t address, uint8_t *data, uint32_t length);
+  /* Starts a DMA read of up to SPIFLASH_MAX_ASYNC_READ bytes and returns immediately,
+   * SPIFlash_isBusy() reports the end of the transfer. */
+  bool SPIFlash_readAsync(uint32_t address, uint8_t *data, uint32_t length);
+  bool SPIFlash_isBusy(void);
+
+  /* Programs up to one page, the data must not cross a page boundary. */
+  bool SPIFlash_program(uint32_t address, const uint8_t *data, uint32_t length);
+  bool SPIFlash_eraseSector(uint32_t address);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARDUINOSPIFLASH_H */
@@ -0,0 +1,194 @@
+/**
+ * \file
+ * \brief Arduino status LED driver for Adafruit M0 feather express.
+ *
+ * This code is abstraction of arduino peripheral drivers for Adafruit feather
+ * MO board.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+#include <Arduino.h>
+#include <SPI.h>
+#include <Adafruit_ZeroDMA.h>
+#include "wiring_private.h"
+#include "ArduinoPlatform.h"
+#include "ArduinoStatusLED.h"
+
+#define STATUSLED_SERCOM SERCOM0
+#define STATUSLED_DMAC_ID_TX SERCOM0_DMAC_ID_TX
+
+/* 24 color bits, 3 SPI bits each */
+#define STATUSLED_DATA_BYTES 9
+/* 300 us low at 2.4 MHz latch the color */
+#define STATUSLED_LATCH_BYTES 90
+
+static PlatformPool<SPIClass> statusSpiPool;
+static SPIClass *statusSpi = NULL;
+static Adafruit_ZeroDMA statusDma;
+static DmacDescriptor *statusDesc = NULL;
+static uint8_t statusBuffer[STATUSLED_DATA_BYTES + STATUSLED_LATCH_BYTES];
+static uint32_t statusColor = 0;
+static volatile bool statusBusy = false;
+static volatile bool statusPending = false;
+
+/* private function definition */
+static void StatusLED_encode(uint32_t color);
+static void StatusLED_done(Adafruit_ZeroDMA *dma);
+
+bool StatusLED_init(void)
+{
+  if (statusDesc != NULL)
+  {
+    return true;
+  }
+
+  /* Only the data out pin is connected, SCK (PAD3) stays a GPIO */
+  statusSpi = statusSpiPool.create(&sercom0, STATUSLED_PIN, STATUSLED_PIN,
+                                   STATUSLED_PIN, SPI_PAD_2_SCK_3, SERCOM_RX_PAD_0);
+  if (statusSpi == NULL)
+  {
+    return false;
+  }
+  statusSpi->begin();
+  if (pinPeripheral(STATUSLED_PIN, PIO_SERCOM_ALT) < 0)
+  {
+    StatusLED_deinit();
+    return false;
+  }
+  statusSpi->beginTransaction(
+      SPISettings(STATUSLED_SPI_CLOCK, MSBFIRST, SPI_MODE0));
+
+  statusDma.setTrigger(STATUSLED_DMAC_ID_TX);
+  statusDma.setAction(DMA_TRIGGER_ACTON_BEAT);
+  if (statusDma.allocate() != DMA_STATUS_OK)
+  {
+    StatusLED_deinit();
+    return false;
+  }
+
+  statusDesc = statusDma.addDescriptor(
+      statusBuffer, (void *)(&STATUSLED_SERCOM->SPI.DATA.reg),
+      sizeof(statusBuffer), DMA_BEAT_SIZE_BYTE, true, false);
+  if (statusDesc == NULL)
+  {
+    StatusLED_deinit();
+    return false;
+  }
+  statusDma.setCallback(StatusLED_done);
+
+  memset(statusBuffer, 0, sizeof(statusBuffer));
+  statusColor = 0;
+  statusBusy = false;
+  statusPending = false;
+  return true;
+}
+
+bool StatusLED_deinit(void)
+{
+  statusDma.abort();
+  statusDma.free();
+  statusDesc = NULL;
+  statusBusy = false;
+  statusPending = false;
+  if (statusSpi != NULL)
+  {
+    statusSpi->endTransaction();
+    statusSpi->end();
+    statusSpiPool.destroy(statusSpi);
+    statusSpi = NULL;
+  }
+  return true;
+}
+
+bool StatusLED_set(uint32_t color)
+{
+  if (statusDesc == NULL)
+  {
+    return false;
+  }
+
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+
+  statusColor = color & 0xFFFFFF;
+  if (statusBusy)
+  {
+    /* The buffer is in use, StatusLED_done() sends the latest color */
+    statusPending = true;
+  }
+  else
+  {
+    StatusLED_encode(statusColor);
+    statusBusy = true;
+    statusDma.startJob();
+  }
+
+  __set_PRIMASK(primask);
+  return true;
+}
+
+uint32_t StatusLED_get(void) { return statusColor; }
+
+bool StatusLED_isBusy(void) { return statusBusy; }
+
+/**
+ * @brief  Encode a color into the SPI buffer, green first (GRB)
+ * @param  color Color 0x00RRGGBB
+ * @retval none
+ */
+static void StatusLED_encode(uint32_t color)
+{
+  uint32_t grb = ((color & 0x00FF00) << 8) | ((color & 0xFF0000) >> 8) |
+                 (color & 0x0000FF);
+
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    uint8_t value = (uint8_t)(grb >> (16 - 8 * i));
+    uint32_t bits = 0;
+
+    for (uint8_t bit = 0; bit < 8; bit++)
+    {
+      bits = (bits << 3) | ((value & (0x80 >> bit)) ? 0x6 : 0x4);
+    }
+
+    statusBuffer[3 * i] = (uint8_t)(bits >> 16);
+    statusBuffer[3 * i + 1] = (uint8_t)(bits >> 8);
+    statusBuffer[3 * i + 2] = (uint8_t)bits;
+  }
+}
+
+/**
+ * @brief  DMA callback, the color has been sent and latched
+ * @param  dma DMA channel
+ * @retval none
+ */
+static void StatusLED_done(Adafruit_ZeroDMA *dma)
+{
+  if (statusPending)
+  {
+    statusPending = false;
+    StatusLED_encode(statusColor);
+    dma->startJob();
+    return;
+  }
+  statusBusy = false;
+}
@@ -0,0 +1,60 @@
+/**
+ * \file
+ * \brief Arduino status LED driver for Adafruit M0 feather express.
+ *
+ * This code is abstraction of arduino peripheral drivers for Adafruit feather
+ * MO board.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+
+#ifndef ARDUINOSTATUSLED_H
+#define ARDUINOSTATUSLED_H
+
+/**         Includes         */
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+/* On-board NeoPixel on pin 8 (PA06), driven by SERCOM0 (PAD2) as SPI data out
+ * with DMA. Every LED bit is sent as 3 SPI bits at 2.4 MHz (100 = 0,
+ * 110 = 1), followed by a 300 us low latch period. */
+#define STATUSLED_PIN 8
+#define STATUSLED_SPI_CLOCK 2400000
+
+  bool StatusLED_init(void);
+  bool StatusLED_deinit(void);
+
+  /* Starts the update (color 0x00RRGGBB) and returns immediately. A color set
+   * while an update is running is sent right after it. */
+  bool StatusLED_set(uint32_t color);
+  uint32_t StatusLED_get(void);
+  bool StatusLED_isBusy(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARDUINOSTATUSLED_H */
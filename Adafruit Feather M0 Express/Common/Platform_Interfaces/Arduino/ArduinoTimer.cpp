@@ -142,6 +142,30 @@ static void Timer_HandleInterrupt(HardwareTimer *pTc, TimerInstance instance)
   case Timer4:
   case Timer5:
   {
+    /* Free running counter - flags are cleared first so that the handlers can
+     * set the next compare value */
+    if (NULL != timer_irq_config[instance].overflowHandler)
+    {
+      if (((Tc *)pTc)->COUNT16.INTFLAG.bit.OVF == 1)
+      {
+        ((Tc *)pTc)->COUNT16.INTFLAG.reg = TC_INTFLAG_OVF;
+        timer_irq_config[instance].overflowHandler();
+      }
+
+      if (((((Tc *)pTc)->COUNT16.INTFLAG.bit.MC0 == 1) ||
+           timer_irq_config[instance].comparePending) &&
+          (((Tc *)pTc)->COUNT16.INTENSET.bit.MC0 == 1))
+      {
+        timer_irq_config[instance].comparePending = false;
+        ((Tc *)pTc)->COUNT16.INTFLAG.reg = TC_INTFLAG_MC0;
+        if (NULL != timer_irq_config[instance].irqHandler)
+        {
+          timer_irq_config[instance].irqHandler();
+        }
+      }
+      break;
+    }
+
     if (((Tc *)pTc)->COUNT16.INTFLAG.bit.MC0 == 1)
     {
       if (NULL != timer_irq_config[instance].irqHandler)
@@ -219,6 +243,7 @@ bool Timer_create(Timer *pTimer, TimerInstance timerInstance)
   if (false == Timer_isInUse(pTC, timerInstance))
   {
     timer_irq_config[timerInstance].irqHandler = NULL;
+    timer_irq_config[timerInstance].overflowHandler = NULL;
   }
   else
   {
@@ -311,7 +336,8 @@ bool Timer_stop(Timer *pTimer)
   }
   else if (UsesTcHardware(pTimer->instance))
   {
-    ((Tc *)TC)->COUNT16.INTENCLR.bit.MC0 = 1;
+    ((Tc *)TC)->COUNT16.INTENCLR.reg = TC_INTENCLR_MC0 | TC_INTENCLR_OVF;
+    timer_irq_config[pTimer->instance].overflowHandler = NULL;
   }
   else
   {
@@ -546,6 +572,139 @@ bool Timer_schedule(Timer *pTimer, bool runInStandby, TimerOpMode mode,
   return true;
 }
 
+/**
+ * @brief  Start a timer as free running 16-bit counter
+ * @param  pTimer Pointer to timer, must use TC hardware
+ * @param  runInStandby Keep counting in standby (the generic clock must run
+ *         in standby as well)
+ * @param  overflowHandler Called from interrupt context on every wrap around
+ * @param  compareHandler Called from interrupt context on a compare match
+ * @retval true if successful else false
+ */
+bool Timer_startCounter(Timer *pTimer, bool runInStandby,
+                        void (*overflowHandler)(void),
+                        void (*compareHandler)(void))
+{
+  if ((NULL == pTimer) || (NULL == overflowHandler))
+  {
+    /* Error - can not proceed */
+    return false;
+  }
+
+  /* A 16-bit TC can count without a slave, TCC hardware is not supported */
+  if (false == UsesTcHardware(pTimer->instance))
+  {
+    return false;
+  }
+
+  HardwareTimer *HW = static_cast<HardwareTimer *>(pTimer->obj);
+  if (true == Timer_isInUse(HW, pTimer->instance))
+  {
+    OutputDebug("Setup:Timer already running\r\n");
+    return false;
+  }
+
+  if ((false == Timer_setupClock(pTimer->instance)) ||
+      (false == Timer_reset(HW, pTimer->instance)))
+  {
+    return false;
+  }
+
+  TcCount16 *TC = static_cast<TcCount16 *>(pTimer->obj);
+
+  /* Count up to 0xFFFF and wrap around, the compare channel only raises
+   * interrupts */
+  TC->CTRLA.reg = TC_CTRLA_MODE_COUNT16 | TC_CTRLA_WAVEGEN_NFRQ |
+                  TC_CTRLA_PRESCALER_DIV16 |
+                  (runInStandby ? TC_CTRLA_RUNSTDBY : 0);
+  if (false == Timer_WaitForSync(HW, pTimer->instance, 0))
+  {
+    return false;
+  }
+
+  /* Keep COUNT synchronized so that it can be read without read request */
+  TC->READREQ.reg = TC_READREQ_RCONT | TC_READREQ_ADDR(TC_COUNT16_COUNT_OFFSET);
+
+  timer_irq_config[pTimer->instance].irqHandler = compareHandler;
+  timer_irq_config[pTimer->instance].overflowHandler = overflowHandler;
+  timer_irq_config[pTimer->instance].timerMode = Timer_Periodic;
+
+  TC->INTFLAG.reg = TC_INTFLAG_OVF | TC_INTFLAG_MC0;
+  TC->INTENSET.reg = TC_INTENSET_OVF;
+  Timer_EnableInterrupt(pTimer->instance);
+
+  if (false == Timer_enable(HW, pTimer->instance))
+  {
+    return false;
+  }
+
+  OutputDebug("Timer %u started as counter \r\n", pTimer->instance);
+  return true;
+}
+
+/**
+ * @brief  Read a free running counter
+ * @param  pTimer Pointer to timer
+ * @retval Counter value
+ */
+uint16_t Timer_readCounter(Timer *pTimer)
+{
+  return static_cast<TcCount16 *>(pTimer->obj)->COUNT.reg;
+}
+
+/**
+ * @brief  Check if the overflow of a free running counter is not handled yet
+ * @param  pTimer Pointer to timer
+ * @retval true if an overflow is pending else false
+ */
+bool Timer_isOverflowPending(Timer *pTimer)
+{
+  return static_cast<TcCount16 *>(pTimer->obj)->INTFLAG.bit.OVF == 1;
+}
+
+/**
+ * @brief  Set the compare value of a free running counter and enable the
+ *         compare interrupt (interrupts disabled)
+ * @param  pTimer Pointer to timer
+ * @param  value Counter value at which the compare handler is called, at most
+ *         half the counter range ahead
+ * @retval none
+ */
+void Timer_setCompare(Timer *pTimer, uint16_t value)
+{
+  TcCount16 *TC = static_cast<TcCount16 *>(pTimer->obj);
+  uint16_t start = TC->COUNT.reg;
+
+  /* Clear the flag before writing CC, so that a match while CC is synchronized
+   * is kept */
+  TC->INTFLAG.reg = TC_INTFLAG_MC0;
+  TC->CC[0].reg = value;
+  Timer_WaitForSync(static_cast<HardwareTimer *>(pTimer->obj), pTimer->instance,
+                    TCC_SYNCBUSY_CC0);
+  TC->INTENSET.reg = TC_INTENSET_MC0;
+
+  /* The counter may have passed the value before the new compare value took
+   * effect, the match would then only come after the next wrap around. Raise it
+   * in software instead (TC3_IRQn to TC5_IRQn are consecutive). */
+  uint16_t elapsed = (uint16_t)(TC->COUNT.reg - start);
+  if ((0 == TC->INTFLAG.bit.MC0) && (elapsed >= (uint16_t)(value - start)))
+  {
+    timer_irq_config[pTimer->instance].comparePending = true;
+    NVIC_SetPendingIRQ((IRQn_Type)(TC3_IRQn + (pTimer->instance - Timer3)));
+  }
+}
+
+/**
+ * @brief  Disable the compare interrupt of a free running counter
+ * @param  pTimer Pointer to timer
+ * @retval none
+ */
+void Timer_disableCompare(Timer *pTimer)
+{
+  static_cast<TcCount16 *>(pTimer->obj)->INTENCLR.reg = TC_INTENCLR_MC0;
+  timer_irq_config[pTimer->instance].comparePending = false;
+}
+
 /**
  * @brief  Schedule a timer
  * @param  pTimer Pointer to timer
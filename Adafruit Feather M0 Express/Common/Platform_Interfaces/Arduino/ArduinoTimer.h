@@ -68,6 +68,8 @@ extern "C"
   {
     timerIRQHandler irqHandler;
     TimerOpMode timerMode;
+    timerIRQHandler overflowHandler;
+    volatile bool comparePending; /* Compare match raised in software by Timer_setCompare */
   } Timer_IRQ_Config;
 
   typedef struct Timer
@@ -83,6 +85,20 @@ extern "C"
   bool Timer_schedule(Timer *pTimer, bool runInStandby, TimerOpMode mode,
                       int period_ms, void (*callback)(void));
 
+/* Count frequency of a free running counter (48 MHz / 16) */
+#define TIMER_COUNTER_FREQUENCY 3000000UL
+
+  /* Free running 16-bit counter on a TC instance (Timer3 - Timer5).
+   * overflowHandler is called on every wrap around, compareHandler when the
+   * counter reaches the value set by Timer_setCompare. */
+  bool Timer_startCounter(Timer *pTimer, bool runInStandby,
+                          void (*overflowHandler)(void),
+                          void (*compareHandler)(void));
+  uint16_t Timer_readCounter(Timer *pTimer);
+  bool Timer_isOverflowPending(Timer *pTimer);
+  void Timer_setCompare(Timer *pTimer, uint16_t value);
+  void Timer_disableCompare(Timer *pTimer);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,354 @@
+/**
+ * \file
+ * \brief Host clock and interrupt emulation of the POSIX host platform.
+ *
+ * Events of the emulated peripherals are handled like interrupts whenever
+ * the firmware waits or clears the interrupt mask.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+#include "ConfigPlatform.h"
+
+#ifdef BASE_PLATFORM
+
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* File descriptors watched while waiting */
+#define BASECLOCK_MAX_FDS 8
+
+static BaseClock_Mode clockMode = BaseClock_Real;
+static uint64_t clockStart = 0;
+static uint64_t clockSimulated = 0;
+static uint64_t clockEnd = 0;
+static BaseClock_Source *clockSources = NULL;
+static volatile sig_atomic_t clockInterrupted = 0;
+
+static uint32_t irqMask = 0;
+static bool irqActive = false;
+
+/* private function definition */
+static uint64_t BaseClock_monotonic(void);
+static uint64_t BaseClock_nextEvent(void);
+static bool BaseClock_waitForInput(uint64_t now, uint64_t wake);
+static void BaseClock_checkEnd(uint64_t now);
+static void BaseClock_handleSignal(int signal);
+
+void BaseClock_setMode(BaseClock_Mode mode)
+{
+  clockMode = mode;
+  clockStart = BaseClock_monotonic();
+  clockSimulated = 0;
+  signal(SIGINT, BaseClock_handleSignal);
+  signal(SIGTERM, BaseClock_handleSignal);
+}
+
+BaseClock_Mode BaseClock_getMode(void) { return clockMode; }
+
+uint64_t BaseClock_now(void)
+{
+  if (clockMode == BaseClock_Simulated)
+  {
+    return clockSimulated;
+  }
+  if (clockStart == 0)
+  {
+    clockStart = BaseClock_monotonic();
+  }
+  return BaseClock_monotonic() - clockStart;
+}
+
+void BaseClock_setEndTime(uint64_t time) { clockEnd = time; }
+
+void BaseClock_addSource(BaseClock_Source *source)
+{
+  for (BaseClock_Source *s = clockSources; s != NULL; s = s->next)
+  {
+    if (s == source)
+    {
+      return;
+    }
+  }
+  source->next = clockSources;
+  clockSources = source;
+}
+
+void BaseClock_removeSource(BaseClock_Source *source)
+{
+  for (BaseClock_Source **s = &clockSources; *s != NULL; s = &(*s)->next)
+  {
+    if (*s == source)
+    {
+      *s = source->next;
+      source->next = NULL;
+      return;
+    }
+  }
+}
+
+void BaseClock_poll(void)
+{
+  /* Interrupts do not nest */
+  if ((irqMask != 0) || irqActive)
+  {
+    return;
+  }
+
+  irqActive = true;
+  uint64_t now = BaseClock_now();
+  BaseClock_Source *next;
+  for (BaseClock_Source *source = clockSources; source != NULL; source = next)
+  {
+    /* The service may remove its source */
+    next = source->next;
+    if ((source->nextEvent != NULL) && (source->nextEvent(source->context) <= now))
+    {
+      source->service(source->context, now);
+    }
+  }
+  irqActive = false;
+
+  BaseClock_checkEnd(now);
+}
+
+bool BaseClock_inInterrupt(void) { return irqActive; }
+
+void BaseClock_waitUntil(uint64_t time)
+{
+  for (;;)
+  {
+    BaseClock_poll();
+
+    uint64_t now = BaseClock_now();
+    if (now >= time)
+    {
+      return;
+    }
+
+    uint64_t wake = BaseClock_nextEvent();
+    /* Pending events wait for the interrupt mask to be cleared */
+    if ((wake <= now) || (wake > time))
+    {
+      wake = time;
+    }
+    if ((clockEnd != 0) && (wake > clockEnd))
+    {
+      wake = clockEnd;
+    }
+
+    if (!BaseClock_waitForInput(now, wake) && (clockMode == BaseClock_Simulated))
+    {
+      clockSimulated = wake;
+    }
+    BaseClock_checkEnd(BaseClock_now());
+  }
+}
+
+void BaseClock_waitForEvent(void)
+{
+  uint64_t now = BaseClock_now();
+  uint64_t wake = BaseClock_nextEvent();
+
+  if (wake > now)
+  {
+    if ((clockEnd != 0) && (wake > clockEnd))
+    {
+      wake = clockEnd;
+    }
+    for (;;)
+    {
+      if (BaseClock_waitForInput(now, wake))
+      {
+        break;
+      }
+      if (wake == UINT64_MAX)
+      {
+        /* Nothing can wake up the firmware any more */
+        fprintf(stderr, "BaseClock: waiting without pending events, exiting\n");
+        exit(0);
+      }
+      if (clockMode == BaseClock_Simulated)
+      {
+        clockSimulated = wake;
+        break;
+      }
+      /* The real clock may wake up a little early */
+      now = BaseClock_now();
+      if (now >= wake)
+      {
+        break;
+      }
+    }
+  }
+
+  BaseClock_poll();
+  BaseClock_checkEnd(BaseClock_now());
+}
+
+/**
+ * @brief  Time of the next event of all sources
+ * @retval Time in microseconds, UINT64_MAX if none
+ */
+static uint64_t BaseClock_nextEvent(void)
+{
+  uint64_t next = UINT64_MAX;
+  for (BaseClock_Source *source = clockSources; source != NULL; source = source->next)
+  {
+    if (source->nextEvent != NULL)
+    {
+      uint64_t event = source->nextEvent(source->context);
+      if (event < next)
+      {
+        next = event;
+      }
+    }
+  }
+  return next;
+}
+
+/**
+ * @brief  Wait for input on the file descriptors of the sources
+ *
+ * The simulated clock does not wait for a timeout, but it blocks if there is nothing else to wait for.
+ *
+ * @param  now Current time
+ * @param  wake Time to stop waiting, UINT64_MAX to wait for input only
+ * @retval true if input was serviced, false if the time is reached
+ */
+static bool BaseClock_waitForInput(uint64_t now, uint64_t wake)
+{
+  struct pollfd fds[BASECLOCK_MAX_FDS];
+  BaseClock_Source *owners[BASECLOCK_MAX_FDS];
+  nfds_t count = 0;
+
+  for (BaseClock_Source *source = clockSources; (source != NULL) && (count < BASECLOCK_MAX_FDS); source = source->next)
+  {
+    if (source->fd >= 0)
+    {
+      fds[count].fd = source->fd;
+      fds[count].events = POLLIN;
+      fds[count].revents = 0;
+      owners[count] = source;
+      count++;
+    }
+  }
+
+  struct timespec timeout = {0, 0};
+  struct timespec *timeoutP = &timeout;
+  if (wake == UINT64_MAX)
+  {
+    timeoutP = NULL;
+  }
+  else if ((clockMode == BaseClock_Real) && (wake > now))
+  {
+    timeout.tv_sec = (time_t)((wake - now) / 1000000);
+    timeout.tv_nsec = (long)(((wake - now) % 1000000) * 1000);
+  }
+
+  if ((count == 0) && (timeoutP == NULL))
+  {
+    return false;
+  }
+
+  int ready = ppoll(fds, count, timeoutP, NULL);
+  if (ready <= 0)
+  {
+    if ((ready < 0) && (errno == EINTR))
+    {
+      BaseClock_checkEnd(BaseClock_now());
+      return true;
+    }
+    return false;
+  }
+
+  for (nfds_t i = 0; i < count; i++)
+  {
+    if (fds[i].revents != 0)
+    {
+      owners[i]->service(owners[i]->context, now);
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief  Exit at the end time or on SIGINT/SIGTERM, exit handlers write the statistics
+ * @param  now Current time
+ * @retval none
+ */
+static void BaseClock_checkEnd(uint64_t now)
+{
+  if (clockInterrupted || ((clockEnd != 0) && (now >= clockEnd)))
+  {
+    exit(0);
+  }
+}
+
+static void BaseClock_handleSignal(int signal)
+{
+  (void)signal;
+  clockInterrupted = 1;
+}
+
+static uint64_t BaseClock_monotonic(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+/**         Arduino core         */
+
+unsigned long millis(void) { return (uint32_t)(BaseClock_now() / 1000); }
+
+unsigned long micros(void) { return (uint32_t)BaseClock_now(); }
+
+void delay(unsigned long ms) { BaseClock_waitUntil(BaseClock_now() + (uint64_t)ms * 1000); }
+
+void delayMicroseconds(unsigned int us) { BaseClock_waitUntil(BaseClock_now() + us); }
+
+void yield(void) { BaseClock_poll(); }
+
+uint32_t __get_PRIMASK(void) { return irqMask; }
+
+void __set_PRIMASK(uint32_t primask)
+{
+  irqMask = primask;
+  if (irqMask == 0)
+  {
+    BaseClock_poll();
+  }
+}
+
+void __disable_irq(void) { irqMask = 1; }
+
+void __enable_irq(void) { __set_PRIMASK(0); }
+
+void __WFI(void) { BaseClock_waitForEvent(); }
+
+#endif /* BASE_PLATFORM */
+
+/**         EOF         */
@@ -0,0 +1,97 @@
+/**
+ * \file
+ * \brief I2C bus of the POSIX host platform.
+ *
+ * The transaction engine (ArduinoI2C.h) is the register file mock of
+ * Utilities/i2c_mock, this file records its traffic and runs queued
+ * transactions like the bus interrupt. Devices are added with MockI2C_addDevice().
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+#include "ConfigPlatform.h"
+
+#ifdef BASE_PLATFORM
+
+#include <vector>
+#include "MockI2C.h"
+
+static BaseClock_Source i2cSource;
+
+/* private function definition */
+static bool BaseI2C_register(void);
+static uint64_t BaseI2C_nextEvent(void *context);
+static void BaseI2C_service(void *context, uint64_t now);
+static void BaseI2C_record(const I2CAsync_Transaction *transaction);
+
+/* The engine has no init hook, so the bus is connected to the clock at startup */
+static const bool i2cRegistered = BaseI2C_register();
+
+static bool BaseI2C_register(void)
+{
+  i2cSource.nextEvent = BaseI2C_nextEvent;
+  i2cSource.service = BaseI2C_service;
+  i2cSource.fd = -1;
+  BaseClock_addSource(&i2cSource);
+  MockI2C_setMonitor(BaseI2C_record);
+  return true;
+}
+
+/**
+ * @brief  Queued transactions are due right away
+ * @retval Time of the next event
+ */
+static uint64_t BaseI2C_nextEvent(void *context)
+{
+  (void)context;
+  return I2CAsync_isIdle() ? UINT64_MAX : 0;
+}
+
+static void BaseI2C_service(void *context, uint64_t now)
+{
+  (void)context;
+  (void)now;
+  MockI2C_run();
+}
+
+/**
+ * @brief  Record the write and read phase of an executed transaction
+ * @param  transaction Transaction
+ * @retval none
+ */
+static void BaseI2C_record(const I2CAsync_Transaction *transaction)
+{
+  if ((transaction->txPrefixLength > 0) || (transaction->txLength > 0))
+  {
+    std::vector<uint8_t> data(transaction->txPrefix, transaction->txPrefix + transaction->txPrefixLength);
+    data.insert(data.end(), transaction->txData, transaction->txData + transaction->txLength);
+    BaseTraffic_record(BaseTraffic_I2CWrite, transaction->address, data.data(), (uint32_t)data.size());
+  }
+
+  if ((transaction->rxLength > 0) && (transaction->status == WE_SUCCESS))
+  {
+    BaseTraffic_record(BaseTraffic_I2CRead, transaction->address, transaction->rxData, transaction->rxLength);
+  }
+}
+
+#endif /* BASE_PLATFORM */
+
+/**         EOF         */
@@ -0,0 +1,375 @@
+/**
+ * \file
+ * \brief POSIX host platform for the Adafruit M0 feather express firmware.
+ *
+ * Command line options, traffic recording, pins and reset of the emulated
+ * board.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+#include "ConfigPlatform.h"
+
+#ifdef BASE_PLATFORM
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef struct
+{
+  uint8_t mode;
+  int8_t peripheral; /* EPioType set by pinPeripheral() */
+  uint8_t output;
+  uint8_t input;
+  bool inputSet;
+  voidFuncPtr callback;
+  uint8_t interruptMode;
+  bool interruptPending;
+} BasePin;
+
+static BaseTraffic_Handler trafficHandler = NULL;
+static void *trafficContext = NULL;
+static FILE *trafficLog = NULL;
+static BaseTraffic_Stats trafficStats;
+
+static BasePin pins[PINS_COUNT];
+static bool pinsPending = false;
+static BaseClock_Source pinSource;
+
+static char **platformArgv = NULL;
+static bool platformReport = false;
+static clock_t platformCpuStart = 0;
+
+static const char *const trafficNames[BaseTraffic_Count] = {
+    "i2c-write", "i2c-read", "spi", "dma", "serial-tx", "serial-rx", "pin", "status-led"};
+
+/* private function definition */
+static void BasePlatform_exit(void);
+static uint64_t BasePin_nextEvent(void *context);
+static void BasePin_service(void *context, uint64_t now);
+
+/**
+ * @brief  Parse the command line options
+ *
+ *   -s         simulated clock (default: real clock)
+ *   -d <ms>    exit after the given time and print the statistics
+ *   -t <file>  write the traffic log
+ *   -f <file>  keep the SPI flash content in a file
+ *
+ * @param  argc Number of arguments
+ * @param  argv Arguments, kept for NVIC_SystemReset()
+ * @retval true if successful, false on invalid options
+ */
+bool BasePlatform_init(int argc, char *argv[])
+{
+  BaseClock_Mode mode = BaseClock_Real;
+  uint64_t endTime = 0;
+  int option;
+
+  platformArgv = argv;
+  while ((argc > 0) && ((option = getopt(argc, argv, "sd:t:f:h")) != -1))
+  {
+    switch (option)
+    {
+    case 's':
+      mode = BaseClock_Simulated;
+      break;
+    case 'd':
+      endTime = strtoull(optarg, NULL, 0) * 1000;
+      platformReport = true;
+      break;
+    case 't':
+      if (!BaseTraffic_openLog(optarg))
+      {
+        return false;
+      }
+      break;
+    case 'f':
+      if (!BaseSPIFlash_open(optarg))
+      {
+        return false;
+      }
+      break;
+    default:
+      BasePlatform_usage(argv[0]);
+      return false;
+    }
+  }
+
+  BaseClock_setMode(mode);
+  BaseClock_setEndTime(endTime);
+  platformCpuStart = clock();
+  atexit(BasePlatform_exit);
+  return true;
+}
+
+void BasePlatform_usage(const char *name)
+{
+  fprintf(stderr, "usage: %s [-s] [-d <ms>] [-t <traffic log>] [-f <flash image>]\n"
+                  "  -s  simulated clock, time advances only while the firmware waits\n"
+                  "  -d  exit after the given time (ms) and print the statistics\n"
+                  "  -t  record the traffic of the emulated peripherals\n"
+                  "  -f  keep the SPI flash content in a file\n",
+          name);
+}
+
+void BaseTraffic_setHandler(BaseTraffic_Handler handler, void *context)
+{
+  trafficHandler = handler;
+  trafficContext = context;
+}
+
+bool BaseTraffic_openLog(const char *path)
+{
+  if (trafficLog != NULL)
+  {
+    fclose(trafficLog);
+  }
+  trafficLog = fopen(path, "w");
+  if (trafficLog == NULL)
+  {
+    perror(path);
+    return false;
+  }
+  return true;
+}
+
+void BaseTraffic_record(BaseTraffic_Type type, uint32_t channel, const uint8_t *data, uint32_t length)
+{
+  BaseTraffic_Record record = {BaseClock_now(), type, channel, data, length};
+
+  trafficStats.records[type]++;
+  trafficStats.bytes[type] += length;
+
+  if (trafficLog != NULL)
+  {
+    fprintf(trafficLog, "%llu %s %lu %lu ", (unsigned long long)record.time, trafficNames[type],
+            (unsigned long)channel, (unsigned long)length);
+    for (uint32_t i = 0; i < length; i++)
+    {
+      fprintf(trafficLog, "%02x", data[i]);
+    }
+    fputc('\n', trafficLog);
+  }
+
+  if (trafficHandler != NULL)
+  {
+    trafficHandler(&record, trafficContext);
+  }
+}
+
+const BaseTraffic_Stats *BaseTraffic_getStats(void) { return &trafficStats; }
+
+void BaseTraffic_printStats(FILE *file)
+{
+  for (int type = 0; type < BaseTraffic_Count; type++)
+  {
+    if (trafficStats.records[type] > 0)
+    {
+      fprintf(file, "%-10s %10lu records %12llu bytes\n", trafficNames[type],
+              (unsigned long)trafficStats.records[type], (unsigned long long)trafficStats.bytes[type]);
+    }
+  }
+}
+
+void BasePin_setInput(uint8_t pin, uint8_t level)
+{
+  if (pin >= PINS_COUNT)
+  {
+    return;
+  }
+
+  BasePin *p = &pins[pin];
+  uint8_t previous = digitalRead(pin);
+  p->input = level ? HIGH : LOW;
+  p->inputSet = true;
+
+  if ((p->callback == NULL) || (p->input == previous))
+  {
+    return;
+  }
+  if ((p->interruptMode == CHANGE) || ((p->interruptMode == RISING) && p->input) || ((p->interruptMode == FALLING) && !p->input))
+  {
+    /* Runs like an interrupt, as soon as the mask allows */
+    p->interruptPending = true;
+    pinsPending = true;
+    BaseClock_poll();
+  }
+}
+
+uint8_t BasePin_getOutput(uint8_t pin)
+{
+  return (pin < PINS_COUNT) ? pins[pin].output : LOW;
+}
+
+/**
+ * @brief  Statistics at exit, if a run time was given
+ * @retval none
+ */
+static void BasePlatform_exit(void)
+{
+  if (trafficLog != NULL)
+  {
+    fclose(trafficLog);
+    trafficLog = NULL;
+  }
+
+  if (platformReport)
+  {
+    double cpu = (double)(clock() - platformCpuStart) / CLOCKS_PER_SEC;
+    double emulated = BaseClock_now() / 1e6;
+    fflush(stdout);
+    fprintf(stderr, "\n%.3f s %s time in %.3f s CPU time", emulated,
+            (BaseClock_getMode() == BaseClock_Simulated) ? "simulated" : "real", cpu);
+    if (cpu > 0)
+    {
+      fprintf(stderr, " (%.1fx)", emulated / cpu);
+    }
+    fprintf(stderr, "\n");
+    BaseTraffic_printStats(stderr);
+  }
+}
+
+static uint64_t BasePin_nextEvent(void *context)
+{
+  (void)context;
+  return pinsPending ? 0 : UINT64_MAX;
+}
+
+/**
+ * @brief  Call the interrupts of the pins that changed
+ * @retval none
+ */
+static void BasePin_service(void *context, uint64_t now)
+{
+  (void)context;
+  (void)now;
+  pinsPending = false;
+  for (int pin = 0; pin < PINS_COUNT; pin++)
+  {
+    if (pins[pin].interruptPending)
+    {
+      pins[pin].interruptPending = false;
+      if (pins[pin].callback != NULL)
+      {
+        pins[pin].callback();
+      }
+    }
+  }
+}
+
+/**         Arduino core         */
+
+void pinMode(uint32_t pin, uint32_t mode)
+{
+  if (pin < PINS_COUNT)
+  {
+    pins[pin].mode = (uint8_t)mode;
+  }
+}
+
+void digitalWrite(uint32_t pin, uint32_t value)
+{
+  if (pin >= PINS_COUNT)
+  {
+    return;
+  }
+
+  uint8_t level = value ? HIGH : LOW;
+  if (pins[pin].output != level)
+  {
+    pins[pin].output = level;
+    BaseTraffic_record(BaseTraffic_Pin, pin, &level, 1);
+  }
+}
+
+int digitalRead(uint32_t pin)
+{
+  if (pin >= PINS_COUNT)
+  {
+    return LOW;
+  }
+
+  const BasePin *p = &pins[pin];
+  if (p->mode == OUTPUT)
+  {
+    return p->output;
+  }
+  if (!p->inputSet)
+  {
+    /* Open input */
+    return (p->mode == INPUT_PULLUP) ? HIGH : LOW;
+  }
+  return p->input;
+}
+
+void attachInterrupt(uint32_t pin, voidFuncPtr callback, uint32_t mode)
+{
+  if (pin >= PINS_COUNT)
+  {
+    return;
+  }
+
+  pins[pin].callback = callback;
+  pins[pin].interruptMode = (uint8_t)mode;
+  pins[pin].interruptPending = false;
+
+  pinSource.nextEvent = BasePin_nextEvent;
+  pinSource.service = BasePin_service;
+  pinSource.fd = -1;
+  BaseClock_addSource(&pinSource);
+}
+
+void detachInterrupt(uint32_t pin)
+{
+  if (pin < PINS_COUNT)
+  {
+    pins[pin].callback = NULL;
+    pins[pin].interruptPending = false;
+  }
+}
+
+int pinPeripheral(uint32_t pin, EPioType peripheral)
+{
+  if (pin >= PINS_COUNT)
+  {
+    return -1;
+  }
+  pins[pin].peripheral = (int8_t)peripheral;
+  return 0;
+}
+
+void NVIC_SystemReset(void)
+{
+  fflush(NULL);
+  if (platformArgv != NULL)
+  {
+    execv("/proc/self/exe", platformArgv);
+  }
+  exit(0);
+}
+
+#endif /* BASE_PLATFORM */
+
+/**         EOF         */
@@ -0,0 +1,341 @@
+/**
+ * \file
+ * \brief SPI and DMA controller of the POSIX host platform.
+ *
+ * DMA transfers to a SERCOM take the time of its SPI clock, so the frame rate
+ * of the emulated ICLED output matches the board.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+#include "ConfigPlatform.h"
+
+#ifdef BASE_PLATFORM
+
+#include <SPI.h>
+
+/* Feather M0: SPI on SERCOM4, MOSI pin 23 */
+#define BASESPI_DEFAULT_MOSI 23
+
+struct BaseDMA_Channel
+{
+  Adafruit_ZeroDMA *owner;
+  BaseClock_Source source;
+  bool active;
+  uint64_t passEnd; /* End of the current pass over the descriptors */
+  uint64_t recordedHash;
+
+  static uint64_t nextEvent(void *context);
+  static void service(void *context, uint64_t now);
+  static uint64_t passDuration(const Adafruit_ZeroDMA *dma);
+  static void record(BaseDMA_Channel *channel, bool onlyIfChanged);
+};
+
+Sercom BaseSercomRegisters[SERCOM_INST_NUM];
+
+SERCOM sercom0(0);
+SERCOM sercom1(1);
+SERCOM sercom2(2);
+SERCOM sercom3(3);
+SERCOM sercom4(4);
+SERCOM sercom5(5);
+
+static SERCOM *const sercoms[SERCOM_INST_NUM] = {&sercom0, &sercom1, &sercom2, &sercom3, &sercom4, &sercom5};
+
+SPIClass SPI(&sercom4, BASESPI_DEFAULT_MOSI, BASESPI_DEFAULT_MOSI, BASESPI_DEFAULT_MOSI, SPI_PAD_2_SCK_3, SERCOM_RX_PAD_0);
+
+static BaseDMA_Channel dmaChannels[DMAC_CH_NUM];
+
+/**         SPI         */
+
+SPIClass::SPIClass(SERCOM *sercom, uint8_t pinMISO, uint8_t pinSCK, uint8_t pinMOSI, SercomSpiTXPad padTx, SercomRXPad padRx)
+    : sercom(sercom), pinMOSI(pinMOSI)
+{
+  (void)pinMISO;
+  (void)pinSCK;
+  (void)padTx;
+  (void)padRx;
+}
+
+void SPIClass::begin() { pinPeripheral(pinMOSI, PIO_SERCOM); }
+
+void SPIClass::end() { sercom->clock = 0; }
+
+void SPIClass::beginTransaction(SPISettings settings) { sercom->clock = settings.clock; }
+
+void SPIClass::endTransaction() {}
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+  BaseTraffic_record(BaseTraffic_SPI, sercom->index, &data, 1);
+  return 0xFF;
+}
+
+uint16_t SPIClass::transfer16(uint16_t data)
+{
+  uint8_t bytes[2] = {(uint8_t)(data >> 8), (uint8_t)data};
+  BaseTraffic_record(BaseTraffic_SPI, sercom->index, bytes, 2);
+  return 0xFFFF;
+}
+
+void SPIClass::transfer(void *buffer, size_t size)
+{
+  BaseTraffic_record(BaseTraffic_SPI, sercom->index, (const uint8_t *)buffer, (uint32_t)size);
+  memset(buffer, 0xFF, size);
+}
+
+/**         DMA         */
+
+Adafruit_ZeroDMA::Adafruit_ZeroDMA(void)
+    : channel(0xFF), trigger(0), looping(false), callback(NULL), descriptorCount(0)
+{
+}
+
+ZeroDMAstatus Adafruit_ZeroDMA::allocate(void)
+{
+  if (channel != 0xFF)
+  {
+    return DMA_STATUS_OK;
+  }
+
+  for (uint8_t i = 0; i < DMAC_CH_NUM; i++)
+  {
+    if (dmaChannels[i].owner == NULL)
+    {
+      BaseDMA_Channel *c = &dmaChannels[i];
+      c->owner = this;
+      c->active = false;
+      c->source.nextEvent = BaseDMA_Channel::nextEvent;
+      c->source.service = BaseDMA_Channel::service;
+      c->source.context = c;
+      c->source.fd = -1;
+      BaseClock_addSource(&c->source);
+      channel = i;
+      return DMA_STATUS_OK;
+    }
+  }
+  return DMA_STATUS_ERR_NOT_FOUND;
+}
+
+ZeroDMAstatus Adafruit_ZeroDMA::free(void)
+{
+  if (channel == 0xFF)
+  {
+    return DMA_STATUS_ERR_NOT_INITIALIZED;
+  }
+  if (dmaChannels[channel].active)
+  {
+    return DMA_STATUS_BUSY;
+  }
+
+  BaseClock_removeSource(&dmaChannels[channel].source);
+  dmaChannels[channel].owner = NULL;
+  channel = 0xFF;
+  descriptorCount = 0;
+  return DMA_STATUS_OK;
+}
+
+ZeroDMAstatus Adafruit_ZeroDMA::startJob(void)
+{
+  if ((channel == 0xFF) || (descriptorCount == 0))
+  {
+    return DMA_STATUS_ERR_NOT_INITIALIZED;
+  }
+
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+
+  BaseDMA_Channel *c = &dmaChannels[channel];
+  if (!c->active)
+  {
+    c->active = true;
+    c->passEnd = BaseClock_now() + BaseDMA_Channel::passDuration(this);
+    BaseDMA_Channel::record(c, false);
+  }
+
+  __set_PRIMASK(primask);
+  return DMA_STATUS_OK;
+}
+
+void Adafruit_ZeroDMA::abort(void)
+{
+  if (channel != 0xFF)
+  {
+    dmaChannels[channel].active = false;
+  }
+}
+
+void Adafruit_ZeroDMA::setTrigger(uint8_t trigger) { this->trigger = trigger; }
+
+void Adafruit_ZeroDMA::setAction(dma_transfer_trigger_action action) { (void)action; }
+
+void Adafruit_ZeroDMA::loop(const bool flag) { looping = flag; }
+
+void Adafruit_ZeroDMA::setCallback(void (*callback)(Adafruit_ZeroDMA *), dma_callback_type type)
+{
+  if (type == DMA_CALLBACK_TRANSFER_DONE)
+  {
+    this->callback = callback;
+  }
+}
+
+DmacDescriptor *Adafruit_ZeroDMA::addDescriptor(void *src, void *dst, uint32_t count, dma_beat_size size,
+                                                bool srcInc, bool dstInc, uint32_t stepSize, bool stepSel)
+{
+  (void)stepSize;
+  (void)stepSel;
+  if ((channel == 0xFF) || (descriptorCount >= BASEDMA_MAX_DESCRIPTORS))
+  {
+    return NULL;
+  }
+
+  DmacDescriptor *d = &descriptors[descriptorCount++];
+  d->source = src;
+  d->destination = dst;
+  d->beats = count;
+  d->beatSize = (uint8_t)(1 << size);
+  d->sourceIncrement = srcInc;
+  d->destinationIncrement = dstInc;
+  return d;
+}
+
+void Adafruit_ZeroDMA::changeDescriptor(DmacDescriptor *d, void *src, void *dst, uint32_t count)
+{
+  if (src != NULL)
+  {
+    d->source = src;
+  }
+  if (dst != NULL)
+  {
+    d->destination = dst;
+  }
+  if (count > 0)
+  {
+    d->beats = count;
+  }
+}
+
+bool Adafruit_ZeroDMA::isActive(void) { return (channel != 0xFF) && dmaChannels[channel].active; }
+
+uint8_t Adafruit_ZeroDMA::getChannel(void) { return channel; }
+
+uint64_t BaseDMA_Channel::nextEvent(void *context)
+{
+  BaseDMA_Channel *c = (BaseDMA_Channel *)context;
+  return c->active ? c->passEnd : UINT64_MAX;
+}
+
+/**
+ * @brief  End of a pass: a looping job starts the next pass, any other job is done
+ * @param  context Channel
+ * @param  now Current time
+ * @retval none
+ */
+void BaseDMA_Channel::service(void *context, uint64_t now)
+{
+  BaseDMA_Channel *c = (BaseDMA_Channel *)context;
+  Adafruit_ZeroDMA *dma = c->owner;
+
+  if (!c->active || (now < c->passEnd))
+  {
+    return;
+  }
+
+  if (dma->looping)
+  {
+    /* Passes that were due while nobody looked sent the same data */
+    uint64_t duration = passDuration(dma);
+    c->passEnd = (duration > 0) ? (c->passEnd + ((now - c->passEnd) / duration + 1) * duration) : now + 1;
+    record(c, true);
+    return;
+  }
+
+  c->active = false;
+  if (dma->callback != NULL)
+  {
+    dma->callback(dma);
+  }
+}
+
+/**
+ * @brief  Time of one pass over all descriptors at the SPI clock of the triggering SERCOM
+ * @param  dma DMA manager
+ * @retval Time in microseconds, at least 1
+ */
+uint64_t BaseDMA_Channel::passDuration(const Adafruit_ZeroDMA *dma)
+{
+  uint64_t bytes = 0;
+  for (uint8_t i = 0; i < dma->descriptorCount; i++)
+  {
+    bytes += (uint64_t)dma->descriptors[i].beats * dma->descriptors[i].beatSize;
+  }
+
+  /* SERCOMn triggers RX at 1 + 2n and TX at 2 + 2n */
+  uint8_t index = (uint8_t)((dma->trigger - 1) / 2);
+  uint32_t clock = ((dma->trigger > 0) && (index < SERCOM_INST_NUM)) ? sercoms[index]->clock : 0;
+  if (clock == 0)
+  {
+    return 1;
+  }
+
+  uint64_t duration = (bytes * 8 * 1000000 + clock - 1) / clock;
+  return (duration > 0) ? duration : 1;
+}
+
+/**
+ * @brief  Record the data sent by a pass
+ * @param  channel Channel
+ * @param  onlyIfChanged Skip the record if the data is the same as the one recorded last
+ * @retval none
+ */
+void BaseDMA_Channel::record(BaseDMA_Channel *channel, bool onlyIfChanged)
+{
+  Adafruit_ZeroDMA *dma = channel->owner;
+
+  /* FNV-1a over the source data */
+  uint64_t hash = 14695981039346656037ULL;
+  for (uint8_t i = 0; i < dma->descriptorCount; i++)
+  {
+    const DmacDescriptor *d = &dma->descriptors[i];
+    uint32_t length = d->sourceIncrement ? d->beats * d->beatSize : d->beatSize;
+    for (uint32_t j = 0; j < length; j++)
+    {
+      hash = (hash ^ ((const uint8_t *)d->source)[j]) * 1099511628211ULL;
+    }
+  }
+
+  if (onlyIfChanged && (hash == channel->recordedHash))
+  {
+    return;
+  }
+  channel->recordedHash = hash;
+
+  for (uint8_t i = 0; i < dma->descriptorCount; i++)
+  {
+    const DmacDescriptor *d = &dma->descriptors[i];
+    uint32_t length = d->sourceIncrement ? d->beats * d->beatSize : d->beatSize;
+    BaseTraffic_record(BaseTraffic_DMA, dma->trigger, (const uint8_t *)d->source, length);
+  }
+}
+
+#endif /* BASE_PLATFORM */
+
+/**         EOF         */
@@ -0,0 +1,150 @@
+/**
+ * \file
+ * \brief SPI flash of the POSIX host platform (ArduinoSPIFlash.h interface).
+ *
+ * A 2 MB NOR flash in RAM or in a file: programming only clears bits, erased
+ * sectors read 0xFF. Operations complete immediately.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+#include "ConfigPlatform.h"
+#include "ArduinoSPIFlash.h"
+
+#ifdef BASE_PLATFORM
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Capacity of the GD25Q16C on the Feather */
+#define BASESPIFLASH_SIZE (2UL * 1024 * 1024)
+
+static uint8_t flashMemory[BASESPIFLASH_SIZE];
+static uint8_t *flash = NULL;
+static uint32_t flashSize = 0;
+
+bool BaseSPIFlash_open(const char *path)
+{
+  int fd = open(path, O_RDWR | O_CREAT, 0644);
+  struct stat st;
+  if ((fd < 0) || (fstat(fd, &st) != 0))
+  {
+    perror(path);
+    return false;
+  }
+
+  bool created = ((size_t)st.st_size < BASESPIFLASH_SIZE);
+  if (created && (ftruncate(fd, BASESPIFLASH_SIZE) != 0))
+  {
+    perror(path);
+    close(fd);
+    return false;
+  }
+
+  void *image = mmap(NULL, BASESPIFLASH_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (image == MAP_FAILED)
+  {
+    perror(path);
+    return false;
+  }
+
+  flash = (uint8_t *)image;
+  if (created)
+  {
+    memset(flash + st.st_size, 0xFF, BASESPIFLASH_SIZE - st.st_size);
+  }
+  return true;
+}
+
+bool SPIFlash_init(void)
+{
+  if (flash == NULL)
+  {
+    flash = flashMemory;
+    memset(flash, 0xFF, BASESPIFLASH_SIZE);
+  }
+  flashSize = BASESPIFLASH_SIZE;
+  return true;
+}
+
+bool SPIFlash_deinit(void)
+{
+  flashSize = 0;
+  return true;
+}
+
+uint32_t SPIFlash_getSize(void) { return flashSize; }
+
+bool SPIFlash_read(uint32_t address, uint8_t *data, uint32_t length)
+{
+  if (address + length > flashSize)
+  {
+    return false;
+  }
+  memcpy(data, &flash[address], length);
+  return true;
+}
+
+bool SPIFlash_readAsync(uint32_t address, uint8_t *data, uint32_t length)
+{
+  if (length > SPIFLASH_MAX_ASYNC_READ)
+  {
+    return false;
+  }
+  return SPIFlash_read(address, data, length);
+}
+
+bool SPIFlash_isBusy(void) { return false; }
+
+bool SPIFlash_program(uint32_t address, const uint8_t *data, uint32_t length)
+{
+  if ((address + length > flashSize) ||
+      ((address % SPIFLASH_PAGE_SIZE) + length > SPIFLASH_PAGE_SIZE))
+  {
+    return false;
+  }
+
+  for (uint32_t i = 0; i < length; i++)
+  {
+    flash[address + i] &= data[i];
+  }
+  return true;
+}
+
+bool SPIFlash_eraseSector(uint32_t address)
+{
+  if ((address >= flashSize) || ((address % SPIFLASH_SECTOR_SIZE) != 0))
+  {
+    return false;
+  }
+
+  memset(&flash[address], 0xFF, SPIFLASH_SECTOR_SIZE);
+  return true;
+}
+
+#endif /* BASE_PLATFORM */
+
+/**         EOF         */
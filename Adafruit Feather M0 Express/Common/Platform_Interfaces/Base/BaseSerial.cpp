@@ -0,0 +1,276 @@
+/**
+ * \file
+ * \brief Serial ports of the POSIX host platform.
+ *
+ * Serial uses stdin/stdout, Serial1 a pseudo terminal whose name is printed on
+ * begin(). All data is recorded as traffic.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+#include "ConfigPlatform.h"
+
+#ifdef BASE_PLATFORM
+
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+#define BASESERIAL_PORTS 2
+#define BASESERIAL_RX_BUFFER_SIZE 1024
+/* A host write never blocks for long, report the space of the USB endpoint */
+#define BASESERIAL_TX_SPACE 64
+
+typedef struct
+{
+  bool begun;
+  int inFd;
+  int outFd;
+  int ptySlaveFd;
+  uint8_t rxBuffer[BASESERIAL_RX_BUFFER_SIZE];
+  uint16_t rxHead;
+  uint16_t rxTail;
+  uint32_t rxDropped;
+  BaseClock_Source source;
+} BaseSerial_Port;
+
+static BaseSerial_Port ports[BASESERIAL_PORTS];
+
+Serial_ Serial(0);
+HardwareSerial Serial1(1);
+
+/* private function definition */
+static bool BaseSerial_openPty(BaseSerial_Port *p, uint8_t port);
+static void BaseSerial_receive(void *context, uint64_t now);
+static BaseSerial_Port *BaseSerial_port(uint8_t port);
+
+void HardwareSerial::begin(unsigned long baudrate) { begin(baudrate, 0); }
+
+void HardwareSerial::begin(unsigned long baudrate, uint16_t config)
+{
+  (void)baudrate;
+  (void)config;
+  BaseSerial_Port *p = BaseSerial_port(port);
+  if ((p == NULL) || p->begun)
+  {
+    return;
+  }
+
+  p->rxHead = 0;
+  p->rxTail = 0;
+  p->rxDropped = 0;
+  p->ptySlaveFd = -1;
+  if (port == 0)
+  {
+    p->inFd = STDIN_FILENO;
+    p->outFd = STDOUT_FILENO;
+  }
+  else if (!BaseSerial_openPty(p, port))
+  {
+    return;
+  }
+
+  p->source.nextEvent = NULL;
+  p->source.service = BaseSerial_receive;
+  p->source.context = p;
+  p->source.fd = p->inFd;
+  BaseClock_addSource(&p->source);
+  p->begun = true;
+}
+
+void HardwareSerial::end()
+{
+  BaseSerial_Port *p = BaseSerial_port(port);
+  if ((p == NULL) || !p->begun)
+  {
+    return;
+  }
+
+  BaseClock_removeSource(&p->source);
+  if (port != 0)
+  {
+    close(p->inFd);
+    close(p->ptySlaveFd);
+  }
+  p->begun = false;
+}
+
+int HardwareSerial::available()
+{
+  BaseSerial_Port *p = BaseSerial_port(port);
+  if ((p == NULL) || !p->begun)
+  {
+    return 0;
+  }
+
+  BaseSerial_receive(p, BaseClock_now());
+  return (p->rxHead + BASESERIAL_RX_BUFFER_SIZE - p->rxTail) % BASESERIAL_RX_BUFFER_SIZE;
+}
+
+int HardwareSerial::availableForWrite()
+{
+  BaseSerial_Port *p = BaseSerial_port(port);
+  return ((p == NULL) || !p->begun) ? 0 : BASESERIAL_TX_SPACE;
+}
+
+int HardwareSerial::peek()
+{
+  if (available() == 0)
+  {
+    return -1;
+  }
+  BaseSerial_Port *p = BaseSerial_port(port);
+  return p->rxBuffer[p->rxTail];
+}
+
+int HardwareSerial::read()
+{
+  if (available() == 0)
+  {
+    return -1;
+  }
+  BaseSerial_Port *p = BaseSerial_port(port);
+  uint8_t byte = p->rxBuffer[p->rxTail];
+  p->rxTail = (p->rxTail + 1) % BASESERIAL_RX_BUFFER_SIZE;
+  return byte;
+}
+
+void HardwareSerial::flush() {}
+
+size_t HardwareSerial::write(uint8_t byte) { return write(&byte, 1); }
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+  BaseSerial_Port *p = BaseSerial_port(port);
+  if ((p == NULL) || !p->begun || (size == 0))
+  {
+    return 0;
+  }
+
+  /* Data nobody reads from the pseudo terminal is dropped */
+  ssize_t written = ::write(p->outFd, buffer, size);
+  if (written <= 0)
+  {
+    return 0;
+  }
+  BaseTraffic_record(BaseTraffic_SerialTx, port, buffer, (uint32_t)written);
+  return (size_t)written;
+}
+
+HardwareSerial::operator bool()
+{
+  BaseSerial_Port *p = BaseSerial_port(port);
+  return (p != NULL) && p->begun;
+}
+
+static BaseSerial_Port *BaseSerial_port(uint8_t port)
+{
+  return (port < BASESERIAL_PORTS) ? &ports[port] : NULL;
+}
+
+/**
+ * @brief  Open a pseudo terminal in raw mode, the slave side stays open so that clients can come and go
+ * @param  p Port
+ * @param  port Port number
+ * @retval true if successful, false otherwise
+ */
+static bool BaseSerial_openPty(BaseSerial_Port *p, uint8_t port)
+{
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if ((master < 0) || (grantpt(master) != 0) || (unlockpt(master) != 0))
+  {
+    perror("BaseSerial: pseudo terminal");
+    if (master >= 0)
+    {
+      close(master);
+    }
+    return false;
+  }
+
+  const char *name = ptsname(master);
+  int slave = open(name, O_RDWR | O_NOCTTY);
+  if (slave >= 0)
+  {
+    struct termios tio;
+    tcgetattr(slave, &tio);
+    cfmakeraw(&tio);
+    tcsetattr(slave, TCSANOW, &tio);
+  }
+  fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+
+  fprintf(stderr, "Serial%u on %s\n", port, name);
+  p->inFd = master;
+  p->outFd = master;
+  p->ptySlaveFd = slave;
+  return true;
+}
+
+/**
+ * @brief  Read pending input into the receive buffer without blocking
+ * @param  context Port
+ * @param  now Current time
+ * @retval none
+ */
+static void BaseSerial_receive(void *context, uint64_t now)
+{
+  (void)now;
+  BaseSerial_Port *p = (BaseSerial_Port *)context;
+  uint8_t buffer[BASESERIAL_RX_BUFFER_SIZE];
+  struct pollfd pfd = {p->inFd, POLLIN, 0};
+
+  if ((p->source.fd < 0) || (poll(&pfd, 1, 0) <= 0))
+  {
+    return;
+  }
+
+  ssize_t length = ::read(p->inFd, buffer, sizeof(buffer));
+  if (length <= 0)
+  {
+    /* End of input, stop watching the descriptor */
+    if (p == &ports[0])
+    {
+      p->source.fd = -1;
+    }
+    return;
+  }
+
+  uint8_t port = (uint8_t)(p - ports);
+  BaseTraffic_record(BaseTraffic_SerialRx, port, buffer, (uint32_t)length);
+
+  for (ssize_t i = 0; i < length; i++)
+  {
+    uint16_t head = (p->rxHead + 1) % BASESERIAL_RX_BUFFER_SIZE;
+    if (head == p->rxTail)
+    {
+      p->rxDropped += (uint32_t)(length - i);
+      break;
+    }
+    p->rxBuffer[p->rxHead] = buffer[i];
+    p->rxHead = head;
+  }
+}
+
+#endif /* BASE_PLATFORM */
+
+/**         EOF         */
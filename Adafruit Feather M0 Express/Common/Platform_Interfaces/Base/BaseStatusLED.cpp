@@ -0,0 +1,57 @@
+/**
+ * \file
+ * \brief Status LED of the POSIX host platform (ArduinoStatusLED.h interface).
+ *
+ * Every color is recorded as traffic, updates complete immediately.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+#include "ConfigPlatform.h"
+#include "ArduinoStatusLED.h"
+
+#ifdef BASE_PLATFORM
+
+static uint32_t statusColor = 0;
+
+bool StatusLED_init(void)
+{
+  statusColor = 0;
+  return true;
+}
+
+bool StatusLED_deinit(void) { return true; }
+
+bool StatusLED_set(uint32_t color)
+{
+  uint8_t rgb[3] = {(uint8_t)(color >> 16), (uint8_t)(color >> 8), (uint8_t)color};
+  statusColor = color;
+  BaseTraffic_record(BaseTraffic_StatusLED, 0, rgb, sizeof(rgb));
+  return true;
+}
+
+uint32_t StatusLED_get(void) { return statusColor; }
+
+bool StatusLED_isBusy(void) { return false; }
+
+#endif /* BASE_PLATFORM */
+
+/**         EOF         */
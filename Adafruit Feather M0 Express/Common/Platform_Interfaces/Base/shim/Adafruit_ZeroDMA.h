@@ -0,0 +1,120 @@
+/**
+ * \file
+ * \brief DMA controller of the POSIX host platform (Adafruit_ZeroDMA interface).
+ *
+ * Transfers to a SERCOM take the time of its SPI clock and are recorded as
+ * traffic, see BasePlatform.h.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+
+#ifndef BASE_ADAFRUIT_ZERODMA_H
+#define BASE_ADAFRUIT_ZERODMA_H
+
+/**         Includes         */
+#include "Arduino.h"
+
+/* Channels of the DMA controller */
+#define DMAC_CH_NUM 12
+/* Descriptors per channel */
+#define BASEDMA_MAX_DESCRIPTORS 4
+
+enum ZeroDMAstatus
+{
+  DMA_STATUS_OK = 0,
+  DMA_STATUS_ERR_NOT_FOUND,
+  DMA_STATUS_ERR_NOT_INITIALIZED,
+  DMA_STATUS_ERR_INVALID_ARG,
+  DMA_STATUS_ERR_IO,
+  DMA_STATUS_ERR_TIMEOUT,
+  DMA_STATUS_BUSY,
+  DMA_STATUS_SUSPEND,
+  DMA_STATUS_ABORTED,
+  DMA_STATUS_JOBSTATUS = -1
+};
+
+enum dma_beat_size
+{
+  DMA_BEAT_SIZE_BYTE = 0,
+  DMA_BEAT_SIZE_HWORD,
+  DMA_BEAT_SIZE_WORD
+};
+
+enum dma_transfer_trigger_action
+{
+  DMA_TRIGGER_ACTON_BLOCK = 0,
+  DMA_TRIGGER_ACTON_BEAT = 2,
+  DMA_TRIGGER_ACTON_TRANSACTION = 3
+};
+
+enum dma_callback_type
+{
+  DMA_CALLBACK_TRANSFER_DONE = 0,
+  DMA_CALLBACK_TRANSFER_ERROR,
+  DMA_CALLBACK_CHANNEL_SUSPEND,
+  DMA_CALLBACK_N
+};
+
+/* Descriptor with the fields of the DMAC descriptor in plain form */
+typedef struct DmacDescriptor
+{
+  void *source;
+  void *destination;
+  uint32_t beats;
+  uint8_t beatSize; /* Bytes per beat */
+  bool sourceIncrement;
+  bool destinationIncrement;
+} DmacDescriptor;
+
+/* A job runs over all descriptors of the channel, a looping job starts over after the last one.
+ * Each pass is recorded as BaseTraffic_DMA, passes of a looping job only if the data changed.
+ * The callback is called at the end of a job that does not loop. */
+class Adafruit_ZeroDMA
+{
+public:
+  Adafruit_ZeroDMA(void);
+  ZeroDMAstatus allocate(void);
+  ZeroDMAstatus free(void);
+  ZeroDMAstatus startJob(void);
+  void abort(void);
+  void setTrigger(uint8_t trigger);
+  void setAction(dma_transfer_trigger_action action);
+  void loop(const bool flag);
+  void setCallback(void (*callback)(Adafruit_ZeroDMA *) = NULL, dma_callback_type type = DMA_CALLBACK_TRANSFER_DONE);
+  DmacDescriptor *addDescriptor(void *src, void *dst, uint32_t count = 0, dma_beat_size size = DMA_BEAT_SIZE_BYTE,
+                                bool srcInc = true, bool dstInc = false, uint32_t stepSize = 0, bool stepSel = false);
+  void changeDescriptor(DmacDescriptor *d, void *src = NULL, void *dst = NULL, uint32_t count = 0);
+  bool isActive(void);
+  uint8_t getChannel(void);
+
+private:
+  friend struct BaseDMA_Channel;
+
+  uint8_t channel; /* 0xFF if not allocated */
+  uint8_t trigger;
+  bool looping;
+  void (*callback)(Adafruit_ZeroDMA *);
+  DmacDescriptor descriptors[BASEDMA_MAX_DESCRIPTORS];
+  uint8_t descriptorCount;
+};
+
+#endif /* BASE_ADAFRUIT_ZERODMA_H */
@@ -0,0 +1,139 @@
+/**
+ * \file
+ * \brief Arduino core subset for the POSIX host platform.
+ *
+ * The emulated core runs the firmware of the Adafruit feather M0 board as a
+ * Linux process, see BasePlatform.h.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+
+#ifndef BASE_ARDUINO_H
+#define BASE_ARDUINO_H
+
+/**         Includes         */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+#define INPUT_PULLDOWN 0x3
+
+#define CHANGE 2
+#define FALLING 3
+#define RISING 4
+
+/* Emulated pins, numbered like the Arduino pins of the Feather */
+#define PINS_COUNT 64
+#define NOT_AN_INTERRUPT -1
+#define digitalPinToInterrupt(P) (P)
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+/**         Functions definition         */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  typedef void (*voidFuncPtr)(void);
+
+  /* Time of the host clock (BaseClock_now()). Delays let the emulated peripherals run. */
+  unsigned long millis(void);
+  unsigned long micros(void);
+  void delay(unsigned long ms);
+  void delayMicroseconds(unsigned int us);
+  void yield(void);
+
+  void pinMode(uint32_t pin, uint32_t mode);
+  void digitalWrite(uint32_t pin, uint32_t value);
+  int digitalRead(uint32_t pin);
+  /* Inputs are changed with BasePin_setInput() */
+  void attachInterrupt(uint32_t pin, voidFuncPtr callback, uint32_t mode);
+  void detachInterrupt(uint32_t pin);
+
+  /* Events of the emulated peripherals are handled like interrupts: only while the mask is
+   * clear, pending events are handled as soon as it is cleared. */
+  uint32_t __get_PRIMASK(void);
+  void __set_PRIMASK(uint32_t primask);
+  void __disable_irq(void);
+  void __enable_irq(void);
+  /* Waits for the next event, also with the mask set */
+  void __WFI(void);
+  /* Restarts the process */
+  void NVIC_SystemReset(void);
+
+  void setup(void);
+  void loop(void);
+
+#ifdef __cplusplus
+}
+
+/* Serial port on the host: port 0 uses stdin/stdout, port 1 a pseudo terminal.
+ * The state is kept per port in BaseSerial.cpp. */
+class HardwareSerial
+{
+public:
+  HardwareSerial(uint8_t port) : port(port) {}
+  void begin(unsigned long baudrate);
+  void begin(unsigned long baudrate, uint16_t config);
+  void end();
+  int available();
+  int availableForWrite();
+  int peek();
+  int read();
+  void flush();
+  size_t write(uint8_t byte);
+  size_t write(const uint8_t *buffer, size_t size);
+  size_t write(const char *buffer, size_t size) { return write((const uint8_t *)buffer, size); }
+  size_t write(const char *str) { return write((const uint8_t *)str, strlen(str)); }
+  operator bool();
+
+private:
+  uint8_t port;
+};
+
+/* USB serial port of the Arduino core */
+class Serial_ : public HardwareSerial
+{
+public:
+  Serial_(uint8_t port) : HardwareSerial(port) {}
+};
+
+extern Serial_ Serial;
+extern HardwareSerial Serial1;
+
+#endif /* __cplusplus */
+
+#endif /* BASE_ARDUINO_H */
@@ -0,0 +1,142 @@
+/**
+ * \file
+ * \brief SPI library of the POSIX host platform.
+ *
+ * Transfers are recorded as traffic, see BasePlatform.h. There is no device
+ * on the bus, MISO reads 0xFF.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+
+#ifndef BASE_SPI_H
+#define BASE_SPI_H
+
+/**         Includes         */
+#include "Arduino.h"
+#include "Adafruit_ZeroDMA.h"
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#define SPI_MODE0 0x02
+#define SPI_MODE1 0x00
+#define SPI_MODE2 0x03
+#define SPI_MODE3 0x01
+
+#define SERCOM_INST_NUM 6
+
+/* DMA triggers of the SERCOMs */
+#define SERCOM0_DMAC_ID_RX 0x01
+#define SERCOM0_DMAC_ID_TX 0x02
+#define SERCOM1_DMAC_ID_RX 0x03
+#define SERCOM1_DMAC_ID_TX 0x04
+#define SERCOM2_DMAC_ID_RX 0x05
+#define SERCOM2_DMAC_ID_TX 0x06
+#define SERCOM3_DMAC_ID_RX 0x07
+#define SERCOM3_DMAC_ID_TX 0x08
+#define SERCOM4_DMAC_ID_RX 0x09
+#define SERCOM4_DMAC_ID_TX 0x0A
+#define SERCOM5_DMAC_ID_RX 0x0B
+#define SERCOM5_DMAC_ID_TX 0x0C
+
+typedef enum
+{
+  SPI_PAD_0_SCK_1 = 0,
+  SPI_PAD_2_SCK_3,
+  SPI_PAD_3_SCK_1,
+  SPI_PAD_0_SCK_3
+} SercomSpiTXPad;
+
+typedef enum
+{
+  SERCOM_RX_PAD_0 = 0,
+  SERCOM_RX_PAD_1,
+  SERCOM_RX_PAD_2,
+  SERCOM_RX_PAD_3
+} SercomRXPad;
+
+/* Registers of a SERCOM, only the data register as DMA source or destination */
+typedef union
+{
+  struct
+  {
+    struct
+    {
+      volatile uint32_t reg;
+    } DATA;
+  } SPI;
+} Sercom;
+
+extern Sercom BaseSercomRegisters[SERCOM_INST_NUM];
+
+#define SERCOM0 (&BaseSercomRegisters[0])
+#define SERCOM1 (&BaseSercomRegisters[1])
+#define SERCOM2 (&BaseSercomRegisters[2])
+#define SERCOM3 (&BaseSercomRegisters[3])
+#define SERCOM4 (&BaseSercomRegisters[4])
+#define SERCOM5 (&BaseSercomRegisters[5])
+
+class SERCOM
+{
+public:
+  SERCOM(uint8_t index) : index(index), clock(0) {}
+  uint8_t index;
+  uint32_t clock; /* SPI clock of the running transaction, 0 if none */
+};
+
+extern SERCOM sercom0;
+extern SERCOM sercom1;
+extern SERCOM sercom2;
+extern SERCOM sercom3;
+extern SERCOM sercom4;
+extern SERCOM sercom5;
+
+class SPISettings
+{
+public:
+  SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) : clock(clock), bitOrder(bitOrder), dataMode(dataMode) {}
+  SPISettings() : clock(4000000), bitOrder(MSBFIRST), dataMode(SPI_MODE0) {}
+  uint32_t clock;
+  uint8_t bitOrder;
+  uint8_t dataMode;
+};
+
+class SPIClass
+{
+public:
+  SPIClass(SERCOM *sercom, uint8_t pinMISO, uint8_t pinSCK, uint8_t pinMOSI, SercomSpiTXPad padTx, SercomRXPad padRx);
+  void begin();
+  void end();
+  void beginTransaction(SPISettings settings);
+  void endTransaction();
+  uint8_t transfer(uint8_t data);
+  uint16_t transfer16(uint16_t data);
+  void transfer(void *buffer, size_t size);
+
+private:
+  SERCOM *sercom;
+  uint8_t pinMOSI;
+};
+
+extern SPIClass SPI;
+
+#endif /* BASE_SPI_H */
@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \brief Pin multiplexing of the Arduino core on the POSIX host platform.
+ *
+ * Peripheral functions are only recorded per pin, see BasePlatform.h.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+
+#ifndef BASE_WIRING_PRIVATE_H
+#define BASE_WIRING_PRIVATE_H
+
+/**         Includes         */
+#include "Arduino.h"
+
+typedef enum _EPioType
+{
+  PIO_NOT_A_PIN = -1,
+  PIO_EXTINT = 0,
+  PIO_ANALOG,
+  PIO_SERCOM,
+  PIO_SERCOM_ALT,
+  PIO_TIMER,
+  PIO_TIMER_ALT,
+  PIO_COM,
+  PIO_AC_CLK,
+  PIO_DIGITAL,
+  PIO_INPUT,
+  PIO_INPUT_PULLUP,
+  PIO_OUTPUT
+} EPioType;
+
+/**         Functions definition         */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  int pinPeripheral(uint32_t pin, EPioType peripheral);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BASE_WIRING_PRIVATE_H */
@@ -3,14 +3,119 @@
 
 /**         Includes         */
 
+/* POSIX host platform: the Arduino core, SPI, DMA, I2C, SPI flash and status LED of the Feather
+ * are emulated (Platform_Interfaces/Base), so the firmware runs as a Linux process on top of the
+ * Arduino platform functions. Build with -D BASE_PLATFORM and Platform_Interfaces/Base/shim first
+ * on the include path, see Platform_Interfaces/README.md. */
+
+#include <stdint.h>
+#include <stdio.h>
+#include "ArduinoPlatform.h"
+
+/* The microsecond functions of global.h run on the host clock */
+#define WE_MICROSECOND_TICK
+
 /**         Functions definition         */
 
 #ifdef __cplusplus
-extern "C" {
+extern "C"
+{
 #endif
 
+    /* Host clock. The real clock follows CLOCK_MONOTONIC. The simulated clock only advances while
+     * the firmware waits (delays, __WFI(), idle) and then jumps right to the next event, so runs are
+     * reproducible and take no longer than the computation. Busy loops polling the clock do not
+     * end with the simulated clock. */
+    typedef enum
+    {
+        BaseClock_Real,
+        BaseClock_Simulated
+    } BaseClock_Mode;
+
+    /* Source of events, the host counterpart of a peripheral interrupt */
+    typedef struct BaseClock_Source
+    {
+        /* Time of the next event in microseconds, UINT64_MAX if none */
+        uint64_t (*nextEvent)(void *context);
+        /* Handles the events that are due, like an interrupt handler */
+        void (*service)(void *context, uint64_t now);
+        void *context;
+        /* Ends a wait when readable (serviced with the interrupt mask ignored, so the service
+         * may only buffer the data), -1 if none */
+        int fd;
+        struct BaseClock_Source *next;
+    } BaseClock_Source;
+
+    /* Selects the clock, before setup() */
+    void BaseClock_setMode(BaseClock_Mode mode);
+    BaseClock_Mode BaseClock_getMode(void);
+    /* Microseconds since start */
+    uint64_t BaseClock_now(void);
+    /* The process exits when the clock reaches the time, 0 to run forever */
+    void BaseClock_setEndTime(uint64_t time);
+    void BaseClock_addSource(BaseClock_Source *source);
+    void BaseClock_removeSource(BaseClock_Source *source);
+    /* Handles the events that are due unless the interrupt mask is set */
+    void BaseClock_poll(void);
+    /* Waits until the given time, events are handled meanwhile */
+    void BaseClock_waitUntil(uint64_t time);
+    /* Waits for the next event */
+    void BaseClock_waitForEvent(void);
+    /* True while the events are handled, the host counterpart of an interrupt context */
+    bool BaseClock_inInterrupt(void);
+
+    /* Traffic of the emulated peripherals */
+    typedef enum
+    {
+        BaseTraffic_I2CWrite,  /* channel: 7 bit address */
+        BaseTraffic_I2CRead,   /* channel: 7 bit address */
+        BaseTraffic_SPI,       /* channel: SERCOM */
+        BaseTraffic_DMA,       /* channel: DMA trigger, e.g. SERCOM5_DMAC_ID_TX */
+        BaseTraffic_SerialTx,  /* channel: serial port */
+        BaseTraffic_SerialRx,  /* channel: serial port */
+        BaseTraffic_Pin,       /* channel: pin, data: level of an output */
+        BaseTraffic_StatusLED, /* data: R, G, B */
+        BaseTraffic_Count
+    } BaseTraffic_Type;
+
+    typedef struct
+    {
+        uint64_t time; /* BaseClock_now() */
+        BaseTraffic_Type type;
+        uint32_t channel;
+        const uint8_t *data;
+        uint32_t length;
+    } BaseTraffic_Record;
+
+    typedef struct
+    {
+        uint32_t records[BaseTraffic_Count];
+        uint64_t bytes[BaseTraffic_Count];
+    } BaseTraffic_Stats;
+
+    typedef void (*BaseTraffic_Handler)(const BaseTraffic_Record *record, void *context);
+
+    /* Called for every record, e.g. by a regression test, NULL to remove */
+    void BaseTraffic_setHandler(BaseTraffic_Handler handler, void *context);
+    /* Writes every record as a text line: time, type, channel, length, data in hex */
+    bool BaseTraffic_openLog(const char *path);
+    void BaseTraffic_record(BaseTraffic_Type type, uint32_t channel, const uint8_t *data, uint32_t length);
+    const BaseTraffic_Stats *BaseTraffic_getStats(void);
+    void BaseTraffic_printStats(FILE *file);
+
+    /* Sets the level of an input pin, attached interrupts run like those of a pin change */
+    void BasePin_setInput(uint8_t pin, uint8_t level);
+    uint8_t BasePin_getOutput(uint8_t pin);
+
+    /* Keeps the SPI flash content in a file, created if missing. Default is an erased flash in RAM. */
+    bool BaseSPIFlash_open(const char *path);
+
+    /* Parses the command line options, see BasePlatform_usage(). Returns false on invalid options. */
+    bool BasePlatform_init(int argc, char *argv[]);
+    void BasePlatform_usage(const char *name);
+
 #ifdef __cplusplus
 }
 #endif
 
-#endif /* BASEPLATFORM_H */
\ No newline at end of file
+#endif /* BASEPLATFORM_H */
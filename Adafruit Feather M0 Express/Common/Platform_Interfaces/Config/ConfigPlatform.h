@@ -3,7 +3,10 @@
 
 /**         Includes         */
 
+/* BASE_PLATFORM (POSIX host) is selected on the command line, Arduino otherwise */
+#ifndef BASE_PLATFORM
 #define ARDUINO_PLATFORM 1
+#endif
 
 #ifndef SERIAL_DEBUG
 #define SERIAL_DEBUG 1
@@ -40,6 +40,7 @@
 #include "calib_execution.h"
 #include "atca_devtypes.h"
 #include "hal/atca_hal.h"
+#include "profile.h"
 
 #ifdef ATCA_NO_POLL
 // *INDENT-OFF* - Preserve time formatting from the code formatter
@@ -295,11 +296,14 @@ ATCA_STATUS calib_execute_command(ATCAPacket* packet, ATCADevice device)
     uint16_t rxsize;
     uint8_t word_address = 0xFF;
 
+    WE_PROFILE_BEGIN(WE_PROFILE_ZONE_ATCA_COMMAND);
+
     do
     {
 #ifdef ATCA_NO_POLL
         if ((status = calib_get_execution_time(packet->opcode, device->mCommands)) != ATCA_SUCCESS)
         {
+            WE_PROFILE_END(WE_PROFILE_ZONE_ATCA_COMMAND);
             return status;
         }
         execution_or_wait_time = device->mCommands->execution_time_msec;
@@ -376,5 +380,6 @@ ATCA_STATUS calib_execute_command(ATCAPacket* packet, ATCADevice device)
     while (0);
 
     atidle(device->mIface);
+    WE_PROFILE_END(WE_PROFILE_ZONE_ATCA_COMMAND);
     return status;
 }
\ No newline at end of file
@@ -26,6 +26,7 @@
  */
 
 #include "ConfigPlatform.h"
+#include "global.h"
 #include "atca_hal.h"
 
 /** \defgroup hal_ Hardware abstraction layer (hal_)
@@ -41,8 +42,8 @@
  */
 void atca_delay_us(uint32_t delay)
 {
-  // use Arduino supplied delay
-  delayMicroseconds(delay);
+  // wait on the microsecond time base of global.h, it is exact to about a microsecond
+  WE_DelayMicroseconds(delay);
 }
 
 /** \brief This function delays for a number of tens of microseconds.
@@ -51,8 +52,8 @@ void atca_delay_us(uint32_t delay)
  */
 void atca_delay_10us(uint32_t delay)
 {
-  // use Arduino supplied delay
-  delayMicroseconds(delay * 10);
+  // same time base as atca_delay_us()
+  WE_DelayMicroseconds(delay * 10);
 }
 
 /** \brief This function delays for a number of milliseconds.
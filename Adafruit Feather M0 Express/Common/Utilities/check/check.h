@@ -0,0 +1,99 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Failure counting and result reporting of the host check programs in Common/Utilities.
+ *
+ * Every check program is a single translation unit that includes this header once, prints
+ * each failed condition with "FAIL:" and returns checkResult() from main().
+ */
+
+#ifndef CHECK_H_INCLUDED
+#define CHECK_H_INCLUDED
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+/* Number of failures that are printed, further failures are only counted */
+#ifndef CHECK_MAX_REPORTED
+#define CHECK_MAX_REPORTED 10
+#endif
+
+static unsigned checkFailures = 0;
+
+/**
+ * @brief Count a failure and print its description.
+ *
+ * @param[in] format printf format of the description, followed by its arguments
+ */
+static inline void checkFail(const char *format, ...)
+{
+    if (checkFailures++ < CHECK_MAX_REPORTED)
+    {
+        va_list args;
+        va_start(args, format);
+        printf("FAIL: ");
+        vprintf(format, args);
+        printf("\n");
+        va_end(args);
+    }
+}
+
+/**
+ * @brief Count and print a failure if the condition does not hold.
+ *
+ * @param[in] condition Checked condition
+ * @param[in] what Description of the condition
+ * @return condition
+ */
+static inline bool check(bool condition, const char *what)
+{
+    if (!condition)
+    {
+        checkFail("%s", what);
+    }
+    return condition;
+}
+
+/**
+ * @brief Print the result of the check program.
+ *
+ * @return Exit code of the program: 0 if every check passed, 1 otherwise
+ */
+static inline int checkResult(void)
+{
+    if (0 != checkFailures)
+    {
+        printf("%u failures\n", checkFailures);
+        return 1;
+    }
+
+    printf("OK\n");
+    return 0;
+}
+
+#endif /* CHECK_H_INCLUDED */
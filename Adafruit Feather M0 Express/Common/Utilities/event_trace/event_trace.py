@@ -0,0 +1,247 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+#
+# THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED "AS IS". FOR MORE INFORMATION PLEASE
+# CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED IN THE ROOT DIRECTORY OF THIS PACKAGE.
+#
+"""Converter for event trace dumps (WE_EVENT_TRACE) into Chrome trace JSON.
+
+WE_EventTrace_Dump() (debug serial command 't') writes the event ring buffer as text lines
+(see Common/Hardware_Libraries/global/event_trace.h):
+
+    WE_EVENT_TRACE <version> <cycles per us> <events recorded> <events in dump>
+    WE_EVENT_NAME <id> <name>
+    WE_EVENT_DATA <hex, 8 bytes per event: time (u32 LE), type, id, value (u16 LE)>
+    WE_EVENT_END
+
+This script converts a dump into the Chrome trace event format, which chrome://tracing and
+https://ui.perfetto.dev display as timeline. Sections recorded in interrupt context are shown
+on the "interrupts" track, the others on the "main" track. Sections that begin and end in
+different contexts or overlap other sections (e.g. an ICLED frame started by the main loop
+and completed by the DMA interrupt) are shown as async events.
+
+    event_trace.py convert <trace.json> [serial device | capture file]
+        Converts the last complete dump in the capture (default: stdin). A serial device is
+        sent 't' and read until the dump is complete.
+
+    event_trace.py summary [serial device | capture file]
+        Prints count, total and maximum duration per section.
+"""
+
+import json
+import os
+import stat
+import struct
+import sys
+
+HEADER = 'WE_EVENT_TRACE'
+NAME = 'WE_EVENT_NAME'
+DATA = 'WE_EVENT_DATA'
+END = 'WE_EVENT_END'
+
+VERSION = 1
+EVENT_SIZE = 8
+FLAG_ISR = 0x80
+TYPE_BEGIN, TYPE_END, TYPE_MARK, TYPE_COUNTER = range(4)
+
+PID = 1
+TID_MAIN = 1
+TID_ISR = 2
+
+
+class Dump:
+    def __init__(self, fields):
+        if len(fields) < 4 or int(fields[0]) != VERSION:
+            raise ValueError('unsupported dump header: %s' % ' '.join(fields))
+        self.cycles_per_us = int(fields[1])
+        self.recorded = int(fields[2])
+        self.count = int(fields[3])
+        self.names = {}
+        self.events = []
+
+    def name(self, event_id):
+        return self.names.get(event_id, 'event-%d' % event_id)
+
+
+def read_dumps(stream, stop_after_first):
+    """Complete dumps found in the stream, other lines are skipped."""
+    dumps = []
+    current = None
+    for raw in stream:
+        line = raw.decode('latin-1').strip()
+        # A dump may follow other output on the same line
+        start = line.find('WE_EVENT')
+        if start < 0:
+            continue
+        fields = line[start:].split()
+        if fields[0] == HEADER:
+            current = Dump(fields[1:])
+        elif current is None:
+            continue
+        elif fields[0] == NAME and len(fields) >= 3:
+            current.names[int(fields[1])] = ' '.join(fields[2:])
+        elif fields[0] == DATA and len(fields) >= 2:
+            data = bytes.fromhex(fields[1])
+            for offset in range(0, len(data) - EVENT_SIZE + 1, EVENT_SIZE):
+                current.events.append(struct.unpack_from('<IBBH', data, offset))
+        elif fields[0] == END:
+            if len(current.events) != current.count:
+                sys.stderr.write('dump is incomplete (%d of %d events), skipped\n' % (len(current.events), current.count))
+            else:
+                dumps.append(current)
+                if stop_after_first:
+                    break
+            current = None
+    return dumps
+
+
+def timestamps(dump):
+    """Event times in microseconds since the oldest event, the 32 bit cycle counter is unwrapped."""
+    times = []
+    total = 0
+    previous = None
+    for time, _, _, _ in dump.events:
+        if previous is not None:
+            delta = (time - previous) & 0xFFFFFFFF
+            # Events are stored in order, a small step back is a timestamp race and counts as 0
+            total += delta if delta < 0x80000000 else 0
+        previous = time
+        times.append(total / dump.cycles_per_us)
+    return times
+
+
+def sections(dump):
+    """Matched begin/end pairs as (name, begin us, end us, begin tid, end tid), open sections and instant events."""
+    times = timestamps(dump)
+    open_sections = {}
+    pairs = []
+    others = []
+    for (time, kind, event_id, value), ts in zip(dump.events, times):
+        tid = TID_ISR if kind & FLAG_ISR else TID_MAIN
+        kind &= ~FLAG_ISR
+        if kind == TYPE_BEGIN:
+            open_sections[event_id] = (ts, tid)
+        elif kind == TYPE_END:
+            # Ends without begin started before the oldest event in the dump
+            if event_id in open_sections:
+                begin, begin_tid = open_sections.pop(event_id)
+                pairs.append((dump.name(event_id), begin, ts, begin_tid, tid))
+        else:
+            others.append((kind, dump.name(event_id), ts, tid, value))
+    unfinished = [(dump.name(event_id), begin, tid) for event_id, (begin, tid) in open_sections.items()]
+    return pairs, unfinished, others, (times[-1] if times else 0)
+
+
+def async_names(pairs):
+    """Sections shown as async events: those that begin and end in different contexts and those
+    that overlap another section on their track without nesting (the longer one of both)."""
+    names = {name for name, _, _, begin_tid, end_tid in pairs if begin_tid != end_tid}
+    while True:
+        conflict = None
+        for tid in (TID_MAIN, TID_ISR):
+            stack = []
+            for begin, end, name in sorted((begin, end, name) for name, begin, end, begin_tid, _ in pairs
+                                           if begin_tid == tid and name not in names):
+                while stack and stack[-1][0] <= begin:
+                    stack.pop()
+                if stack and end > stack[-1][0]:
+                    conflict = stack[-1][1]
+                    break
+                stack.append((end, name))
+            if conflict is not None:
+                break
+        if conflict is None:
+            return names
+        names.add(conflict)
+
+
+def to_chrome(dump):
+    pairs, unfinished, others, last = sections(dump)
+    events = [
+        {'ph': 'M', 'pid': PID, 'name': 'process_name', 'args': {'name': 'ICLED SDK'}},
+        {'ph': 'M', 'pid': PID, 'tid': TID_MAIN, 'name': 'thread_name', 'args': {'name': 'main'}},
+        {'ph': 'M', 'pid': PID, 'tid': TID_ISR, 'name': 'thread_name', 'args': {'name': 'interrupts'}},
+    ]
+    shown_async = async_names(pairs)
+    for index, (name, begin, end, begin_tid, end_tid) in enumerate(pairs):
+        if name not in shown_async:
+            events.append({'ph': 'X', 'pid': PID, 'tid': begin_tid, 'name': name, 'ts': begin, 'dur': end - begin})
+        else:
+            events.append({'ph': 'b', 'pid': PID, 'tid': begin_tid, 'cat': 'async', 'id': index, 'name': name, 'ts': begin})
+            events.append({'ph': 'e', 'pid': PID, 'tid': end_tid, 'cat': 'async', 'id': index, 'name': name, 'ts': end})
+    for name, begin, tid in unfinished:
+        events.append({'ph': 'X', 'pid': PID, 'tid': tid, 'name': name, 'ts': begin, 'dur': last - begin, 'args': {'unfinished': True}})
+    for kind, name, ts, tid, value in others:
+        if kind == TYPE_MARK:
+            events.append({'ph': 'i', 's': 't', 'pid': PID, 'tid': tid, 'name': name, 'ts': ts, 'args': {'value': value}})
+        elif kind == TYPE_COUNTER:
+            events.append({'ph': 'C', 'pid': PID, 'name': name, 'ts': ts, 'args': {name: value}})
+    return {
+        'traceEvents': events,
+        'displayTimeUnit': 'ns',
+        'otherData': {'recorded': dump.recorded, 'overwritten': dump.recorded - dump.count},
+    }
+
+
+def summary(dump, output):
+    pairs, _, others, last = sections(dump)
+    stats = {}
+    for name, begin, end, _, _ in pairs:
+        count, total, longest = stats.get(name, (0, 0.0, 0.0))
+        stats[name] = (count + 1, total + end - begin, max(longest, end - begin))
+    for _, name, _, _, _ in others:
+        count, total, longest = stats.get(name, (0, 0.0, 0.0))
+        stats[name] = (count + 1, total, longest)
+
+    output.write('%d events over %.1f ms, %d older events overwritten\n\n' % (dump.count, last / 1000, dump.recorded - dump.count))
+    output.write('%-16s %8s %12s %12s %12s\n' % ('event', 'count', 'total [us]', 'avg [us]', 'max [us]'))
+    for name, (count, total, longest) in sorted(stats.items(), key=lambda item: -item[1][1]):
+        output.write('%-16s %8d %12.1f %12.2f %12.2f\n' % (name, count, total, total / count, longest))
+
+
+def open_input(path):
+    """Input stream and whether it is a serial device that has to be asked for the dump."""
+    if path is None:
+        return sys.stdin.buffer, False
+    if stat.S_ISCHR(os.stat(path).st_mode):
+        stream = open(path, 'r+b', buffering=0)
+        stream.write(b't')
+        return stream, True
+    return open(path, 'rb'), False
+
+
+def last_dump(path):
+    stream, device = open_input(path)
+    try:
+        dumps = read_dumps(stream, device)
+    finally:
+        if stream is not sys.stdin.buffer:
+            stream.close()
+    if not dumps:
+        raise ValueError('no complete event trace dump found')
+    return dumps[-1]
+
+
+def main(argv):
+    if len(argv) >= 3 and argv[1] == 'convert':
+        dump = last_dump(argv[3] if len(argv) >= 4 else None)
+        with open(argv[2], 'w') as f:
+            json.dump(to_chrome(dump), f)
+        return 0
+
+    if len(argv) >= 2 and argv[1] == 'summary':
+        summary(last_dump(argv[2] if len(argv) >= 3 else None), sys.stdout)
+        return 0
+
+    sys.stderr.write('usage: %s convert <trace.json> [serial device | capture file]\n'
+                     '       %s summary [serial device | capture file]\n' % (argv[0], argv[0]))
+    return 2
+
+
+if __name__ == '__main__':
+    try:
+        sys.exit(main(sys.argv))
+    except (OSError, ValueError) as error:
+        sys.stderr.write('%s\n' % error)
+        sys.exit(1)
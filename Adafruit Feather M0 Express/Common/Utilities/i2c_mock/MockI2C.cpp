@@ -0,0 +1,222 @@
+/**
+ * \file
+ * \brief Host mock of the I2C transaction engine.
+ *
+ * Simulates register based I2C devices on the host and counts the bus
+ * transactions, so code using ArduinoI2C.h can be tested without hardware.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+#include <string.h>
+#include <stddef.h>
+#include "MockI2C.h"
+
+typedef struct
+{
+  bool present;
+  uint8_t address;
+  uint8_t pointer;
+  uint8_t registers[MOCKI2C_REGISTERS];
+} MockI2C_Device;
+
+static MockI2C_Device devices[MOCKI2C_MAX_DEVICES];
+static MockI2C_Stats stats;
+static I2CAsync_Transaction *queueHead = NULL;
+static I2CAsync_Transaction *queueTail = NULL;
+static bool initialized = false;
+static MockI2C_Monitor monitor = NULL;
+
+/* private function definition */
+static MockI2C_Device *MockI2C_find(uint8_t address);
+static void MockI2C_write(MockI2C_Device *device, const uint8_t *data, uint16_t length, bool *first);
+static int8_t MockI2C_execute(I2CAsync_Transaction *transaction);
+
+void MockI2C_reset(void)
+{
+  memset(devices, 0, sizeof(devices));
+  memset(&stats, 0, sizeof(stats));
+  queueHead = NULL;
+  queueTail = NULL;
+}
+
+bool MockI2C_addDevice(uint8_t address)
+{
+  for (int i = 0; i < MOCKI2C_MAX_DEVICES; i++)
+  {
+    if (!devices[i].present)
+    {
+      devices[i].present = true;
+      devices[i].address = address;
+      return true;
+    }
+  }
+  return false;
+}
+
+uint8_t *MockI2C_registers(uint8_t address)
+{
+  MockI2C_Device *device = MockI2C_find(address);
+  return (device == NULL) ? NULL : device->registers;
+}
+
+void MockI2C_run(void)
+{
+  while (queueHead != NULL)
+  {
+    I2CAsync_Transaction *transaction = queueHead;
+    queueHead = transaction->next;
+    if (queueHead == NULL)
+    {
+      queueTail = NULL;
+    }
+    transaction->status = MockI2C_execute(transaction);
+    if (monitor != NULL)
+    {
+      monitor(transaction);
+    }
+    if (transaction->callback != NULL)
+    {
+      transaction->callback(transaction);
+    }
+  }
+}
+
+const MockI2C_Stats *MockI2C_getStats(void) { return &stats; }
+
+void MockI2C_setMonitor(MockI2C_Monitor newMonitor) { monitor = newMonitor; }
+
+bool I2CAsync_init(uint32_t clock)
+{
+  (void)clock;
+  initialized = true;
+  return true;
+}
+
+bool I2CAsync_setClock(uint32_t clock)
+{
+  (void)clock;
+  MockI2C_run();
+  return initialized;
+}
+
+bool I2CAsync_submit(I2CAsync_Transaction *transaction)
+{
+  if (!initialized || (transaction == NULL) ||
+      ((transaction->txPrefixLength > 0) && (transaction->txPrefix == NULL)) ||
+      ((transaction->txLength > 0) && (transaction->txData == NULL)) ||
+      ((transaction->rxLength > 0) && (transaction->rxData == NULL)))
+  {
+    return false;
+  }
+
+  transaction->status = I2CASYNC_PENDING;
+  transaction->next = NULL;
+  if (queueTail == NULL)
+  {
+    queueHead = transaction;
+  }
+  else
+  {
+    queueTail->next = transaction;
+  }
+  queueTail = transaction;
+  return true;
+}
+
+bool I2CAsync_isIdle(void) { return queueHead == NULL; }
+
+int8_t I2CAsync_wait(I2CAsync_Transaction *transaction, uint32_t timeout_ms)
+{
+  (void)timeout_ms;
+  MockI2C_run();
+  return transaction->status;
+}
+
+void I2CAsync_reset(void)
+{
+  while (queueHead != NULL)
+  {
+    I2CAsync_Transaction *transaction = queueHead;
+    queueHead = transaction->next;
+    transaction->status = WE_FAIL;
+    if (transaction->callback != NULL)
+    {
+      transaction->callback(transaction);
+    }
+  }
+  queueTail = NULL;
+}
+
+static MockI2C_Device *MockI2C_find(uint8_t address)
+{
+  for (int i = 0; i < MOCKI2C_MAX_DEVICES; i++)
+  {
+    if (devices[i].present && (devices[i].address == address))
+    {
+      return &devices[i];
+    }
+  }
+  return NULL;
+}
+
+/**
+ * @brief  Write phase: the first byte sets the register pointer, the following bytes are stored
+ */
+static void MockI2C_write(MockI2C_Device *device, const uint8_t *data, uint16_t length, bool *first)
+{
+  for (uint16_t i = 0; i < length; i++)
+  {
+    if (*first)
+    {
+      device->pointer = data[i];
+      *first = false;
+    }
+    else
+    {
+      device->registers[device->pointer++] = data[i];
+      stats.bytesWritten++;
+    }
+  }
+}
+
+static int8_t MockI2C_execute(I2CAsync_Transaction *transaction)
+{
+  MockI2C_Device *device = MockI2C_find(transaction->address);
+
+  stats.transactions++;
+  if (device == NULL)
+  {
+    stats.failed++;
+    return WE_FAIL;
+  }
+
+  bool first = true;
+  MockI2C_write(device, transaction->txPrefix, transaction->txPrefixLength, &first);
+  MockI2C_write(device, transaction->txData, transaction->txLength, &first);
+
+  for (uint16_t i = 0; i < transaction->rxLength; i++)
+  {
+    transaction->rxData[i] = device->registers[device->pointer++];
+    stats.bytesRead++;
+  }
+  return WE_SUCCESS;
+}
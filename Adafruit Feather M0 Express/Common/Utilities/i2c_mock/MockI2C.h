@@ -0,0 +1,69 @@
+/**
+ * \file
+ * \brief Host mock of the I2C transaction engine.
+ *
+ * Simulates register based I2C devices on the host and counts the bus
+ * transactions, so code using ArduinoI2C.h can be tested without hardware.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+
+#ifndef MOCKI2C_H
+#define MOCKI2C_H
+
+/**         Includes         */
+#include <stdint.h>
+#include <stdbool.h>
+#include "ArduinoI2C.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+#define MOCKI2C_MAX_DEVICES 4
+#define MOCKI2C_REGISTERS 256
+
+  typedef struct
+  {
+    uint32_t transactions; /* Completed transactions (start to stop) */
+    uint32_t failed;       /* Transactions not acknowledged */
+    uint32_t bytesWritten; /* Data bytes written, without address bytes */
+    uint32_t bytesRead;
+  } MockI2C_Stats;
+
+  /* Removes all devices and clears the statistics. */
+  void MockI2C_reset(void);
+  /* Adds a device with 256 byte registers and an auto incremented register pointer. */
+  bool MockI2C_addDevice(uint8_t address);
+  uint8_t *MockI2C_registers(uint8_t address);
+  /* Completes all queued transactions, as the interrupt handler would. */
+  void MockI2C_run(void);
+  const MockI2C_Stats *MockI2C_getStats(void);
+  /* Called for every executed transaction before its callback, e.g. to record the bus traffic. */
+  typedef void (*MockI2C_Monitor)(const I2CAsync_Transaction *transaction);
+  void MockI2C_setMonitor(MockI2C_Monitor monitor);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MOCKI2C_H */
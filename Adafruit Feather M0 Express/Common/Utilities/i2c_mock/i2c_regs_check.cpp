@@ -0,0 +1,127 @@
+/**
+ * \file
+ * \brief Host check of burst and register list writes.
+ *
+ * Programs register tables through ArduinoI2CRegs on the mock I2C bus and
+ * compares the number of transactions with single register writes.
+ *
+ * \copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ * \page License
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE
+ * THAT WÜRTH ELEKTRONIK EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY
+ * KIND RELATED TO, BUT NOT LIMITED TO THE NON-INFRINGEMENT OF THIRD PARTIES’
+ * INTELLECTUAL PROPERTY RIGHTS OR THE MERCHANTABILITY OR FITNESS FOR YOUR
+ * INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT WARRANT OR
+ * REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY
+ * PATENT RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY
+ * RIGHT RELATING TO ANY COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT
+ * IS USED. INFORMATION PUBLISHED BY WÜRTH ELEKTRONIK EISOS REGARDING
+ * THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE FROM WÜRTH
+ * ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR
+ * ENDORSEMENT THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS PACKAGE
+ */
+
+/*
+ * Build and run on the host (from this directory):
+ *
+ *   g++ -O2 -I. -I../check -I../../Platform_Interfaces/Arduino -o i2c_regs_check i2c_regs_check.cpp MockI2C.cpp \
+ *       ../../Platform_Interfaces/Arduino/ArduinoI2CRegs.cpp && ./i2c_regs_check
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "MockI2C.h"
+#include "ArduinoI2CRegs.h"
+#include "check.h"
+
+#define DEVICE 0x44
+
+/* Typical sensor setup: control block, threshold block and a few scattered registers */
+static const I2CRegs_Value configTable[] = {
+    {0x10, 0x01}, {0x11, 0x80}, {0x12, 0x3C}, {0x13, 0x00},
+    {0x20, 0x10}, {0x21, 0x27}, {0x22, 0xF0}, {0x23, 0xD8}, {0x24, 0x00}, {0x25, 0x00},
+    {0x30, 0x07},
+    {0x3F, 0xA5},
+    {0x40, 0x01}, {0x41, 0x02},
+};
+
+static bool registersMatch(const I2CRegs_Value *list, int count)
+{
+  const uint8_t *registers = MockI2C_registers(DEVICE);
+  for (int i = 0; i < count; i++)
+  {
+    if (registers[list[i].reg] != list[i].value)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void setup(void)
+{
+  MockI2C_reset();
+  MockI2C_addDevice(DEVICE);
+  I2CAsync_init(400000);
+}
+
+int main(void)
+{
+  const int count = sizeof(configTable) / sizeof(configTable[0]);
+
+  /* One transaction per register */
+  setup();
+  for (int i = 0; i < count; i++)
+  {
+    I2CRegs_write(DEVICE, configTable[i].reg, &configTable[i].value, 1);
+  }
+  uint32_t single = MockI2C_getStats()->transactions;
+  check(registersMatch(configTable, count), "single register writes");
+
+  /* Register list */
+  setup();
+  check(I2CRegs_writeList(DEVICE, configTable, count) == WE_SUCCESS, "register list result");
+  uint32_t batched = MockI2C_getStats()->transactions;
+  check(registersMatch(configTable, count), "register list contents");
+  check(batched == 4, "register list merges consecutive registers");
+
+  /* Burst write and read back */
+  setup();
+  uint8_t payload[32], readBack[32];
+  for (int i = 0; i < (int)sizeof(payload); i++)
+  {
+    payload[i] = (uint8_t)(i * 7 + 1);
+  }
+  check(I2CRegs_write(DEVICE, 0x80, payload, sizeof(payload)) == WE_SUCCESS, "burst write result");
+  check(I2CRegs_read(DEVICE, 0x80, readBack, sizeof(readBack)) == WE_SUCCESS, "burst read result");
+  check(memcmp(payload, readBack, sizeof(payload)) == 0, "burst contents");
+  check(MockI2C_getStats()->transactions == 2, "burst write is one transaction");
+
+  /* Tables larger than the batch buffers */
+  setup();
+  static I2CRegs_Value large[150];
+  /* 100 consecutive registers followed by 50 scattered ones */
+  for (int i = 0; i < 150; i++)
+  {
+    large[i].reg = (uint8_t)((i < 100) ? i : (i - 100) * 2 + 110);
+    large[i].value = (uint8_t)(255 - i);
+  }
+  check(I2CRegs_writeList(DEVICE, large, 150) == WE_SUCCESS, "large register list result");
+  check(registersMatch(large, 150), "large register list contents");
+  uint32_t expected = (100 + I2CREGS_BUFFER_SIZE - 1) / I2CREGS_BUFFER_SIZE + 50;
+  check(MockI2C_getStats()->transactions == expected, "large register list transaction count");
+
+  /* Missing device */
+  setup();
+  check(I2CRegs_writeList(DEVICE + 1, configTable, count) == WE_FAIL, "missing device fails");
+
+  printf("%d registers: %u transactions single, %u transactions as register list\n", count, (unsigned)single,
+         (unsigned)batched);
+  return checkResult();
+}
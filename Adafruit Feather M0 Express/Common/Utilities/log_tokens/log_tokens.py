@@ -0,0 +1,267 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+#
+# THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED "AS IS". FOR MORE INFORMATION PLEASE
+# CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED IN THE ROOT DIRECTORY OF THIS PACKAGE.
+#
+"""String table extraction and decoder for tokenized debug output (WE_DEBUG_TOKENIZED).
+
+With WE_DEBUG_TOKENIZED the firmware sends, instead of formatted text, records of
+[0x1E][payload length][token (u32 LE)][arguments] where the token is the 32 bit FNV-1a hash
+of the format string (see Common/Hardware_Libraries/global/debug.h). This script rebuilds
+the format strings from the sources and formats the records on the host.
+
+    log_tokens.py extract <table.csv> <source dir>...
+        Writes the token table of all WE_DEBUG_* call sites found in the source dirs.
+
+    log_tokens.py decode <table.csv> [serial device | capture file]
+        Decodes the debug output (default: stdin). Plain text is passed through.
+
+Used as PlatformIO extra script (extra_scripts = pre:.../log_tokens.py) the table is
+written to <build dir>/log_tokens.csv on every build.
+"""
+
+import csv
+import os
+import re
+import struct
+import sys
+
+TOKEN_START = 0x1E
+SOURCE_EXTENSIONS = ('.c', '.cpp', '.h', '.hpp', '.ino')
+CALL = re.compile(r'\bWE_DEBUG_(PRINT_LEVEL|PRINT|WARNING|INFO|VERBOSE)\s*\(')
+LITERAL = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+SEPARATOR = re.compile(r'(?:\s+|//[^\n]*|/\*.*?\*/)*', re.S)
+CONVERSION = re.compile(r'%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?(?:\.(?P<precision>\*|\d+))?'
+                        r'(?P<length>hh|h|ll|l|j|z|t|L)?(?P<conversion>[diouxXeEfFgGcsp%])')
+
+
+def token(text):
+    """32 bit FNV-1a hash, identical to WE_Debug_Token() in debug.h."""
+    value = 2166136261
+    for byte in text:
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def unescape(literal):
+    """Bytes of a C string literal body."""
+    out = bytearray()
+    i = 0
+    simple = {'n': 10, 'r': 13, 't': 9, '0': 0, 'a': 7, 'b': 8, 'f': 12, 'v': 11,
+              '\\': 92, '"': 34, "'": 39, '?': 63}
+    while i < len(literal):
+        c = literal[i]
+        if c != '\\':
+            out += c.encode('utf-8')
+            i += 1
+            continue
+        c = literal[i + 1]
+        if c == 'x':
+            digits = re.match(r'[0-9a-fA-F]+', literal[i + 2:]).group(0)
+            out.append(int(digits, 16) & 0xFF)
+            i += 2 + len(digits)
+        elif c in '01234567':
+            digits = re.match(r'[0-7]{1,3}', literal[i + 1:]).group(0)
+            out.append(int(digits, 8) & 0xFF)
+            i += 1 + len(digits)
+        else:
+            out.append(simple[c])
+            i += 2
+    return bytes(out)
+
+
+def find_format(source, position, skip_argument):
+    """Concatenated format string literal of the call starting at position, None if there is none."""
+    if skip_argument:
+        depth = 0
+        while position < len(source):
+            c = source[position]
+            if c in '([':
+                depth += 1
+            elif c in ')]':
+                depth -= 1
+            elif c == ',' and depth == 0:
+                position += 1
+                break
+            position += 1
+
+    text = b''
+    found = False
+    while True:
+        position = SEPARATOR.match(source, position).end()
+        match = LITERAL.match(source, position)
+        if match is None:
+            return text if found else None
+        text += unescape(match.group(1))
+        found = True
+        position = match.end()
+
+
+def extract(directories):
+    """Token table {token: (format, location)} of all call sites."""
+    table = {}
+    for directory in directories:
+        for root, _, files in os.walk(directory):
+            for name in sorted(files):
+                if not name.endswith(SOURCE_EXTENSIONS):
+                    continue
+                path = os.path.join(root, name)
+                with open(path, encoding='utf-8', errors='replace') as f:
+                    source = f.read()
+                for match in CALL.finditer(source):
+                    line_start = source.rfind('\n', 0, match.start()) + 1
+                    if source[line_start:match.start()].lstrip().startswith('#'):
+                        continue
+                    text = find_format(source, match.end(), match.group(1) == 'PRINT_LEVEL')
+                    if text is None:
+                        continue
+                    location = '%s:%d' % (os.path.relpath(path), source.count('\n', 0, match.start()) + 1)
+                    value = token(text)
+                    if value in table and table[value][0] != text:
+                        raise ValueError('Token collision between %s and %s' % (table[value][1], location))
+                    table.setdefault(value, (text, location))
+    return table
+
+
+def write_table(path, table):
+    with open(path, 'w', newline='') as f:
+        writer = csv.writer(f)
+        writer.writerow(['token', 'location', 'format'])
+        for value, (text, location) in sorted(table.items()):
+            writer.writerow(['%08x' % value, location, text.decode('latin-1')])
+
+
+def read_table(path):
+    with open(path, newline='') as f:
+        reader = csv.DictReader(f)
+        return {int(row['token'], 16): row['format'] for row in reader}
+
+
+def format_record(text, payload):
+    """Format the arguments in payload like printf does on the device."""
+    arguments = payload
+    out = []
+    position = 0
+
+    def take(size):
+        nonlocal arguments
+        if len(arguments) < size:
+            raise ValueError('record is truncated')
+        value, arguments = arguments[:size], arguments[size:]
+        return value
+
+    for match in CONVERSION.finditer(text):
+        out.append(text[position:match.start()])
+        position = match.end()
+        conversion = match.group('conversion')
+        if conversion == '%':
+            out.append('%')
+            continue
+
+        width = match.group('width') or ''
+        precision = match.group('precision')
+        if width == '*':
+            width = str(struct.unpack('<i', take(4))[0])
+        if precision == '*':
+            precision = str(struct.unpack('<i', take(4))[0])
+        spec = '%' + match.group('flags') + width + ('.' + precision if precision is not None else '')
+        wide = match.group('length') in ('ll', 'j')
+
+        if conversion in 'di':
+            value = struct.unpack('<q' if wide else '<i', take(8 if wide else 4))[0]
+            out.append((spec + 'd') % value)
+        elif conversion in 'ouxX':
+            value = struct.unpack('<Q' if wide else '<I', take(8 if wide else 4))[0]
+            out.append((spec + ('d' if conversion == 'u' else conversion)) % value)
+        elif conversion in 'eEfFgG':
+            out.append((spec + conversion) % struct.unpack('<d', take(8))[0])
+        elif conversion == 'c':
+            out.append((spec + 'c') % chr(struct.unpack('<I', take(4))[0] & 0xFF))
+        elif conversion == 's':
+            end = arguments.find(b'\0')
+            if end < 0:
+                raise ValueError('record is truncated')
+            out.append((spec + 's') % take(end + 1)[:-1].decode('latin-1'))
+        elif conversion == 'p':
+            out.append('0x%08x' % struct.unpack('<I', take(4))[0])
+
+    out.append(text[position:])
+    return ''.join(out)
+
+
+def decode(table, stream, output):
+    """Decode a debug output stream, plain text is passed through."""
+    buffer = b''
+    while True:
+        chunk = stream.read1(256) if hasattr(stream, 'read1') else stream.read(256)
+        if not chunk:
+            break
+        buffer += chunk
+        while buffer:
+            start = buffer.find(bytes([TOKEN_START]))
+            if start != 0:
+                text = buffer if start < 0 else buffer[:start]
+                output.write(text.decode('latin-1'))
+                buffer = b'' if start < 0 else buffer[start:]
+                continue
+            if len(buffer) < 2 or len(buffer) < 2 + buffer[1]:
+                break
+            payload = buffer[2:2 + buffer[1]]
+            buffer = buffer[2 + buffer[1]:]
+            if len(payload) < 4:
+                output.write('<invalid record>\n')
+                continue
+            value = struct.unpack('<I', payload[:4])[0]
+            if value not in table:
+                output.write('<unknown token %08x>\n' % value)
+                continue
+            try:
+                output.write(format_record(table[value], payload[4:]))
+            except (ValueError, struct.error, TypeError) as error:
+                output.write('<%08x: %s>\n' % (value, error))
+        output.flush()
+
+
+def main(argv):
+    if len(argv) >= 4 and argv[1] == 'extract':
+        table = extract(argv[3:])
+        write_table(argv[2], table)
+        print('%d format strings' % len(table))
+        return 0
+
+    if len(argv) >= 3 and argv[1] == 'decode':
+        table = read_table(argv[2])
+        if len(argv) >= 4:
+            with open(argv[3], 'rb', buffering=0) as stream:
+                decode(table, stream, sys.stdout)
+        else:
+            decode(table, sys.stdin.buffer, sys.stdout)
+        return 0
+
+    sys.stderr.write('usage: %s extract <table.csv> <source dir>...\n'
+                     '       %s decode <table.csv> [serial device | capture file]\n' % (argv[0], argv[0]))
+    return 2
+
+
+def platformio_pre_build(env):
+    """Write the token table of the project and its library folders into the build folder."""
+    project = env.subst('$PROJECT_DIR')
+    directories = [env.subst('$PROJECT_SRC_DIR'), os.path.join(project, 'lib')]
+    for directory in env.GetProjectOption('lib_extra_dirs', []):
+        directories.append(os.path.join(project, directory))
+    build = env.subst('$BUILD_DIR')
+    if not os.path.isdir(build):
+        os.makedirs(build)
+    write_table(os.path.join(build, 'log_tokens.csv'), extract([d for d in directories if os.path.isdir(d)]))
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
+else:
+    try:
+        Import('env')  # noqa: F821 (provided by SCons)
+        platformio_pre_build(env)  # noqa: F821
+    except NameError:
+        pass
@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+#
+# THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED "AS IS". FOR MORE INFORMATION PLEASE
+# CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED IN THE ROOT DIRECTORY OF THIS PACKAGE.
+#
+"""Build time RAM and flash report from the GNU linker map file.
+
+Complements the runtime report of Common/Hardware_Libraries/global/memory_usage.h: the map
+file tells where the static RAM (.data and .bss) and the flash go, per library and per
+symbol, before the firmware ever runs.
+
+    memory_map.py report <firmware.map> [symbol count]
+        Prints the memory regions, the usage per library/object and the largest RAM symbols.
+
+Used as PlatformIO extra script (extra_scripts = pre:.../memory_map.py) the linker writes
+<build dir>/firmware.map and the report is printed after every link.
+"""
+
+import os
+import re
+import sys
+from collections import defaultdict
+
+REGION = re.compile(r'^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)')
+OUTPUT_SECTION = re.compile(r'^(\.\S+|/DISCARD/)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+))?(?:\s+load address 0x([0-9a-fA-F]+))?')
+INPUT_SECTION = re.compile(r'^ (\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*))?$')
+CONTINUATION = re.compile(r'^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$')
+ARCHIVE_MEMBER = re.compile(r'(?:^|[/\\])(?:lib)?([^/\\]+?)\.a\(([^)]+)\)$')
+RAM_SECTIONS = ('.data', '.bss', '.tbss', '.tdata', '.noinit', 'COMMON')
+NOT_ALLOCATED = ('.debug', '.comment', '.stab', '.ARM.attributes', '.gnu.attributes', '.note.gnu.build-id')
+
+
+class MemoryMap:
+    """Allocated input sections of a map file: (output section, input section, address, size, module, loaded from flash)."""
+
+    def __init__(self):
+        self.regions = {}
+        self.sections = []
+
+    def region_of(self, address):
+        for name, (origin, length) in self.regions.items():
+            if name != '*default*' and origin <= address < origin + length:
+                return name
+        return None
+
+    def is_ram(self, output, address):
+        region = self.region_of(address)
+        if region is not None:
+            return region.upper().startswith('RAM') or region.upper().startswith('SRAM')
+        return output.startswith(RAM_SECTIONS)
+
+
+def module_name(path):
+    """Library name for archive members (libICLED_24bit.a(x.o) -> ICLED_24bit), the object name otherwise."""
+    match = ARCHIVE_MEMBER.search(path.strip())
+    if match:
+        return match.group(1)
+    return os.path.basename(path.strip())
+
+
+def parse(lines):
+    memory_map = MemoryMap()
+    state = None
+    output = None
+    output_loaded = False
+    pending = None
+
+    for line in lines:
+        line = line.rstrip('\r\n')
+        if line.startswith('Memory Configuration'):
+            state = 'regions'
+            continue
+        if line.startswith('Linker script and memory map'):
+            state = 'map'
+            continue
+
+        if state == 'regions':
+            match = REGION.match(line)
+            if match and match.group(1) != 'Name':
+                memory_map.regions[match.group(1)] = (int(match.group(2), 16), int(match.group(3), 16))
+            continue
+        if state != 'map' or not line:
+            continue
+
+        if not line[0].isspace():
+            match = OUTPUT_SECTION.match(line)
+            if match:
+                output = match.group(1)
+                # .data is placed in RAM but its initial values are stored in flash
+                output_loaded = match.group(4) is not None
+            pending = None
+            continue
+        if output is None or output == '/DISCARD/' or output.startswith(NOT_ALLOCATED):
+            continue
+
+        if pending is not None:
+            match = CONTINUATION.match(line)
+            name, pending = pending, None
+            if match is None:
+                continue
+            address, size, path = match.groups()
+        else:
+            match = INPUT_SECTION.match(line)
+            if match is None or match.group(1) in ('*fill*', '*(COMMON)') or match.group(1).startswith('*('):
+                continue
+            name, address, size, path = match.groups()
+            if address is None:
+                # Long section names wrap, address and size follow on the next line
+                pending = name
+                continue
+
+        size = int(size, 16)
+        address = int(address, 16)
+        if size == 0 or path.startswith('load address'):
+            continue
+        memory_map.sections.append((output, name, address, size, module_name(path), output_loaded))
+
+    return memory_map
+
+
+def demangle(name):
+    """Plain names of variables at namespace scope (_ZL6LEDBuf -> LEDBuf, _ZN2ns3bufE -> ns::buf)."""
+    match = re.match(r'_Z(L?)(N?)(.*)$', name)
+    if match is None:
+        return name
+    rest = match.group(3)
+    parts = []
+    while rest and rest[0].isdigit():
+        length = re.match(r'\d+', rest).group(0)
+        rest = rest[len(length):]
+        parts.append(rest[:int(length)])
+        rest = rest[int(length):]
+    if not parts or rest not in ('', 'E'):
+        return name
+    return '::'.join(parts)
+
+
+def symbol_name(section):
+    """Symbol of a -fdata-sections input section (.bss.LEDBuf -> LEDBuf)."""
+    for prefix in ('.bss.', '.data.', '.rodata.', '.text.'):
+        if section.startswith(prefix):
+            return demangle(section[len(prefix):])
+    return section
+
+
+def report(memory_map, symbols, out):
+    ram = defaultdict(int)
+    flash = defaultdict(int)
+    largest = []
+
+    for output, name, address, size, module, loaded in memory_map.sections:
+        if memory_map.is_ram(output, address):
+            ram[module] += size
+            largest.append((size, symbol_name(name), module))
+            if loaded:
+                flash[module] += size
+        else:
+            flash[module] += size
+
+    total_ram = sum(ram.values())
+    total_flash = sum(flash.values())
+    for name, (origin, length) in sorted(memory_map.regions.items()):
+        if name == '*default*':
+            continue
+        used = total_ram if memory_map.is_ram('', origin) else total_flash
+        out.write('%-8s 0x%08x %7d bytes, %7d used (%.1f%%)\n' % (name, origin, length, used, 100.0 * used / length))
+
+    out.write('\n%-32s %8s %8s\n' % ('library/object', 'RAM', 'flash'))
+    modules = sorted(set(ram) | set(flash), key=lambda m: (-ram[m], -flash[m], m))
+    for module in modules:
+        out.write('%-32s %8d %8d\n' % (module, ram[module], flash[module]))
+    out.write('%-32s %8d %8d\n' % ('total', total_ram, total_flash))
+
+    out.write('\nLargest RAM symbols\n')
+    for size, name, module in sorted(largest, key=lambda s: (-s[0], s[1]))[:symbols]:
+        out.write('%8d  %-40s %s\n' % (size, name, module))
+
+
+def main(argv):
+    if len(argv) >= 3 and argv[1] == 'report':
+        with open(argv[2], encoding='utf-8', errors='replace') as f:
+            memory_map = parse(f)
+        report(memory_map, int(argv[3]) if len(argv) >= 4 else 15, sys.stdout)
+        return 0
+
+    sys.stderr.write('usage: %s report <firmware.map> [symbol count]\n' % argv[0])
+    return 2
+
+
+def platformio_pre_build(env):
+    """Let the linker write a map file into the build folder and report it after linking."""
+    path = os.path.join(env.subst('$BUILD_DIR'), 'firmware.map')
+    env.Append(LINKFLAGS=['-Wl,-Map,' + path])
+
+    def print_report(source, target, env):
+        with open(path, encoding='utf-8', errors='replace') as f:
+            report(parse(f), 15, sys.stdout)
+
+    env.AddPostAction('$BUILD_DIR/${PROGNAME}.elf', print_report)
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
+else:
+    try:
+        Import('env')  # noqa: F821 (provided by SCons)
+        platformio_pre_build(env)  # noqa: F821
+    except NameError:
+        pass
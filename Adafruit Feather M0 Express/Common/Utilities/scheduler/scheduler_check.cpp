@@ -0,0 +1,313 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Host check of the scheduler and event latency under load.
+ *
+ * The software timers run on a simulated clock. Handlers consume simulated time, timers that
+ * expire meanwhile post their events like the timer interrupt would. The same load is run
+ * through the scheduler and through a polling loop that serves the sources one after another.
+ *
+ * Build and run on the host (from this directory):
+ *
+ *   g++ -O2 -I../check -I../../Hardware_Libraries/global -o scheduler_check scheduler_check.cpp \
+ *       -x c ../../Hardware_Libraries/global/scheduler.c ../../Hardware_Libraries/global/timer_wheel.c && ./scheduler_check
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "scheduler.h"
+#include "check.h"
+
+/* Software timers on a simulated clock */
+
+static WE_TimerWheel_t wheel;
+static uint64_t simulatedTicks = 0;
+
+extern "C" bool WE_SoftTimer_Init(void)
+{
+    WE_TimerWheel_Init(&wheel, simulatedTicks);
+    return true;
+}
+
+extern "C" bool WE_SoftTimer_Start(WE_SoftTimer_t *timer, uint32_t delay_us, uint32_t period_us, WE_SoftTimer_Callback_t callback, void *context)
+{
+    if (period_us > WE_SOFTTIMER_MAX_PERIOD_US)
+    {
+        return false;
+    }
+    WE_TimerWheel_Start(&wheel, timer, simulatedTicks + (uint64_t)delay_us * WE_SOFTTIMER_TICKS_PER_US, period_us * WE_SOFTTIMER_TICKS_PER_US, callback, context);
+    return true;
+}
+
+extern "C" bool WE_SoftTimer_Stop(WE_SoftTimer_t *timer)
+{
+    return WE_TimerWheel_Cancel(&wheel, timer);
+}
+
+extern "C" uint64_t WE_SoftTimer_GetTicks(void)
+{
+    return simulatedTicks;
+}
+
+/* Let time pass, expiring timers interrupt the current handler */
+static void work(uint32_t us)
+{
+    uint64_t end = simulatedTicks + (uint64_t)us * WE_SOFTTIMER_TICKS_PER_US;
+    for (;;)
+    {
+        uint64_t next = WE_TimerWheel_NextEvent(&wheel);
+        if (next > end)
+        {
+            break;
+        }
+        simulatedTicks = (next > simulatedTicks) ? next : simulatedTicks;
+        WE_TimerWheel_Advance(&wheel, simulatedTicks);
+    }
+    simulatedTicks = end;
+    WE_TimerWheel_Advance(&wheel, simulatedTicks);
+}
+
+/* Priority order, full queues and timer events */
+
+static uint16_t order[8];
+static int orderCount = 0;
+
+static void recordHandler(WE_Task_t *task, const WE_Event_t *event)
+{
+    (void)task;
+    if (orderCount < 8)
+    {
+        order[orderCount++] = event->signal;
+    }
+}
+
+static void checkBasics()
+{
+    WE_Task_t low, high;
+    WE_Event_t lowQueue[2], highQueue[2];
+    WE_Scheduler_Timer_t timer;
+    memset(&timer, 0, sizeof(timer));
+
+    WE_Scheduler_Init();
+    check(WE_Scheduler_AddTask(&low, "low", 1, lowQueue, 2, recordHandler, NULL), "add low priority task");
+    check(WE_Scheduler_AddTask(&high, "high", 5, highQueue, 2, recordHandler, NULL), "add high priority task");
+    check(!WE_Scheduler_AddTask(&high, "again", 5, highQueue, 2, recordHandler, NULL), "priority is taken");
+
+    WE_Scheduler_Post(&low, 1, 0, NULL);
+    WE_Scheduler_Post(&low, 2, 0, NULL);
+    check(!WE_Scheduler_Post(&low, 3, 0, NULL), "post to a full queue fails");
+    WE_Scheduler_Post(&high, 10, 0, NULL);
+    while (WE_Scheduler_RunOnce())
+    {
+    }
+    check(orderCount == 3 && order[0] == 10 && order[1] == 1 && order[2] == 2, "events are handled by priority, then in order");
+    check(low.stats.dropped == 1 && low.stats.queueHighWater == 2, "queue statistics");
+
+    orderCount = 0;
+    WE_Scheduler_StartTimer(&timer, &high, 20, 1000, 500);
+    work(2100);
+    check(WE_Scheduler_StopTimer(&timer), "periodic timer is running");
+    while (WE_Scheduler_RunOnce())
+    {
+    }
+    check(orderCount == 2 && high.stats.dropped == 1, "timer events until the queue is full");
+
+    WE_Scheduler_RemoveTask(&low);
+    check(!WE_Scheduler_Post(&low, 4, 0, NULL), "post to a removed task fails");
+    check(!WE_Scheduler_RunOnce(), "removed task is not run");
+    WE_Scheduler_RemoveTask(&high);
+}
+
+/* Load: a fast UART source, button presses, LED frames and slow background work */
+
+typedef struct
+{
+    const char *name;
+    uint8_t priority;
+    uint32_t period_us;
+    uint32_t run_us;
+} Source;
+
+static const Source sources[] = {
+    {"uart", 3, 1000, 20},
+    {"button", 2, 47000, 10},
+    {"frame", 1, 10000, 3000},
+    {"background", 0, 100000, 8000},
+};
+
+#define SOURCES (sizeof(sources) / sizeof(sources[0]))
+#define LOAD_DURATION_US 10000000
+
+static void loadHandler(WE_Task_t *task, const WE_Event_t *event)
+{
+    (void)event;
+    work(((const Source *)task->context)->run_us);
+}
+
+static void runScheduler(WE_Task_Stats_t *stats)
+{
+    WE_Task_t tasks[SOURCES];
+    WE_Event_t queues[SOURCES][8];
+    WE_Scheduler_Timer_t timers[SOURCES];
+    memset(timers, 0, sizeof(timers));
+
+    WE_Scheduler_Init();
+    for (size_t i = 0; i < SOURCES; i++)
+    {
+        WE_Scheduler_AddTask(&tasks[i], sources[i].name, sources[i].priority, queues[i], 8, loadHandler, (void *)&sources[i]);
+        WE_Scheduler_StartTimer(&timers[i], &tasks[i], 1, sources[i].period_us, sources[i].period_us);
+    }
+
+    uint64_t end = simulatedTicks + (uint64_t)LOAD_DURATION_US * WE_SOFTTIMER_TICKS_PER_US;
+    while (simulatedTicks < end)
+    {
+        if (!WE_Scheduler_RunOnce())
+        {
+            /* Idle until the next timer */
+            uint64_t next = WE_TimerWheel_NextEvent(&wheel);
+            simulatedTicks = (next > simulatedTicks) ? next : simulatedTicks;
+            WE_TimerWheel_Advance(&wheel, simulatedTicks);
+        }
+    }
+
+    for (size_t i = 0; i < SOURCES; i++)
+    {
+        WE_Scheduler_StopTimer(&timers[i]);
+        WE_Scheduler_GetStats(&tasks[i], &stats[i]);
+        WE_Scheduler_RemoveTask(&tasks[i]);
+    }
+}
+
+/* The same sources served by a polling loop: each source is checked once per loop pass */
+
+static uint32_t pollPending[SOURCES];
+static uint32_t pollTimestamp[SOURCES][64];
+
+static void pollTimerExpired(WE_SoftTimer_t *timer, void *context)
+{
+    (void)timer;
+    size_t i = (size_t)(intptr_t)context;
+    pollTimestamp[i][pollPending[i] % 64] = (uint32_t)simulatedTicks;
+    pollPending[i]++;
+}
+
+static void runPollingLoop(WE_Task_Stats_t *stats)
+{
+    WE_SoftTimer_t timers[SOURCES];
+    uint32_t served[SOURCES];
+    memset(timers, 0, sizeof(timers));
+    memset(served, 0, sizeof(served));
+    memset(pollPending, 0, sizeof(pollPending));
+
+    for (size_t i = 0; i < SOURCES; i++)
+    {
+        memset(&stats[i], 0, sizeof(stats[i]));
+        stats[i].latencyMin = UINT32_MAX;
+        WE_SoftTimer_Start(&timers[i], sources[i].period_us, sources[i].period_us, pollTimerExpired, (void *)(intptr_t)i);
+    }
+
+    uint64_t end = simulatedTicks + (uint64_t)LOAD_DURATION_US * WE_SOFTTIMER_TICKS_PER_US;
+    while (simulatedTicks < end)
+    {
+        bool busy = false;
+        for (size_t i = 0; i < SOURCES; i++)
+        {
+            if (served[i] != pollPending[i])
+            {
+                uint32_t latency = ((uint32_t)simulatedTicks - pollTimestamp[i][served[i] % 64]) / WE_SOFTTIMER_TICKS_PER_US;
+                stats[i].handled++;
+                stats[i].latencySum += latency;
+                stats[i].latencyMin = (latency < stats[i].latencyMin) ? latency : stats[i].latencyMin;
+                stats[i].latencyMax = (latency > stats[i].latencyMax) ? latency : stats[i].latencyMax;
+                served[i]++;
+                work(sources[i].run_us);
+                busy = true;
+            }
+        }
+        if (!busy)
+        {
+            uint64_t next = WE_TimerWheel_NextEvent(&wheel);
+            simulatedTicks = (next > simulatedTicks) ? next : simulatedTicks;
+            WE_TimerWheel_Advance(&wheel, simulatedTicks);
+        }
+    }
+
+    for (size_t i = 0; i < SOURCES; i++)
+    {
+        WE_SoftTimer_Stop(&timers[i]);
+    }
+}
+
+static uint32_t percentile99(const WE_Task_Stats_t *stats)
+{
+    uint32_t count = 0;
+    for (int bucket = 0; bucket < WE_SCHEDULER_LATENCY_BUCKETS; bucket++)
+    {
+        count += stats->latencyHistogram[bucket];
+        if (count * 100ULL >= stats->handled * 99ULL)
+        {
+            return (bucket == 0) ? 0 : (1UL << bucket);
+        }
+    }
+    return UINT32_MAX;
+}
+
+static void printStats(const char *title, const WE_Task_Stats_t *stats, bool histogram)
+{
+    printf("%s\n%-12s %8s %8s %10s %10s %10s %10s\n", title, "source", "events", "dropped", "min [us]", "avg [us]", "max [us]", "p99 [us]");
+    for (size_t i = 0; i < SOURCES; i++)
+    {
+        char p99[16] = "-";
+        if (histogram)
+        {
+            snprintf(p99, sizeof(p99), "< %u", percentile99(&stats[i]));
+        }
+        printf("%-12s %8u %8u %10u %10llu %10u %10s\n", sources[i].name, stats[i].handled, stats[i].dropped, stats[i].latencyMin,
+               (unsigned long long)(stats[i].handled ? stats[i].latencySum / stats[i].handled : 0), stats[i].latencyMax, p99);
+    }
+    printf("\n");
+}
+
+int main()
+{
+    checkBasics();
+
+    WE_Task_Stats_t scheduled[SOURCES];
+    WE_Task_Stats_t polled[SOURCES];
+    runScheduler(scheduled);
+    runPollingLoop(polled);
+
+    printStats("Scheduler (run to completion, by priority)", scheduled, true);
+    printStats("Polling loop", polled, false);
+
+    /* The UART waits at most for the longest handler, in the polling loop for a whole loop pass */
+    check(scheduled[0].latencyMax <= sources[3].run_us + sources[0].run_us, "uart latency bounded by the longest handler");
+    check(scheduled[0].dropped == 0 && scheduled[2].dropped == 0, "no events dropped");
+    check(polled[0].latencyMax > scheduled[0].latencyMax, "polling loop has a higher uart latency");
+
+    return checkResult();
+}
@@ -0,0 +1,291 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Host check and benchmark of the software timer wheel.
+ *
+ * The wheel is driven by a simulated clock. The check compares every expiry against a reference
+ * model while timers are started, cancelled and restarted from callbacks. The benchmark measures
+ * start, cancel and fire cost with thousands of running timers.
+ *
+ * Build and run on the host (from this directory):
+ *
+ *   g++ -O2 -I../check -I../../Hardware_Libraries/global -o timer_wheel_check timer_wheel_check.cpp \
+ *       -x c ../../Hardware_Libraries/global/timer_wheel.c && ./timer_wheel_check
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "timer_wheel.h"
+#include "check.h"
+
+#define TIMERS 2000
+#define STEPS 200000
+
+/* Reference model of one timer */
+typedef struct
+{
+    bool active;
+    uint64_t expiry;
+    uint32_t period;
+    uint32_t fired;
+} Reference;
+
+static WE_TimerWheel_t wheel;
+static WE_SoftTimer_t timers[TIMERS];
+static Reference reference[TIMERS];
+static uint64_t target;
+static uint64_t seed = 0x2545F4914F6CDD1DULL;
+
+static uint32_t random32()
+{
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (uint32_t)(seed >> 33);
+}
+
+static void fail(const char *what, int index)
+{
+    checkFail("%s (timer %d, now %llu)", what, index, (unsigned long long)wheel.now);
+}
+
+/* Delays from a few ticks up to beyond the span of the wheel */
+static uint64_t randomDelay()
+{
+    switch (random32() % 5)
+    {
+    case 0:
+        return random32() % 64;
+    case 1:
+        return random32() % 5000;
+    case 2:
+        return random32() % 1000000;
+    case 3:
+        return random32() % 50000000;
+    default:
+        return random32() % 4;
+    }
+}
+
+static void startTimer(int index, uint64_t delay, uint32_t period);
+
+static void onExpiry(WE_SoftTimer_t *timer, void *context)
+{
+    int index = (int)(intptr_t)context;
+    Reference *ref = &reference[index];
+
+    if (timer != &timers[index] || !ref->active)
+    {
+        fail("callback of an inactive timer", index);
+        return;
+    }
+    if (wheel.now != ref->expiry)
+    {
+        fail("timer expired at the wrong time", index);
+    }
+    ref->fired++;
+
+    if (0 != ref->period)
+    {
+        ref->expiry += ref->period;
+        if (ref->expiry <= target)
+        {
+            ref->expiry += ((target - ref->expiry) / ref->period + 1) * ref->period;
+        }
+    }
+    else
+    {
+        ref->active = false;
+    }
+
+    /* Callbacks start and cancel timers */
+    uint32_t action = random32() % 10;
+    if (0 == action)
+    {
+        startTimer(index, randomDelay(), 0);
+    }
+    else if (1 == action)
+    {
+        int other = random32() % TIMERS;
+        bool wasActive = WE_TimerWheel_Cancel(&wheel, &timers[other]);
+        if (wasActive != reference[other].active)
+        {
+            fail("cancel from callback", other);
+        }
+        reference[other].active = false;
+    }
+}
+
+static void startTimer(int index, uint64_t delay, uint32_t period)
+{
+    Reference *ref = &reference[index];
+    uint64_t expiry = wheel.now + delay;
+
+    WE_TimerWheel_Start(&wheel, &timers[index], expiry, period, onExpiry, (void *)(intptr_t)index);
+
+    ref->active = true;
+    /* Timers started in the past expire at the current time of the wheel */
+    ref->expiry = (expiry > wheel.now) ? expiry : wheel.now;
+    ref->period = period;
+}
+
+static void checkWheel()
+{
+    uint64_t now = (1ULL << 40) - 12345;
+    WE_TimerWheel_Init(&wheel, now);
+
+    uint32_t fired = 0;
+    for (int step = 0; step < STEPS; step++)
+    {
+        int index = random32() % TIMERS;
+        uint32_t action = random32() % 16;
+
+        if (action < 6)
+        {
+            uint32_t period = (0 == random32() % 4) ? 1 + random32() % 20000 : 0;
+            startTimer(index, randomDelay(), period);
+        }
+        else if (action < 8)
+        {
+            bool wasActive = WE_TimerWheel_Cancel(&wheel, &timers[index]);
+            if (wasActive != reference[index].active)
+            {
+                fail("cancel", index);
+            }
+            reference[index].active = false;
+        }
+        else
+        {
+            uint64_t step = (0 == random32() % 1000) ? 100000000 : randomDelay();
+            target = now + step;
+            fired += WE_TimerWheel_Advance(&wheel, target);
+            now = target;
+
+            if (wheel.now != now || WE_TimerWheel_NextEvent(&wheel) <= now)
+            {
+                fail("wheel did not advance", -1);
+            }
+        }
+
+        /* The next event must not be later than the earliest expiry */
+        uint64_t earliest = UINT64_MAX;
+        uint32_t active = 0;
+        for (int i = 0; i < TIMERS; i++)
+        {
+            if (reference[i].active && reference[i].expiry < now)
+            {
+                fail("timer did not expire", i);
+                reference[i].active = false;
+            }
+            if (reference[i].active != WE_TimerWheel_IsActive(&timers[i]))
+            {
+                fail("active state differs", i);
+                reference[i].active = WE_TimerWheel_IsActive(&timers[i]);
+            }
+            if (reference[i].active)
+            {
+                active++;
+                earliest = (reference[i].expiry < earliest) ? reference[i].expiry : earliest;
+            }
+        }
+        if (active != wheel.active)
+        {
+            fail("active count differs", -1);
+        }
+        if (WE_TimerWheel_NextEvent(&wheel) > earliest)
+        {
+            fail("next event after the earliest expiry", -1);
+        }
+    }
+
+    printf("check: %d steps, %u expiries\n", STEPS, fired);
+}
+
+static void onBenchmarkExpiry(WE_SoftTimer_t *timer, void *context)
+{
+    (void)timer;
+    (*(uint32_t *)context)++;
+}
+
+/* Start, cancel and fire cost with a given number of running timers */
+static void benchmark(int count)
+{
+    typedef std::chrono::steady_clock Clock;
+    std::vector<WE_SoftTimer_t> bench(count);
+    std::vector<uint32_t> delays(count);
+    uint32_t fired = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        /* Up to 1 s at 3 ticks per microsecond */
+        delays[i] = 1 + random32() % 3000000;
+    }
+
+    WE_TimerWheel_Init(&wheel, 0);
+
+    Clock::time_point t0 = Clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        WE_TimerWheel_Start(&wheel, &bench[i], delays[i], 0, onBenchmarkExpiry, &fired);
+    }
+    Clock::time_point t1 = Clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        WE_TimerWheel_Cancel(&wheel, &bench[i]);
+    }
+    Clock::time_point t2 = Clock::now();
+
+    for (int i = 0; i < count; i++)
+    {
+        WE_TimerWheel_Start(&wheel, &bench[i], delays[i], 0, onBenchmarkExpiry, &fired);
+    }
+    Clock::time_point t3 = Clock::now();
+    uint32_t advances = 0;
+    for (uint64_t now = 0; wheel.active > 0; now = WE_TimerWheel_NextEvent(&wheel))
+    {
+        WE_TimerWheel_Advance(&wheel, now);
+        advances++;
+    }
+    Clock::time_point t4 = Clock::now();
+
+    double start = std::chrono::duration<double, std::nano>(t1 - t0).count() / count;
+    double cancel = std::chrono::duration<double, std::nano>(t2 - t1).count() / count;
+    double fire = std::chrono::duration<double, std::nano>(t4 - t3).count() / fired;
+    printf("%6d timers: start %6.1f ns, cancel %6.1f ns, fire %6.1f ns (%u wake-ups)\n", count, start, cancel, fire, advances);
+}
+
+int main()
+{
+    checkWheel();
+
+    benchmark(100);
+    benchmark(1000);
+    benchmark(10000);
+    benchmark(100000);
+
+    return checkResult();
+}
@@ -25,9 +25,11 @@
 
 #include <SPI.h>
 #include "ICLED_24bit.h"
+#include "ICLED_24bit_encoder.h"
 #include "ConfigPlatform.h"
 #include "debug.h"
 #include "global.h"
+#include "idle.h"
 
 /**
  * @brief       Apply the specified brightness to the color coordinate.
@@ -63,12 +65,35 @@ static void write_ledbuffer_to_DMAbuffer();
  */
 static void HSV_to_RGB(float h, float s, float v, float *r, float *g, float *b);
 
+/**
+ * @brief       Send the current frame once (single frame output only).
+ *
+ * @return      None
+ */
+static void output_frame();
+
+/**
+ * @brief       DMA transfer complete callback, called once a frame has been sent including the latch time.
+ *
+ * @param[in]   dma: DMA manager.
+ *
+ * @return      None
+ */
+static void dma_frame_done(Adafruit_ZeroDMA *dma);
+
 static ICLED_Color_System ColorSystem = RGB;
 
 static uint8_t dmaBuf[ICLED_BYTESTOTAL] = {0}; // The raw buffer we write to SPI
 static Adafruit_ZeroDMA dma; ///< The DMA manager for the SPI class
+static DmacDescriptor *dmaDesc; ///< Looping DMA descriptor, points to dmaBuf or a pre-encoded frame
+static const uint8_t *frame_source = dmaBuf; ///< Frame the DMA descriptor points to
+static PlatformPool<SPIClass> spiPool; ///< Storage of the SPI interface, static with WE_STATIC_ALLOCATION
 static SPIClass *spi;        ///< Underlying SPI hardware interface we use to DMA
 
+static volatile bool continuous_output = true; ///< Frame is sent over and over again
+static volatile bool frame_busy = false;       ///< DMA job running, standby is locked meanwhile
+static volatile bool frame_pending = false;    ///< Frame written while the previous one was still being sent
+
 #define MIN_LOOP_DELAY_MS 5
 #define OFFSET 1
 
@@ -84,30 +109,37 @@ typedef union
 } Pixel;
 
 // buffer for LEDs --> will be written into dmaBuf after bit-expansion in
-static Pixel LEDBuf[ICLED_BYTESTOTAL];
-
-#define ZEROPATTERN 0x8 // 4-bit
-#define ONEPATTERN 0xE  // 4-bit
-
-#define ZEROZEROPATTERN ((ZEROPATTERN << 4) | ZEROPATTERN) // 10001000
-#define ZEROONEPATTERN ((ZEROPATTERN << 4) | ONEPATTERN)   // 10001110
-#define ONEZEROPATTERN ((ONEPATTERN << 4) | ZEROPATTERN)   // 11101000
-#define ONEONEPATTERN ((ONEPATTERN << 4) | ONEPATTERN)     // 11101110
+static Pixel LEDBuf[ICLED_NUM];
 
 bool ICLED_Init(ICLED_Color_System color_system)
 {
     // set color System to given Color system
     ColorSystem = color_system;
 
+    // Restart if already initialized
+    if (spi != NULL)
+    {
+        ICLED_Deinit();
+    }
+
     // clear Buffer and set all values to zero
     ICLED_clear();
 
-    spi = new SPIClass(&sercom5, ICLED_DIN_PIN, ICLED_DIN_PIN, ICLED_DIN_PIN, SPI_PAD_2_SCK_3, SERCOM_RX_PAD_1);
+    spi = spiPool.create(&sercom5, ICLED_DIN_PIN, ICLED_DIN_PIN, ICLED_DIN_PIN, SPI_PAD_2_SCK_3, SERCOM_RX_PAD_1);
+    if (spi == NULL)
+    {
+        WE_DEBUG_PRINT("Failed to allocate SPI interface.\r\n");
+        return false;
+    }
     spi->begin();
 
+    WE_Memory_AddBuffer("icled-pixels", sizeof(LEDBuf));
+    WE_Memory_AddBuffer("icled-dma", sizeof(dmaBuf));
+
     if (pinPeripheral(ICLED_DIN_PIN, PIO_SERCOM) < 0)
     {
         WE_DEBUG_PRINT("Problem changing pin %d configuration.\r\n", ICLED_DIN_PIN);
+        ICLED_Deinit();
         return false;
     }
 
@@ -117,16 +149,22 @@ bool ICLED_Init(ICLED_Color_System color_system)
     if (dma.allocate() != DMA_STATUS_OK)
     {
         WE_DEBUG_PRINT("Failed to allocate DMA channel.\r\n");
+        ICLED_Deinit();
         return false;
     }
 
-    if (dma.addDescriptor(dmaBuf, (void *)(&SERCOM5->SPI.DATA.reg), ICLED_BYTESTOTAL, DMA_BEAT_SIZE_BYTE, true, false) == NULL)
+    dmaDesc = dma.addDescriptor(dmaBuf, (void *)(&SERCOM5->SPI.DATA.reg), ICLED_BYTESTOTAL, DMA_BEAT_SIZE_BYTE, true, false);
+    frame_source = dmaBuf;
+    if (dmaDesc == NULL)
     {
         WE_DEBUG_PRINT("Failed to allocate DMA descriptor.\r\n");
+        ICLED_Deinit();
         return false;
     }
 
     dma.loop(true);
+    dma.setCallback(dma_frame_done);
+    continuous_output = true;
 
     spi->beginTransaction(
         SPISettings(3200000, MSBFIRST, SPI_MODE0));
@@ -134,8 +172,11 @@ bool ICLED_Init(ICLED_Color_System color_system)
     if (dma.startJob() != DMA_STATUS_OK)
     {
         WE_DEBUG_PRINT("Failed to start DMA job.\r\n");
+        ICLED_Deinit();
         return false;
     }
+    frame_busy = true;
+    WE_Idle_LockStandby();
 
     return true;
 }
@@ -147,15 +188,30 @@ bool ICLED_Deinit()
 
     dma.abort();
 
-    if (dma.free() != DMA_STATUS_OK)
+    if (frame_busy)
     {
-        WE_DEBUG_PRINT("Failed to free DMA channel.\r\n");
-        return false;
+        frame_busy = false;
+        frame_pending = false;
+        WE_Idle_UnlockStandby();
     }
 
-    spi->endTransaction();
+    // Also called to clean up after a failed ICLED_Init(), the channel may not be allocated yet
+    bool freed = (dma.free() == DMA_STATUS_OK) || (dmaDesc == NULL);
+    dmaDesc = NULL;
 
-    delete spi;
+    if (spi != NULL)
+    {
+        spi->endTransaction();
+        spi->end();
+        spiPool.destroy(spi);
+        spi = NULL;
+    }
+
+    if (!freed)
+    {
+        WE_DEBUG_PRINT("Failed to free DMA channel.\r\n");
+        return false;
+    }
 
     return true;
 }
@@ -231,7 +287,9 @@ bool ICLED_set_pixel(uint16_t pixel_number, uint16_t R_H, uint16_t G_S, uint16_t
 
         // Convert HSV to RGB
         float r = 0, g = 0, b = 0;
+        WE_PROFILE_BEGIN(WE_PROFILE_ZONE_ICLED_HSV);
         HSV_to_RGB((float)R_H / 360, (float)G_S / 100, (float)B_V / 100, &r, &g, &b);
+        WE_PROFILE_END(WE_PROFILE_ZONE_ICLED_HSV);
         R_H = (uint8_t)(r * 255);
         G_S = (uint8_t)(g * 255);
         B_V = (uint8_t)(b * 255);
@@ -265,30 +323,15 @@ static inline uint8_t calculate_brightness(uint8_t color, uint8_t brightness)
 
 static void write_ledbuffer_to_DMAbuffer()
 {
-    for (int i = 0; i < ICLED_NUM; i++)
-    {
-        for (uint8_t colorIdx = 0; colorIdx < 3; colorIdx++)
-        {
-            for (uint8_t bitIdx = 0; bitIdx < 4; bitIdx++)
-            {
-                switch ((LEDBuf[i].GBR[colorIdx] << (2 * bitIdx)) & 0xC0)
-                { // mask upper two bit
-                case 0x00:
-                    dmaBuf[4 * 3 * i + 4 * colorIdx + bitIdx] = ZEROZEROPATTERN;
-                    break;
-                case 0x40:
-                    dmaBuf[4 * 3 * i + 4 * colorIdx + bitIdx] = ZEROONEPATTERN;
-                    break;
-                case 0x80:
-                    dmaBuf[4 * 3 * i + 4 * colorIdx + bitIdx] = ONEZEROPATTERN;
-                    break;
-                case 0xC0:
-                    dmaBuf[4 * 3 * i + 4 * colorIdx + bitIdx] = ONEONEPATTERN;
-                    break;
-                }
-            }
-        }
-    }
+    WE_FrameMonitor_Render(frame_busy && frame_source == dmaBuf);
+    WE_TRACE_BEGIN(WE_TRACE_ID_ICLED_ENCODE);
+    WE_PROFILE_BEGIN(WE_PROFILE_ZONE_ICLED_ENCODE);
+    WE_EVENT_BEGIN(WE_EVENT_ID_ICLED_ENCODE);
+    ICLED_encode_pixels(LEDBuf[0].GBR, ICLED_NUM, dmaBuf);
+    WE_EVENT_END(WE_EVENT_ID_ICLED_ENCODE);
+    WE_PROFILE_END(WE_PROFILE_ZONE_ICLED_ENCODE);
+    WE_TRACE_END(WE_TRACE_ID_ICLED_ENCODE);
+    output_frame();
 }
 
 bool ICLED_set_all_pixels(uint16_t R_H, uint16_t G_S, uint16_t B_V, uint8_t brightness, bool write_buffer)
@@ -315,6 +358,128 @@ void ICLED_clear(bool write_buffer)
 
     if (write_buffer)
     {
+        WE_FrameMonitor_Render(frame_busy && frame_source == dmaBuf);
         memset(dmaBuf, 0, sizeof(dmaBuf));
+        output_frame();
+    }
+}
+
+uint8_t *ICLED_get_pixel_buffer()
+{
+    return LEDBuf[0].GBR;
+}
+
+void ICLED_write_buffer()
+{
+    write_ledbuffer_to_DMAbuffer();
+}
+
+bool ICLED_play_encoded_frame(const uint8_t *frame)
+{
+    if (dmaDesc == NULL || frame == NULL)
+    {
+        return false;
     }
-}
\ No newline at end of file
+
+    WE_FrameMonitor_Render(false);
+
+    // The looping descriptor is reloaded after every frame, so the switch never tears a frame
+    dma.changeDescriptor(dmaDesc, (void *)frame, NULL, ICLED_BYTESTOTAL);
+    frame_source = frame;
+    output_frame();
+
+    return true;
+}
+
+bool ICLED_play_pixel_buffer()
+{
+    return ICLED_play_encoded_frame(dmaBuf);
+}
+
+bool ICLED_set_continuous_output(bool continuous)
+{
+    if (dmaDesc == NULL)
+    {
+        return false;
+    }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    continuous_output = continuous;
+    // A running frame finishes first: it either ends after the current pass or keeps looping
+    dma.loop(continuous);
+
+    if (continuous && !frame_busy)
+    {
+        frame_busy = true;
+        WE_Idle_LockStandby();
+        WE_FrameMonitor_DmaStart();
+        dma.startJob();
+    }
+
+    __set_PRIMASK(primask);
+    return true;
+}
+
+bool ICLED_frame_latched()
+{
+    return !frame_busy;
+}
+
+static void output_frame()
+{
+    if (dmaDesc == NULL)
+    {
+        return;
+    }
+
+    if (continuous_output)
+    {
+        // The looping transfer picks the frame up, there is no latch per frame
+        WE_FrameMonitor_DmaStart();
+        return;
+    }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (frame_busy)
+    {
+        // Restarted by dma_frame_done(), a frame is never cut short
+        frame_pending = true;
+    }
+    else
+    {
+        frame_busy = true;
+        WE_Idle_LockStandby();
+        WE_TRACE_BEGIN(WE_TRACE_ID_ICLED_DMA);
+        WE_EVENT_BEGIN(WE_EVENT_ID_ICLED_FRAME);
+        WE_FrameMonitor_DmaStart();
+        dma.startJob();
+    }
+
+    __set_PRIMASK(primask);
+}
+
+static void dma_frame_done(Adafruit_ZeroDMA *dma)
+{
+    WE_EVENT_BEGIN(WE_EVENT_ID_ICLED_DMA_ISR);
+    WE_EVENT_END(WE_EVENT_ID_ICLED_FRAME);
+    WE_FrameMonitor_Latch();
+
+    if (frame_pending || continuous_output)
+    {
+        frame_pending = false;
+        WE_EVENT_BEGIN(WE_EVENT_ID_ICLED_FRAME);
+        WE_FrameMonitor_DmaStart();
+        dma->startJob();
+        WE_EVENT_END(WE_EVENT_ID_ICLED_DMA_ISR);
+        return;
+    }
+
+    frame_busy = false;
+    WE_Idle_UnlockStandby();
+    WE_TRACE_END(WE_TRACE_ID_ICLED_DMA);
+    WE_EVENT_END(WE_EVENT_ID_ICLED_DMA_ISR);
+}
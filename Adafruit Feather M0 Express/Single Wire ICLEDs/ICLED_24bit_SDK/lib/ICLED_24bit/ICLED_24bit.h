@@ -126,4 +126,63 @@ ICLED_Color_System ICLED_get_color_system();
  */
 void ICLED_clear(bool write_buffer = true);
 
+/**
+ * @brief       Get direct access to the pixel buffer.
+ *
+ *              The buffer holds ICLED_NUM pixels of ICLED_BYTESPERPIXEL bytes each in the
+ *              order sent on the wire (G, R, B) with brightness already applied.
+ *              Call ICLED_write_buffer() to apply changes to the LED screen.
+ *
+ * @return      Pointer to the first byte of the pixel buffer.
+ */
+uint8_t *ICLED_get_pixel_buffer();
+
+/**
+ * @brief       Apply the current pixel buffer to the LED screen.
+ *
+ * @return      None
+ */
+void ICLED_write_buffer();
+
+/**
+ * @brief       Output a pre-encoded frame instead of the pixel buffer.
+ *
+ *              The frame is the exact SPI byte stream of ICLED_BYTESTOTAL bytes (see ICLED_24bit_encoder.h and
+ *              tools/encoded_frames) and is read by the DMA directly from where it is stored, e.g. const data
+ *              in flash. It keeps being sent until another frame is selected or ICLED_play_pixel_buffer() is called.
+ *
+ * @param[in]   frame: Pre-encoded frame, must remain valid while it is being output.
+ *
+ * @return      True if successful, false otherwise.
+ */
+bool ICLED_play_encoded_frame(const uint8_t *frame);
+
+/**
+ * @brief       Output the pixel buffer again after ICLED_play_encoded_frame().
+ *
+ * @return      True if successful, false otherwise.
+ */
+bool ICLED_play_pixel_buffer();
+
+/**
+ * @brief       Select continuous or single frame output.
+ *
+ *              In continuous output (default) the DMA sends the current frame over and over again.
+ *              In single frame output every frame is sent once when it is written (ICLED_write_buffer(),
+ *              ICLED_play_encoded_frame(), ...). The ICLEDs keep showing the latched frame, so the DMA stops
+ *              and the MCU may enter standby until the next frame (see idle.h).
+ *
+ * @param[in]   continuous: True for continuous output, false for single frame output.
+ *
+ * @return      True if successful, false otherwise.
+ */
+bool ICLED_set_continuous_output(bool continuous);
+
+/**
+ * @brief       Check whether the last frame has been sent completely and latched by the ICLEDs.
+ *
+ * @return      True if the output is idle, always false in continuous output.
+ */
+bool ICLED_frame_latched();
+
 #endif
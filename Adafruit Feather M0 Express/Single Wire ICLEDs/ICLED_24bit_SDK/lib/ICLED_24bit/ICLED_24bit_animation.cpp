@@ -0,0 +1,295 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+#include "ICLED_24bit_animation.h"
+#include "debug.h"
+
+#define FRACTION_BITS 16
+#define FRACTION_ONE ((uint32_t)1 << FRACTION_BITS)
+
+/**
+ * @brief       Read a little endian 16 bit value.
+ */
+static inline uint16_t read_u16(const uint8_t *data);
+
+/**
+ * @brief       Apply an easing curve to an interpolation fraction.
+ *
+ * @param[in]   easing: Easing curve. See ICLED_Easing.
+ * @param[in]   fraction: Linear fraction (0 - FRACTION_ONE).
+ *
+ * @return      Eased fraction (0 - FRACTION_ONE).
+ */
+static uint32_t apply_easing(uint8_t easing, uint32_t fraction);
+
+/**
+ * @brief       Calculate the color of a segment at the given time of the segment's timeline.
+ *
+ * @param[in]   keys: First key of the segment.
+ * @param[in]   key_count: Number of keys.
+ * @param[in]   loop: True if the last key moves back to the first one.
+ * @param[in]   t: Time within the segment's timeline (0 - period).
+ * @param[out]  color: Resulting color (R, G, B).
+ *
+ * @return      None
+ */
+static void evaluate_keys(const uint8_t *keys, uint8_t key_count, bool loop, uint32_t t, uint8_t color[3]);
+
+/**
+ * @brief       Interpolate a single color coordinate.
+ */
+static inline uint8_t lerp(uint8_t from, uint8_t to, uint32_t fraction);
+
+static inline uint16_t read_u16(const uint8_t *data)
+{
+    return (uint16_t)(data[0] | (data[1] << 8));
+}
+
+bool ICLED_animation_validate(const uint8_t *data, size_t length, uint16_t pixel_count)
+{
+    if (data == NULL || length < ICLED_ANIMATION_HEADER_SIZE || data[0] != 'K' || data[1] != 'F')
+    {
+        WE_DEBUG_PRINT("Animation header is invalid.\r\n");
+        return false;
+    }
+
+    if (data[2] != ICLED_ANIMATION_VERSION)
+    {
+        WE_DEBUG_PRINT("Animation version %d is not supported.\r\n", data[2]);
+        return false;
+    }
+
+    uint8_t segment_count = data[5];
+    size_t pos = ICLED_ANIMATION_HEADER_SIZE;
+
+    for (uint8_t s = 0; s < segment_count; s++)
+    {
+        if (length - pos < ICLED_ANIMATION_SEGMENT_SIZE)
+        {
+            WE_DEBUG_PRINT("Animation segment %d is truncated.\r\n", s);
+            return false;
+        }
+
+        const uint8_t *segment = &data[pos];
+        uint16_t first_pixel = read_u16(&segment[0]);
+        uint16_t count = read_u16(&segment[2]);
+        uint8_t key_count = segment[6];
+
+        if ((uint32_t)first_pixel + count > pixel_count)
+        {
+            WE_DEBUG_PRINT("Animation segment %d exceeds %d pixels.\r\n", s, pixel_count);
+            return false;
+        }
+
+        if (key_count == 0)
+        {
+            WE_DEBUG_PRINT("Animation segment %d has no keys.\r\n", s);
+            return false;
+        }
+
+        pos += ICLED_ANIMATION_SEGMENT_SIZE;
+
+        if (length - pos < (size_t)key_count * ICLED_ANIMATION_KEY_SIZE)
+        {
+            WE_DEBUG_PRINT("Animation segment %d keys are truncated.\r\n", s);
+            return false;
+        }
+
+        for (uint8_t k = 0; k < key_count; k++)
+        {
+            if (data[pos + k * ICLED_ANIMATION_KEY_SIZE + 3] >= ICLED_Easing_Count)
+            {
+                WE_DEBUG_PRINT("Animation segment %d key %d has invalid easing.\r\n", s, k);
+                return false;
+            }
+        }
+
+        pos += key_count * ICLED_ANIMATION_KEY_SIZE;
+    }
+
+    return true;
+}
+
+bool ICLED_animation_start(ICLED_Animation_Player *player, const uint8_t *data, size_t length, uint16_t pixel_count, uint32_t now_ms)
+{
+    if (!ICLED_animation_validate(data, length, pixel_count))
+    {
+        return false;
+    }
+
+    player->data = data;
+    player->length = length;
+    player->start_ms = now_ms;
+    player->duration_ms = 0;
+
+    // End of a non-looping animation: the segment that ends last, including the pixel delay
+    const uint8_t *segment = &data[ICLED_ANIMATION_HEADER_SIZE];
+    for (uint8_t s = 0; s < data[5]; s++)
+    {
+        uint16_t count = read_u16(&segment[2]);
+        int16_t pixel_delay = (int16_t)read_u16(&segment[4]);
+        uint8_t key_count = segment[6];
+        const uint8_t *keys = &segment[ICLED_ANIMATION_SEGMENT_SIZE];
+
+        uint32_t period = 0;
+        for (uint8_t k = 0; k < key_count; k++)
+        {
+            period += read_u16(&keys[k * ICLED_ANIMATION_KEY_SIZE + 4]);
+        }
+
+        uint32_t spread = (count > 0) ? (uint32_t)(pixel_delay < 0 ? -pixel_delay : pixel_delay) * (count - 1) : 0;
+        if (period + spread > player->duration_ms)
+        {
+            player->duration_ms = period + spread;
+        }
+
+        segment = keys + key_count * ICLED_ANIMATION_KEY_SIZE;
+    }
+
+    return true;
+}
+
+static uint32_t apply_easing(uint8_t easing, uint32_t fraction)
+{
+    switch (easing)
+    {
+    case ICLED_Easing_Step:
+        return 0;
+    case ICLED_Easing_EaseIn:
+        return (fraction * fraction) >> FRACTION_BITS;
+    case ICLED_Easing_EaseOut:
+    {
+        // Halve before squaring, (1 - f)^2 would overflow 32 bit for f = 0
+        uint32_t inverse = (FRACTION_ONE - fraction) >> 1;
+        return FRACTION_ONE - ((inverse * inverse) >> (FRACTION_BITS - 2));
+    }
+    case ICLED_Easing_EaseInOut:
+    {
+        // Smoothstep f * f * (3 - 2f), scaled down to stay within 32 bit
+        uint32_t square = (fraction * fraction) >> FRACTION_BITS;
+        return ((square >> 4) * (3 * FRACTION_ONE - 2 * fraction)) >> (FRACTION_BITS - 4);
+    }
+    case ICLED_Easing_Linear:
+    default:
+        return fraction;
+    }
+}
+
+static inline uint8_t lerp(uint8_t from, uint8_t to, uint32_t fraction)
+{
+    return (uint8_t)(from + ((((int32_t)to - (int32_t)from) * (int32_t)fraction) >> FRACTION_BITS));
+}
+
+static void evaluate_keys(const uint8_t *keys, uint8_t key_count, bool loop, uint32_t t, uint8_t color[3])
+{
+    for (uint8_t k = 0; k < key_count; k++)
+    {
+        const uint8_t *key = &keys[k * ICLED_ANIMATION_KEY_SIZE];
+        uint16_t duration = read_u16(&key[4]);
+        bool last = (k == key_count - 1);
+
+        if (t < duration && !(last && !loop))
+        {
+            const uint8_t *next = last ? keys : key + ICLED_ANIMATION_KEY_SIZE;
+            // duration < 2^16, so t << 16 fits into 32 bit
+            uint32_t fraction = apply_easing(key[3], (t << FRACTION_BITS) / duration);
+            color[0] = lerp(key[0], next[0], fraction);
+            color[1] = lerp(key[1], next[1], fraction);
+            color[2] = lerp(key[2], next[2], fraction);
+            return;
+        }
+
+        if (last)
+        {
+            break;
+        }
+        t -= duration;
+    }
+
+    // Hold the last key
+    const uint8_t *key = &keys[(key_count - 1) * ICLED_ANIMATION_KEY_SIZE];
+    color[0] = key[0];
+    color[1] = key[1];
+    color[2] = key[2];
+}
+
+bool ICLED_animation_render(const ICLED_Animation_Player *player, uint32_t now_ms, uint8_t *pixels)
+{
+    const uint8_t *data = player->data;
+    bool loop = (data[3] & ICLED_ANIMATION_FLAG_LOOP) != 0;
+    uint8_t brightness = data[4];
+    int32_t elapsed = (int32_t)(now_ms - player->start_ms);
+
+    const uint8_t *segment = &data[ICLED_ANIMATION_HEADER_SIZE];
+    for (uint8_t s = 0; s < data[5]; s++)
+    {
+        uint16_t first_pixel = read_u16(&segment[0]);
+        uint16_t count = read_u16(&segment[2]);
+        int16_t pixel_delay = (int16_t)read_u16(&segment[4]);
+        uint8_t key_count = segment[6];
+        const uint8_t *keys = &segment[ICLED_ANIMATION_SEGMENT_SIZE];
+
+        uint32_t period = 0;
+        for (uint8_t k = 0; k < key_count; k++)
+        {
+            period += read_u16(&keys[k * ICLED_ANIMATION_KEY_SIZE + 4]);
+        }
+
+        // A negative delay runs the segment from its last pixel towards the first one
+        int32_t offset = (pixel_delay < 0) ? -(int32_t)pixel_delay * (count - 1) : 0;
+        uint8_t color[3] = {0, 0, 0};
+
+        for (uint16_t p = 0; p < count; p++)
+        {
+            if (p == 0 || pixel_delay != 0)
+            {
+                int32_t t = elapsed - offset - (int32_t)pixel_delay * p;
+                if (t < 0)
+                {
+                    t = (loop && period > 0) ? (int32_t)(period - ((uint32_t)(-t) % period)) % (int32_t)period : 0;
+                }
+                else if (loop && period > 0)
+                {
+                    t = (uint32_t)t % period;
+                }
+
+                evaluate_keys(keys, key_count, loop, (uint32_t)t, color);
+
+                color[0] = (uint8_t)(((uint16_t)color[0] * brightness) / 255);
+                color[1] = (uint8_t)(((uint16_t)color[1] * brightness) / 255);
+                color[2] = (uint8_t)(((uint16_t)color[2] * brightness) / 255);
+            }
+
+            uint8_t *pixel = &pixels[(first_pixel + p) * 3];
+            pixel[0] = color[1];
+            pixel[1] = color[0];
+            pixel[2] = color[2];
+        }
+
+        segment = keys + key_count * ICLED_ANIMATION_KEY_SIZE;
+    }
+
+    return loop || elapsed < (int32_t)player->duration_ms;
+}
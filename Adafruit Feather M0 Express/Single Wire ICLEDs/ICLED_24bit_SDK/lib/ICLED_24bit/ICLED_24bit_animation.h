@@ -0,0 +1,127 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+#ifndef ICLED_24bit_ANIMATION_H
+#define ICLED_24bit_ANIMATION_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Keyframe animation format
+ *
+ * An animation is a constant byte array (stored in flash) made of a header followed by segments.
+ * Use the ICLED_ANIMATION_* macros below to write it down in C.
+ *
+ *   Header  (6 bytes): 'K', 'F', version, flags, brightness, segment count
+ *   Segment (8 bytes): first pixel (u16), pixel count (u16), pixel delay in ms (s16),
+ *                      key count, reserved, followed by the keys
+ *   Key     (6 bytes): R, G, B, easing, duration in ms (u16)
+ *
+ * All 16 bit values are little endian. A key's duration is the time needed to move from this
+ * key to the next one. With ICLED_ANIMATION_FLAG_LOOP set, the last key moves back to the first
+ * one and every segment repeats on its own period, otherwise the last key's duration is a hold
+ * time at the end of the segment. The pixel delay shifts the timeline of each pixel of the
+ * segment by that amount relative to its predecessor, which turns a fade into a wipe or wave.
+ *
+ * Playback keeps no per-frame state: every frame is computed from the elapsed time with
+ * fixed-point interpolation directly into the pixel buffer.
+ */
+
+#define ICLED_ANIMATION_VERSION 1
+
+#define ICLED_ANIMATION_FLAG_LOOP 0x01
+
+#define ICLED_ANIMATION_HEADER_SIZE 6
+#define ICLED_ANIMATION_SEGMENT_SIZE 8
+#define ICLED_ANIMATION_KEY_SIZE 6
+
+#define ICLED_ANIMATION_U16(value) (uint8_t)((value) & 0xFF), (uint8_t)(((value) >> 8) & 0xFF)
+
+#define ICLED_ANIMATION_HEADER(flags, brightness, segment_count) \
+    'K', 'F', ICLED_ANIMATION_VERSION, (flags), (brightness), (segment_count)
+
+#define ICLED_ANIMATION_SEGMENT(first_pixel, pixel_count, pixel_delay_ms, key_count) \
+    ICLED_ANIMATION_U16(first_pixel), ICLED_ANIMATION_U16(pixel_count), ICLED_ANIMATION_U16((uint16_t)(int16_t)(pixel_delay_ms)), (key_count), 0
+
+#define ICLED_ANIMATION_KEY(R, G, B, easing, duration_ms) \
+    (R), (G), (B), (easing), ICLED_ANIMATION_U16(duration_ms)
+
+typedef enum
+{
+    ICLED_Easing_Linear,
+    ICLED_Easing_Step,
+    ICLED_Easing_EaseIn,
+    ICLED_Easing_EaseOut,
+    ICLED_Easing_EaseInOut,
+    ICLED_Easing_Count,
+} ICLED_Easing;
+
+typedef struct
+{
+    const uint8_t *data;
+    size_t length;
+    uint32_t start_ms;
+    uint32_t duration_ms;
+} ICLED_Animation_Player;
+
+/**
+ * @brief       Check an animation for consistency.
+ *
+ * @param[in]   data: Animation data.
+ * @param[in]   length: Length of the animation data in bytes.
+ * @param[in]   pixel_count: Number of pixels that are available for playback.
+ *
+ * @return      True if the animation is valid, false otherwise.
+ */
+bool ICLED_animation_validate(const uint8_t *data, size_t length, uint16_t pixel_count);
+
+/**
+ * @brief       Start playback of an animation.
+ *
+ * @param[out]  player: Player to use.
+ * @param[in]   data: Animation data. Must remain valid during playback (e.g. const data in flash).
+ * @param[in]   length: Length of the animation data in bytes.
+ * @param[in]   pixel_count: Number of pixels that are available for playback.
+ * @param[in]   now_ms: Current time in milliseconds (e.g. WE_GetTick()).
+ *
+ * @return      True if successful, false if the animation is invalid.
+ */
+bool ICLED_animation_start(ICLED_Animation_Player *player, const uint8_t *data, size_t length, uint16_t pixel_count, uint32_t now_ms);
+
+/**
+ * @brief       Render the animation frame for the given time into a pixel buffer.
+ *
+ *              Pixels outside of all segments are not touched.
+ *
+ * @param[in]   player: Player.
+ * @param[in]   now_ms: Current time in milliseconds.
+ * @param[out]  pixels: Pixel buffer (3 bytes G, R, B per pixel), e.g. ICLED_get_pixel_buffer().
+ *
+ * @return      True while the animation is running, false once a non-looping animation has ended.
+ */
+bool ICLED_animation_render(const ICLED_Animation_Player *player, uint32_t now_ms, uint8_t *pixels);
+
+#endif
@@ -0,0 +1,311 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+#include <string.h>
+#include "ICLED_24bit_codec.h"
+#include "debug.h"
+
+/**
+ * @brief       Compare two pixels.
+ *
+ * @return      True if both pixels have the same color.
+ */
+static inline bool pixel_equal(const uint8_t *a, const uint8_t *b);
+
+/**
+ * @brief       Look up a color in the encoder palette.
+ *
+ * @return      Palette index or -1 if the color is not part of the palette.
+ */
+static int find_palette_index(const ICLED_Codec_Encoder *encoder, const uint8_t *pixel);
+
+void ICLED_codec_decoder_init(ICLED_Codec_Decoder *decoder)
+{
+    memset(decoder, 0, sizeof(*decoder));
+}
+
+bool ICLED_codec_decode(ICLED_Codec_Decoder *decoder, const uint8_t *data, size_t length, uint8_t *pixels, uint16_t pixel_count)
+{
+    const uint8_t *end = data + length;
+    uint16_t cursor = 0;
+
+    if (length < 1)
+    {
+        WE_DEBUG_PRINT("Frame update is empty.\r\n");
+        return false;
+    }
+
+    uint8_t flags = *data++;
+
+    if (flags & ICLED_CODEC_FLAG_PALETTE)
+    {
+        if (end - data < 2)
+        {
+            WE_DEBUG_PRINT("Frame update palette header is truncated.\r\n");
+            return false;
+        }
+
+        uint8_t first = data[0];
+        uint8_t count = data[1];
+        data += 2;
+
+        if ((uint16_t)first + count > ICLED_CODEC_PALETTE_SIZE || (size_t)(end - data) < (size_t)count * ICLED_CODEC_BYTESPERPIXEL)
+        {
+            WE_DEBUG_PRINT("Frame update palette is invalid.\r\n");
+            return false;
+        }
+
+        memcpy(decoder->palette[first], data, count * ICLED_CODEC_BYTESPERPIXEL);
+        data += count * ICLED_CODEC_BYTESPERPIXEL;
+    }
+
+    while (data < end)
+    {
+        uint8_t op = *data & ICLED_CODEC_OP_MASK;
+        uint16_t count = (*data & ICLED_CODEC_COUNT_MASK) + 1;
+        data++;
+
+        if (cursor + count > pixel_count)
+        {
+            WE_DEBUG_PRINT("Frame update exceeds %d pixels.\r\n", pixel_count);
+            return false;
+        }
+
+        uint8_t *dst = &pixels[cursor * ICLED_CODEC_BYTESPERPIXEL];
+
+        switch (op)
+        {
+        case ICLED_CODEC_OP_LITERAL:
+        {
+            size_t size = count * ICLED_CODEC_BYTESPERPIXEL;
+            if ((size_t)(end - data) < size)
+            {
+                WE_DEBUG_PRINT("Frame update literal is truncated.\r\n");
+                return false;
+            }
+            memcpy(dst, data, size);
+            data += size;
+            break;
+        }
+        case ICLED_CODEC_OP_RUN:
+        case ICLED_CODEC_OP_PALETTE:
+        {
+            const uint8_t *color;
+            if (op == ICLED_CODEC_OP_RUN)
+            {
+                if (end - data < ICLED_CODEC_BYTESPERPIXEL)
+                {
+                    WE_DEBUG_PRINT("Frame update run is truncated.\r\n");
+                    return false;
+                }
+                color = data;
+                data += ICLED_CODEC_BYTESPERPIXEL;
+            }
+            else
+            {
+                if (end - data < 1 || *data >= ICLED_CODEC_PALETTE_SIZE)
+                {
+                    WE_DEBUG_PRINT("Frame update palette reference is invalid.\r\n");
+                    return false;
+                }
+                color = decoder->palette[*data];
+                data++;
+            }
+            for (uint16_t i = 0; i < count; i++)
+            {
+                dst[0] = color[0];
+                dst[1] = color[1];
+                dst[2] = color[2];
+                dst += ICLED_CODEC_BYTESPERPIXEL;
+            }
+            break;
+        }
+        case ICLED_CODEC_OP_SKIP:
+        default:
+            break;
+        }
+
+        cursor += count;
+    }
+
+    return true;
+}
+
+void ICLED_codec_encoder_init(ICLED_Codec_Encoder *encoder)
+{
+    memset(encoder, 0, sizeof(*encoder));
+}
+
+bool ICLED_codec_encoder_set_palette(ICLED_Codec_Encoder *encoder, const uint8_t *colors, uint8_t count)
+{
+    if (count > ICLED_CODEC_PALETTE_SIZE)
+    {
+        WE_DEBUG_PRINT("Palette size should be between (0-%d).\r\n", ICLED_CODEC_PALETTE_SIZE);
+        return false;
+    }
+
+    memcpy(encoder->palette, colors, count * ICLED_CODEC_BYTESPERPIXEL);
+    encoder->palette_count = count;
+    encoder->palette_dirty = (count > 0);
+
+    return true;
+}
+
+static inline bool pixel_equal(const uint8_t *a, const uint8_t *b)
+{
+    return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+}
+
+static int find_palette_index(const ICLED_Codec_Encoder *encoder, const uint8_t *pixel)
+{
+    for (int i = 0; i < encoder->palette_count; i++)
+    {
+        if (pixel_equal(encoder->palette[i], pixel))
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+size_t ICLED_codec_encode(ICLED_Codec_Encoder *encoder, const uint8_t *previous, const uint8_t *current, uint16_t pixel_count, uint8_t *out, size_t out_size)
+{
+    size_t pos = 0;
+    uint16_t i = 0;
+    // Position of the opcode of the literal that is currently being extended, if any
+    size_t literal_pos = 0;
+    bool literal_open = false;
+
+    if (out_size < 1)
+    {
+        return 0;
+    }
+
+    out[pos++] = encoder->palette_dirty ? ICLED_CODEC_FLAG_PALETTE : 0;
+
+    if (encoder->palette_dirty)
+    {
+        if (out_size - pos < 2 + (size_t)encoder->palette_count * ICLED_CODEC_BYTESPERPIXEL)
+        {
+            return 0;
+        }
+        out[pos++] = 0;
+        out[pos++] = encoder->palette_count;
+        memcpy(&out[pos], encoder->palette, encoder->palette_count * ICLED_CODEC_BYTESPERPIXEL);
+        pos += encoder->palette_count * ICLED_CODEC_BYTESPERPIXEL;
+    }
+
+    while (i < pixel_count)
+    {
+        const uint8_t *pixel = &current[i * ICLED_CODEC_BYTESPERPIXEL];
+
+        // Pixels that did not change since the previous frame
+        uint16_t skip = 0;
+        if (previous != NULL)
+        {
+            while (i + skip < pixel_count && skip < ICLED_CODEC_MAX_COUNT &&
+                   pixel_equal(&current[(i + skip) * ICLED_CODEC_BYTESPERPIXEL], &previous[(i + skip) * ICLED_CODEC_BYTESPERPIXEL]))
+            {
+                skip++;
+            }
+        }
+
+        // Pixels with the same color as the current one
+        uint16_t run = 1;
+        while (i + run < pixel_count && run < ICLED_CODEC_MAX_COUNT &&
+               pixel_equal(&current[(i + run) * ICLED_CODEC_BYTESPERPIXEL], pixel))
+        {
+            run++;
+        }
+
+        int palette_index = find_palette_index(encoder, pixel);
+
+        if (skip > 0 && (skip >= run || skip > 1))
+        {
+            // Unchanged pixels at the end of the frame need no operation at all
+            if (i + skip < pixel_count)
+            {
+                if (out_size - pos < 1)
+                {
+                    return 0;
+                }
+                out[pos++] = ICLED_CODEC_OP_SKIP | (uint8_t)(skip - 1);
+            }
+            literal_open = false;
+            i += skip;
+        }
+        else if (palette_index >= 0)
+        {
+            if (out_size - pos < 2)
+            {
+                return 0;
+            }
+            out[pos++] = ICLED_CODEC_OP_PALETTE | (uint8_t)(run - 1);
+            out[pos++] = (uint8_t)palette_index;
+            literal_open = false;
+            i += run;
+        }
+        else if (run > 1)
+        {
+            if (out_size - pos < 1 + ICLED_CODEC_BYTESPERPIXEL)
+            {
+                return 0;
+            }
+            out[pos++] = ICLED_CODEC_OP_RUN | (uint8_t)(run - 1);
+            memcpy(&out[pos], pixel, ICLED_CODEC_BYTESPERPIXEL);
+            pos += ICLED_CODEC_BYTESPERPIXEL;
+            literal_open = false;
+            i += run;
+        }
+        else
+        {
+            if (literal_open && (out[literal_pos] & ICLED_CODEC_COUNT_MASK) < ICLED_CODEC_MAX_COUNT - 1)
+            {
+                out[literal_pos]++;
+            }
+            else
+            {
+                if (out_size - pos < 1)
+                {
+                    return 0;
+                }
+                literal_pos = pos;
+                literal_open = true;
+                out[pos++] = ICLED_CODEC_OP_LITERAL;
+            }
+            if (out_size - pos < ICLED_CODEC_BYTESPERPIXEL)
+            {
+                return 0;
+            }
+            memcpy(&out[pos], pixel, ICLED_CODEC_BYTESPERPIXEL);
+            pos += ICLED_CODEC_BYTESPERPIXEL;
+            i++;
+        }
+    }
+
+    encoder->palette_dirty = false;
+
+    return pos;
+}
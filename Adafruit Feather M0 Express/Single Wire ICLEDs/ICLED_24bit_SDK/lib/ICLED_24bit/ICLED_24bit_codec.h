@@ -0,0 +1,149 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+#ifndef ICLED_24bit_CODEC_H
+#define ICLED_24bit_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Compressed frame update format
+ *
+ * A frame update starts with a flags byte. If ICLED_CODEC_FLAG_PALETTE is set, a palette
+ * block follows: [first index][entry count][count * 3 bytes G, R, B].
+ * The rest of the update is a sequence of operations. Each operation starts with one opcode
+ * byte: the upper two bits select the operation, the lower six bits hold (pixel count - 1).
+ *
+ *   LITERAL  00cccccc  followed by count * 3 bytes (G, R, B)
+ *   RUN      01cccccc  followed by 3 bytes (G, R, B), repeated count times
+ *   SKIP     10cccccc  count pixels keep the color of the previous frame
+ *   PALETTE  11cccccc  followed by 1 byte palette index, repeated count times
+ *
+ * Pixels not covered by any operation keep the color of the previous frame.
+ * Colors are sent in the ICLED's native byte order with brightness already applied,
+ * so decoding is a plain copy into the pixel buffer.
+ */
+
+#define ICLED_CODEC_BYTESPERPIXEL 3
+#define ICLED_CODEC_PALETTE_SIZE 64
+#define ICLED_CODEC_MAX_COUNT 64
+
+#define ICLED_CODEC_FLAG_PALETTE 0x01
+
+#define ICLED_CODEC_OP_LITERAL 0x00
+#define ICLED_CODEC_OP_RUN 0x40
+#define ICLED_CODEC_OP_SKIP 0x80
+#define ICLED_CODEC_OP_PALETTE 0xC0
+
+#define ICLED_CODEC_OP_MASK 0xC0
+#define ICLED_CODEC_COUNT_MASK 0x3F
+
+/**
+ * @brief   Worst case size of an encoded frame update for the given number of pixels.
+ */
+#define ICLED_CODEC_MAX_FRAME_SIZE(pixel_count) \
+    (1 + 2 + (ICLED_CODEC_PALETTE_SIZE * ICLED_CODEC_BYTESPERPIXEL) + (pixel_count) * ICLED_CODEC_BYTESPERPIXEL + ((pixel_count) + ICLED_CODEC_MAX_COUNT - 1) / ICLED_CODEC_MAX_COUNT)
+
+/**
+ * @brief   Largest pixel count whose worst case frame update still fits into the 16 bit length
+ *          that precedes every frame update in encoded streams and show files.
+ */
+#define ICLED_CODEC_MAX_PIXEL_COUNT 21667
+
+typedef struct
+{
+    uint8_t palette[ICLED_CODEC_PALETTE_SIZE][ICLED_CODEC_BYTESPERPIXEL];
+} ICLED_Codec_Decoder;
+
+typedef struct
+{
+    uint8_t palette[ICLED_CODEC_PALETTE_SIZE][ICLED_CODEC_BYTESPERPIXEL];
+    uint8_t palette_count;
+    bool palette_dirty;
+} ICLED_Codec_Encoder;
+
+/**
+ * @brief       Reset the decoder state (clears the palette).
+ *
+ * @param[out]  decoder: Decoder to reset.
+ *
+ * @return      None
+ */
+void ICLED_codec_decoder_init(ICLED_Codec_Decoder *decoder);
+
+/**
+ * @brief       Decode a frame update into a pixel buffer.
+ *
+ *              The pixel buffer must contain the previous frame, it is updated in place.
+ *              On error the pixel buffer may be partially updated.
+ *
+ * @param[in]   decoder: Decoder holding the palette.
+ * @param[in]   data: Encoded frame update.
+ * @param[in]   length: Length of the encoded frame update in bytes.
+ * @param[out]  pixels: Pixel buffer (pixel_count * 3 bytes), e.g. ICLED_get_pixel_buffer().
+ * @param[in]   pixel_count: Number of pixels in the pixel buffer.
+ *
+ * @return      True if successful, false if the update is malformed.
+ */
+bool ICLED_codec_decode(ICLED_Codec_Decoder *decoder, const uint8_t *data, size_t length, uint8_t *pixels, uint16_t pixel_count);
+
+/**
+ * @brief       Reset the encoder state (clears the palette).
+ *
+ * @param[out]  encoder: Encoder to reset.
+ *
+ * @return      None
+ */
+void ICLED_codec_encoder_init(ICLED_Codec_Encoder *encoder);
+
+/**
+ * @brief       Set the palette used for palette references.
+ *
+ *              The palette is transmitted with the next encoded frame update.
+ *
+ * @param[in]   encoder: Encoder.
+ * @param[in]   colors: Palette entries (count * 3 bytes G, R, B).
+ * @param[in]   count: Number of palette entries (max. ICLED_CODEC_PALETTE_SIZE).
+ *
+ * @return      True if successful, false otherwise.
+ */
+bool ICLED_codec_encoder_set_palette(ICLED_Codec_Encoder *encoder, const uint8_t *colors, uint8_t count);
+
+/**
+ * @brief       Encode a frame update.
+ *
+ * @param[in]   encoder: Encoder.
+ * @param[in]   previous: Previous frame as seen by the decoder or NULL to encode a full frame.
+ * @param[in]   current: Frame to be encoded (pixel_count * 3 bytes).
+ * @param[in]   pixel_count: Number of pixels per frame.
+ * @param[out]  out: Output buffer.
+ * @param[in]   out_size: Size of the output buffer, ICLED_CODEC_MAX_FRAME_SIZE(pixel_count) is always sufficient.
+ *
+ * @return      Number of bytes written to out, 0 if the output buffer is too small.
+ */
+size_t ICLED_codec_encode(ICLED_Codec_Encoder *encoder, const uint8_t *previous, const uint8_t *current, uint16_t pixel_count, uint8_t *out, size_t out_size);
+
+#endif
@@ -26,9 +26,37 @@
 #include "global.h"
 #include "ICLED_24bit.h"
 #include "ICLED_24bit_demos.h"
+#include "ICLED_24bit_animation.h"
+#include "ICLED_24bit_codec.h"
+#include "ICLED_24bit_show_store.h"
+#include "ArduinoSPIFlash.h"
+
+// Three encoded frames: the one being read ahead, the one being sent and the previous one,
+// which the DMA may still be sending when the next frame is started
+#define SHOW_RING_SLOTS 3
+#define SHOW_HOLD_FRAMES 2
+
+static uint8_t ShowRing[SHOW_RING_SLOTS * (ICLED_BYTESTOTAL)] __attribute__((aligned(4)));
+
+/**
+ * @brief       Flash backend of the show store on the external SPI flash.
+ */
+static bool flash_read(void *context, uint32_t address, uint8_t *data, uint32_t length);
+static bool flash_read_async(void *context, uint32_t address, uint8_t *data, uint32_t length);
+static bool flash_is_busy(void *context);
+static bool flash_program(void *context, uint32_t address, const uint8_t *data, uint32_t length);
+static bool flash_erase_sector(void *context, uint32_t address);
+
+/**
+ * @brief       Initialize the SPI flash and its store backend.
+ *
+ * @return      True if successful, false otherwise.
+ */
+static bool flash_open(ICLED_Flash *flash);
 
 bool ICLED_demo_Blink(uint16_t pixel_number, uint8_t brightness, uint16_t delay_ms)
 {
+    WE_FrameMonitor_SetPeriod(delay_ms * 1000UL);
         ICLED_set_pixel(pixel_number, 255, 0, 0, brightness);
         WE_Delay(delay_ms);
 
@@ -57,6 +85,7 @@ bool ICLED_demo_Blink(uint16_t pixel_number, uint8_t brightness, uint16_t delay_
 
 bool ICLED_demo_Breathing(uint16_t brightness, uint16_t delay_ms)
 {
+    WE_FrameMonitor_SetPeriod(delay_ms * 1000UL);
     for (int i = 0; i <= brightness; i++)
     {
         ICLED_set_all_pixels(255, 255, 255, i);
@@ -78,6 +107,7 @@ bool ICLED_demo_Breathing(uint16_t brightness, uint16_t delay_ms)
 
 bool ICLED_demo_ColorWhipe(uint16_t R_H, uint16_t G_S, uint16_t B_V, uint8_t brightness, uint16_t delay_ms)
 {
+    WE_FrameMonitor_SetPeriod(delay_ms * 1000UL);
     for (int i = 0; i < ICLED_NUM; i++)
     {
         ICLED_set_pixel(i, R_H, G_S, B_V, brightness);
@@ -91,6 +121,7 @@ bool ICLED_demo_ColorWhipe(uint16_t R_H, uint16_t G_S, uint16_t B_V, uint8_t bri
 
 bool ICLED_demo_Cyclon(uint16_t R_H, uint16_t G_S, uint16_t B_V, uint8_t brightness, uint16_t delay_ms)
 {
+    WE_FrameMonitor_SetPeriod(delay_ms * 1000UL);
     // Scan from left to right
     for (int i = 0; i < ICLED_NUM; i++)
     {
@@ -116,6 +147,7 @@ bool ICLED_demo_Cyclon(uint16_t R_H, uint16_t G_S, uint16_t B_V, uint8_t brightn
 
 bool ICLED_demo_Rainbow(uint8_t brightness, uint16_t delay_ms) 
 {
+    WE_FrameMonitor_SetPeriod(delay_ms * 1000UL);
     for (int i = 0; i < 256; i++) 
     {
         for (int j = 0; j < ICLED_NUM; j++) 
@@ -129,8 +161,10 @@ bool ICLED_demo_Rainbow(uint8_t brightness, uint16_t delay_ms)
             uint8_t b = (pos < 85) ? (255 - pos * 3) : ((pos < 170) ? 0 : ((pos - 170) * 3));
 
             // Set the color of the j-th ICLED
-            ICLED_set_pixel(j, r, g, b, brightness);
+            ICLED_set_pixel(j, r, g, b, brightness, false);
         }
+        // Send all pixels as one frame
+        ICLED_write_buffer();
         // Wait for the specified delay before the next iteration
         WE_Delay(delay_ms);
     }
@@ -139,19 +173,222 @@ bool ICLED_demo_Rainbow(uint8_t brightness, uint16_t delay_ms)
 
 bool ICLED_demo_TheaterChase(uint16_t R_H, uint16_t G_S, uint16_t B_V, uint8_t brightness, uint16_t delay_ms) 
 {
+    WE_FrameMonitor_SetPeriod(delay_ms * 1000UL);
     for (int j = 0; j < 10; j++) 
     {  // Do 10 cycles of chasing
         for (int q = 0; q < 3; q++) 
         {
+            ICLED_clear(false);
             for (int i = 0; i < ICLED_NUM; i = i + 3) 
             {
-                ICLED_set_pixel(i + q, R_H, G_S, B_V, brightness); // Turn every third ICLED on
+                ICLED_set_pixel(i + q, R_H, G_S, B_V, brightness, false); // Turn every third ICLED on
             }
+            ICLED_write_buffer();
             
             WE_Delay(delay_ms);
-            
-            ICLED_clear();
         }
     }
     return true;
-}
\ No newline at end of file
+}
+
+bool ICLED_demo_Keyframes(const uint8_t *animation, size_t length, uint32_t duration_ms, uint16_t delay_ms)
+{
+    WE_FrameMonitor_SetPeriod(delay_ms * 1000UL);
+    ICLED_Animation_Player player;
+    uint32_t start = WE_GetTick();
+
+    if (!ICLED_animation_start(&player, animation, length, ICLED_NUM, start))
+    {
+        return false;
+    }
+
+    while (WE_GetTick() - start < duration_ms)
+    {
+        bool running = ICLED_animation_render(&player, WE_GetTick(), ICLED_get_pixel_buffer());
+        ICLED_write_buffer();
+
+        if (!running)
+        {
+            break;
+        }
+        WE_Delay(delay_ms);
+    }
+    return true;
+}
+
+bool ICLED_demo_EncodedFrames(const uint8_t *frames, uint16_t frame_count, uint16_t delay_ms)
+{
+    WE_FrameMonitor_SetPeriod(delay_ms * 1000UL);
+    for (uint16_t i = 0; i < frame_count; i++)
+    {
+        if (!ICLED_play_encoded_frame(&frames[(size_t)i * (ICLED_BYTESTOTAL)]))
+        {
+            return false;
+        }
+        WE_Delay(delay_ms);
+    }
+
+    return ICLED_play_pixel_buffer();
+}
+
+bool ICLED_demo_StoreShow(const char *name, const uint8_t *show, size_t length)
+{
+    ICLED_Flash flash;
+    ICLED_Store_Writer writer;
+
+    if (!flash_open(&flash))
+    {
+        return false;
+    }
+
+    // The flash may still hold something else, e.g. the CircuitPython FAT file system
+    if (!ICLED_store_check(&flash))
+    {
+        WE_DEBUG_PRINT("Formatting the show store.\r\n");
+        if (!ICLED_store_format(&flash))
+        {
+            SPIFlash_deinit();
+            return false;
+        }
+    }
+
+    bool ok = ICLED_store_append_begin(&writer, &flash, name, length) &&
+              ICLED_store_append(&writer, show, length) &&
+              ICLED_store_append_end(&writer);
+
+    SPIFlash_deinit();
+    return ok;
+}
+
+bool ICLED_demo_FlashShow(const char *name, uint32_t duration_ms)
+{
+    ICLED_Flash flash;
+    ICLED_Store_Entry entry;
+    ICLED_Show_Player player;
+    ICLED_Codec_Decoder decoder;
+    bool ok = true;
+
+    WE_Memory_AddBuffer("icled-show-ring", sizeof(ShowRing));
+
+    if (!flash_open(&flash))
+    {
+        return false;
+    }
+
+    if (!ICLED_store_find(&flash, name, &entry) ||
+        !ICLED_show_player_open(&player, &flash, &entry, ShowRing, sizeof(ShowRing), SHOW_HOLD_FRAMES, true))
+    {
+        WE_DEBUG_PRINT("Show %s not found.\r\n", name);
+        SPIFlash_deinit();
+        return false;
+    }
+
+    bool encoded = (player.header.format == ICLED_Show_Format_Encoded);
+    if (player.header.pixel_count != ICLED_NUM || (encoded && player.slot_size != (ICLED_BYTESTOTAL)))
+    {
+        WE_DEBUG_PRINT("Show %s does not match %d ICLEDs.\r\n", name, ICLED_NUM);
+        SPIFlash_deinit();
+        return false;
+    }
+
+    ICLED_codec_decoder_init(&decoder);
+    WE_FrameMonitor_SetPeriod(player.header.frame_period_ms * 1000UL);
+
+    uint32_t start = WE_GetTick();
+    uint32_t next_frame = start;
+
+    while (ok && WE_GetTick() - start < duration_ms)
+    {
+        // Read ahead while waiting for the next frame
+        ok = ICLED_show_player_poll(&player);
+        if ((int32_t)(WE_GetTick() - next_frame) < 0)
+        {
+#if defined(WE_DEBUG)
+            // WE_Delay() is not used here, send the queued debug output meanwhile
+            WE_Debug_Process();
+#endif
+            continue;
+        }
+        next_frame += player.header.frame_period_ms;
+
+        uint32_t length;
+        const uint8_t *frame = ICLED_show_player_take(&player, &length);
+        if (frame == NULL)
+        {
+            continue;
+        }
+
+        if (encoded)
+        {
+            ok = ICLED_play_encoded_frame(frame);
+        }
+        else if (ICLED_codec_decode(&decoder, frame, length, ICLED_get_pixel_buffer(), ICLED_NUM))
+        {
+            ICLED_write_buffer();
+        }
+        else
+        {
+            ok = false;
+        }
+    }
+
+    if (player.underruns > 0)
+    {
+        WE_DEBUG_INFO("Show %s: %lu frames, %lu underruns.\r\n", name, (unsigned long)player.frames_played, (unsigned long)player.underruns);
+    }
+
+    while (SPIFlash_isBusy())
+    {
+    }
+    SPIFlash_deinit();
+
+    return ICLED_play_pixel_buffer() && ok;
+}
+
+static bool flash_open(ICLED_Flash *flash)
+{
+    if (!SPIFlash_init())
+    {
+        WE_DEBUG_PRINT("SPI flash not found.\r\n");
+        return false;
+    }
+
+    flash->context = NULL;
+    flash->size = SPIFlash_getSize();
+    flash->read = flash_read;
+    flash->read_async = flash_read_async;
+    flash->is_busy = flash_is_busy;
+    flash->program = flash_program;
+    flash->erase_sector = flash_erase_sector;
+    return true;
+}
+
+static bool flash_read(void *context, uint32_t address, uint8_t *data, uint32_t length)
+{
+    (void)context;
+    return SPIFlash_read(address, data, length);
+}
+
+static bool flash_read_async(void *context, uint32_t address, uint8_t *data, uint32_t length)
+{
+    (void)context;
+    return SPIFlash_readAsync(address, data, length);
+}
+
+static bool flash_is_busy(void *context)
+{
+    (void)context;
+    return SPIFlash_isBusy();
+}
+
+static bool flash_program(void *context, uint32_t address, const uint8_t *data, uint32_t length)
+{
+    (void)context;
+    return SPIFlash_program(address, data, length);
+}
+
+static bool flash_erase_sector(void *context, uint32_t address)
+{
+    (void)context;
+    return SPIFlash_eraseSector(address);
+}
@@ -105,4 +105,49 @@ bool ICLED_demo_Rainbow(uint8_t brightness, uint16_t delay_ms);
  */
 bool ICLED_demo_TheaterChase(uint16_t R_H, uint16_t G_S, uint16_t B_V, uint8_t brightness, uint16_t delay_ms);
 
+/** 
+ * @brief       Plays a keyframe animation stored in flash (see ICLED_24bit_animation.h) for the given time
+ *
+ * @param[in]   animation: Animation data.
+ * @param[in]   length: Length of the animation data in bytes.
+ * @param[in]   duration_ms: Playback time (in miliseconds), a non-looping animation stops earlier when it has ended
+ * @param[in]   delay_ms: Delay time between two frames (in miliseconds)
+ *
+ * @return      True if successful, false otherwise.
+ */
+bool ICLED_demo_Keyframes(const uint8_t *animation, size_t length, uint32_t duration_ms, uint16_t delay_ms);
+
+/** 
+ * @brief       Plays a sequence of pre-encoded frames (see tools/encoded_frames) that the DMA reads directly from flash
+ *
+ * @param[in]   frames: Pre-encoded frames, ICLED_BYTESTOTAL bytes each.
+ * @param[in]   frame_count: Number of frames.
+ * @param[in]   delay_ms: Delay time for the animation (in miliseconds)
+ *
+ * @return      True if successful, false otherwise.
+ */
+bool ICLED_demo_EncodedFrames(const uint8_t *frames, uint16_t frame_count, uint16_t delay_ms);
+
+/** 
+ * @brief       Writes a show file (see tools/show_compiler) into the show store on the external SPI flash.
+ *              A flash that does not hold a show store yet is formatted first.
+ *
+ * @param[in]   name: Name of the show in the store (max. ICLED_STORE_NAME_LENGTH characters).
+ * @param[in]   show: Show file data.
+ * @param[in]   length: Length of the show file in bytes.
+ *
+ * @return      True if successful, false otherwise.
+ */
+bool ICLED_demo_StoreShow(const char *name, const uint8_t *show, size_t length);
+
+/** 
+ * @brief       Streams a show from the external SPI flash in a loop for the given time, frames are read ahead by DMA while the previous frame is sent
+ *
+ * @param[in]   name: Name of the show in the store.
+ * @param[in]   duration_ms: Playback time (in miliseconds)
+ *
+ * @return      True if successful, false otherwise.
+ */
+bool ICLED_demo_FlashShow(const char *name, uint32_t duration_ms);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,42 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+#include "ICLED_24bit_encoder.h"
+
+// SPI byte for the two upper bits of a value
+static const uint8_t BitPairPattern[4] = {ZEROZEROPATTERN, ZEROONEPATTERN, ONEZEROPATTERN, ONEONEPATTERN};
+
+void ICLED_encode_pixels(const uint8_t *pixels, uint16_t pixel_count, uint8_t *out)
+{
+    for (uint32_t i = 0; i < (uint32_t)pixel_count * 3; i++)
+    {
+        uint8_t value = pixels[i];
+        out[0] = BitPairPattern[(value >> 6) & 0x3];
+        out[1] = BitPairPattern[(value >> 4) & 0x3];
+        out[2] = BitPairPattern[(value >> 2) & 0x3];
+        out[3] = BitPairPattern[value & 0x3];
+        out += ICLED_ENCODED_BYTESPERBYTE;
+    }
+}
@@ -0,0 +1,66 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+#ifndef ICLED_24bit_ENCODER_H
+#define ICLED_24bit_ENCODER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * SPI waveform encoding
+ *
+ * The ICLED data line is driven by the SPI MOSI output at 3.2 MHz. Every data bit is sent as
+ * one 4 bit SPI pattern (1000 for a logical "0", 1110 for a logical "1"), so each pixel byte
+ * becomes 4 SPI bytes. A frame is followed by ICLED_LATCHBYTECOUNT zero bytes to latch it.
+ */
+
+#define ZEROPATTERN 0x8 // 4-bit
+#define ONEPATTERN 0xE  // 4-bit
+
+#define ZEROZEROPATTERN ((ZEROPATTERN << 4) | ZEROPATTERN) // 10001000
+#define ZEROONEPATTERN ((ZEROPATTERN << 4) | ONEPATTERN)   // 10001110
+#define ONEZEROPATTERN ((ONEPATTERN << 4) | ZEROPATTERN)   // 11101000
+#define ONEONEPATTERN ((ONEPATTERN << 4) | ONEPATTERN)     // 11101110
+
+#define ICLED_ENCODED_BYTESPERBYTE 4
+
+/**
+ * @brief       Size of a complete encoded frame (pixel data and latch) in bytes.
+ */
+#define ICLED_ENCODED_FRAME_SIZE(pixel_count, latch_bytes) ((pixel_count) * 3 * ICLED_ENCODED_BYTESPERBYTE + (latch_bytes))
+
+/**
+ * @brief       Bit-expand pixels into the SPI byte stream.
+ *
+ * @param[in]   pixels: Pixels (3 bytes G, R, B per pixel).
+ * @param[in]   pixel_count: Number of pixels.
+ * @param[out]  out: SPI byte stream (pixel_count * 12 bytes). The latch bytes are not written.
+ *
+ * @return      None
+ */
+void ICLED_encode_pixels(const uint8_t *pixels, uint16_t pixel_count, uint8_t *out);
+
+#endif
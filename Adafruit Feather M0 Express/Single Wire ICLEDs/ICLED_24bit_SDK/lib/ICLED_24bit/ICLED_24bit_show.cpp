@@ -0,0 +1,76 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+#include <string.h>
+#include "ICLED_24bit_show.h"
+#include "debug.h"
+
+static const uint8_t ShowMagic[4] = {'I', 'C', 'S', 'H'};
+
+bool ICLED_show_read_header(const uint8_t *data, ICLED_Show_Header *header)
+{
+    if (memcmp(data, ShowMagic, sizeof(ShowMagic)) != 0)
+    {
+        WE_DEBUG_PRINT("Show header is invalid.\r\n");
+        return false;
+    }
+
+    if (data[4] != ICLED_SHOW_VERSION)
+    {
+        WE_DEBUG_PRINT("Show version %d is not supported.\r\n", data[4]);
+        return false;
+    }
+
+    if (data[5] != ICLED_Show_Format_Codec && data[5] != ICLED_Show_Format_Encoded)
+    {
+        WE_DEBUG_PRINT("Show format %d is not supported.\r\n", data[5]);
+        return false;
+    }
+
+    header->format = (ICLED_Show_Format)data[5];
+    header->pixel_count = (uint16_t)(data[6] | (data[7] << 8));
+    header->frame_count = (uint32_t)data[8] | ((uint32_t)data[9] << 8) | ((uint32_t)data[10] << 16) | ((uint32_t)data[11] << 24);
+    header->frame_period_ms = (uint16_t)(data[12] | (data[13] << 8));
+    header->latch_bytes = (uint16_t)(data[14] | (data[15] << 8));
+
+    return true;
+}
+
+void ICLED_show_write_header(const ICLED_Show_Header *header, uint8_t *data)
+{
+    memcpy(data, ShowMagic, sizeof(ShowMagic));
+    data[4] = ICLED_SHOW_VERSION;
+    data[5] = (uint8_t)header->format;
+    data[6] = (uint8_t)(header->pixel_count & 0xFF);
+    data[7] = (uint8_t)(header->pixel_count >> 8);
+    data[8] = (uint8_t)(header->frame_count & 0xFF);
+    data[9] = (uint8_t)((header->frame_count >> 8) & 0xFF);
+    data[10] = (uint8_t)((header->frame_count >> 16) & 0xFF);
+    data[11] = (uint8_t)(header->frame_count >> 24);
+    data[12] = (uint8_t)(header->frame_period_ms & 0xFF);
+    data[13] = (uint8_t)(header->frame_period_ms >> 8);
+    data[14] = (uint8_t)(header->latch_bytes & 0xFF);
+    data[15] = (uint8_t)(header->latch_bytes >> 8);
+}
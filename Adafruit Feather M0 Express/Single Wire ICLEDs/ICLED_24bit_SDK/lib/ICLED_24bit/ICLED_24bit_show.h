@@ -0,0 +1,89 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+#ifndef ICLED_24bit_SHOW_H
+#define ICLED_24bit_SHOW_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Show file format
+ *
+ * A show is a pre-rendered frame sequence as produced by tools/show_compiler.
+ *
+ *   Header (16 bytes): "ICSH", version, format, pixel count (u16), frame count (u32),
+ *                      frame period in ms (u16), latch bytes (u16)
+ *
+ * followed by the frames in one of two formats:
+ *
+ *   ICLED_Show_Format_Codec:   per frame a length (u16) and a frame update (see ICLED_24bit_codec.h),
+ *                              the first frame is a full frame
+ *   ICLED_Show_Format_Encoded: per frame the exact SPI byte stream including the latch bytes
+ *                              (see ICLED_24bit_encoder.h), ready to be sent by the DMA
+ *
+ * All multi-byte values are little endian.
+ */
+
+#define ICLED_SHOW_VERSION 1
+#define ICLED_SHOW_HEADER_SIZE 16
+#define ICLED_SHOW_FRAME_LENGTH_SIZE 2
+
+typedef enum
+{
+    ICLED_Show_Format_Codec = 0,
+    ICLED_Show_Format_Encoded = 1,
+} ICLED_Show_Format;
+
+typedef struct
+{
+    ICLED_Show_Format format;
+    uint16_t pixel_count;
+    uint32_t frame_count;
+    uint16_t frame_period_ms;
+    uint16_t latch_bytes;
+} ICLED_Show_Header;
+
+/**
+ * @brief       Parse and check a show header.
+ *
+ * @param[in]   data: First ICLED_SHOW_HEADER_SIZE bytes of the show.
+ * @param[out]  header: Parsed header.
+ *
+ * @return      True if the header is valid, false otherwise.
+ */
+bool ICLED_show_read_header(const uint8_t *data, ICLED_Show_Header *header);
+
+/**
+ * @brief       Serialize a show header.
+ *
+ * @param[in]   header: Header to write.
+ * @param[out]  data: Output buffer of ICLED_SHOW_HEADER_SIZE bytes.
+ *
+ * @return      None
+ */
+void ICLED_show_write_header(const ICLED_Show_Header *header, uint8_t *data);
+
+#endif
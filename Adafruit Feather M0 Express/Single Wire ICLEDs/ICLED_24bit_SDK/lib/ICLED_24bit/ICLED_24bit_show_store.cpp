@@ -0,0 +1,459 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+#include <string.h>
+#include "ICLED_24bit_show_store.h"
+#include "ICLED_24bit_codec.h"
+#include "ICLED_24bit_encoder.h"
+#include "debug.h"
+
+#define STORE_STATE_OFFSET 24
+#define STORE_STATE_WRITING 0xFF
+#define STORE_STATE_COMPLETE 0x00
+
+#define ALIGN_UP(value, alignment) ((((value) + (alignment) - 1) / (alignment)) * (alignment))
+
+static const uint8_t EntryMagic[4] = {'I', 'C', 'S', 'E'};
+
+/**
+ * @brief       Program data of any length, split at page boundaries.
+ *
+ * @return      True if successful, false otherwise.
+ */
+static bool store_program(const ICLED_Flash *flash, uint32_t address, const uint8_t *data, uint32_t length);
+
+/**
+ * @brief       Find the end of the log, i.e. the address of the next entry header.
+ *
+ * @return      True if successful, false if the log is corrupted.
+ */
+static bool store_find_end(const ICLED_Flash *flash, uint32_t *end);
+
+/**
+ * @brief       Start reading the next frame into the free slot.
+ *
+ * @return      True if successful, false otherwise.
+ */
+static bool player_read_frame(ICLED_Show_Player *player);
+
+bool ICLED_store_format(const ICLED_Flash *flash)
+{
+    // Sectors behind the log are erased when the log grows into them
+    if (!flash->erase_sector(flash->context, 0))
+    {
+        WE_DEBUG_PRINT("Erasing flash failed.\r\n");
+        return false;
+    }
+    return true;
+}
+
+bool ICLED_store_check(const ICLED_Flash *flash)
+{
+    uint32_t end;
+    return store_find_end(flash, &end);
+}
+
+bool ICLED_store_next(const ICLED_Flash *flash, uint32_t *address, ICLED_Store_Entry *entry)
+{
+    uint8_t header[ICLED_STORE_HEADER_SIZE];
+    static const uint8_t erased[4] = {0xFF, 0xFF, 0xFF, 0xFF};
+
+    if (*address + ICLED_STORE_HEADER_SIZE > flash->size)
+    {
+        return false;
+    }
+
+    if (!flash->read(flash->context, *address, header, sizeof(header)))
+    {
+        WE_DEBUG_PRINT("Reading flash failed.\r\n");
+        return false;
+    }
+
+    if (memcmp(header, erased, sizeof(erased)) == 0)
+    {
+        return false;
+    }
+
+    if (memcmp(header, EntryMagic, sizeof(EntryMagic)) != 0)
+    {
+        WE_DEBUG_PRINT("Store entry at 0x%06lX is invalid.\r\n", (unsigned long)*address);
+        return false;
+    }
+
+    entry->length = (uint32_t)header[4] | ((uint32_t)header[5] << 8) | ((uint32_t)header[6] << 16) | ((uint32_t)header[7] << 24);
+    entry->address = *address + ICLED_STORE_HEADER_SIZE;
+    entry->complete = (header[STORE_STATE_OFFSET] == STORE_STATE_COMPLETE);
+    memcpy(entry->name, &header[8], ICLED_STORE_NAME_LENGTH);
+    entry->name[ICLED_STORE_NAME_LENGTH] = '\0';
+
+    if (entry->length > flash->size - entry->address)
+    {
+        WE_DEBUG_PRINT("Store entry at 0x%06lX exceeds the flash.\r\n", (unsigned long)*address);
+        return false;
+    }
+
+    *address = ALIGN_UP(entry->address + entry->length, ICLED_STORE_PAGE_SIZE);
+    return true;
+}
+
+bool ICLED_store_find(const ICLED_Flash *flash, const char *name, ICLED_Store_Entry *entry)
+{
+    ICLED_Store_Entry current;
+    uint32_t address = 0;
+    bool found = false;
+
+    while (ICLED_store_next(flash, &address, &current))
+    {
+        if (current.complete && strncmp(current.name, name, ICLED_STORE_NAME_LENGTH) == 0)
+        {
+            *entry = current;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+bool ICLED_store_append_begin(ICLED_Store_Writer *writer, const ICLED_Flash *flash, const char *name, uint32_t length)
+{
+    uint8_t header[ICLED_STORE_HEADER_SIZE];
+    uint32_t end;
+
+    if (strlen(name) > ICLED_STORE_NAME_LENGTH)
+    {
+        WE_DEBUG_PRINT("Store entry name is longer than %d characters.\r\n", ICLED_STORE_NAME_LENGTH);
+        return false;
+    }
+
+    if (!store_find_end(flash, &end))
+    {
+        return false;
+    }
+
+    if (end + ICLED_STORE_HEADER_SIZE > flash->size || length > flash->size - end - ICLED_STORE_HEADER_SIZE)
+    {
+        WE_DEBUG_PRINT("Store is full.\r\n");
+        return false;
+    }
+
+    // Erase every sector the entry touches before writing anything, so an interrupted
+    // entry never leaves stale data inside the log. The sector holding a non-aligned
+    // end of the log has been erased together with the previous entry.
+    for (uint32_t sector = ALIGN_UP(end, ICLED_STORE_SECTOR_SIZE); sector < end + ICLED_STORE_HEADER_SIZE + length; sector += ICLED_STORE_SECTOR_SIZE)
+    {
+        if (!flash->erase_sector(flash->context, sector))
+        {
+            WE_DEBUG_PRINT("Erasing flash failed.\r\n");
+            return false;
+        }
+    }
+
+    memset(header, 0xFF, sizeof(header));
+    memcpy(header, EntryMagic, sizeof(EntryMagic));
+    header[4] = (uint8_t)(length & 0xFF);
+    header[5] = (uint8_t)((length >> 8) & 0xFF);
+    header[6] = (uint8_t)((length >> 16) & 0xFF);
+    header[7] = (uint8_t)(length >> 24);
+    memset(&header[8], 0, ICLED_STORE_NAME_LENGTH);
+    memcpy(&header[8], name, strlen(name));
+
+    if (!store_program(flash, end, header, sizeof(header)))
+    {
+        return false;
+    }
+
+    writer->flash = flash;
+    writer->header_address = end;
+    writer->address = end + ICLED_STORE_HEADER_SIZE;
+    writer->end = writer->address + length;
+    return true;
+}
+
+bool ICLED_store_append(ICLED_Store_Writer *writer, const uint8_t *data, uint32_t length)
+{
+    if (length > writer->end - writer->address)
+    {
+        WE_DEBUG_PRINT("Data exceeds the store entry.\r\n");
+        return false;
+    }
+
+    if (!store_program(writer->flash, writer->address, data, length))
+    {
+        return false;
+    }
+
+    writer->address += length;
+    return true;
+}
+
+bool ICLED_store_append_end(ICLED_Store_Writer *writer)
+{
+    static const uint8_t complete = STORE_STATE_COMPLETE;
+
+    if (writer->address != writer->end)
+    {
+        WE_DEBUG_PRINT("Store entry is incomplete.\r\n");
+        return false;
+    }
+
+    return store_program(writer->flash, writer->header_address + STORE_STATE_OFFSET, &complete, 1);
+}
+
+static bool store_program(const ICLED_Flash *flash, uint32_t address, const uint8_t *data, uint32_t length)
+{
+    while (length > 0)
+    {
+        uint32_t chunk = ICLED_STORE_PAGE_SIZE - (address % ICLED_STORE_PAGE_SIZE);
+        if (chunk > length)
+        {
+            chunk = length;
+        }
+
+        if (!flash->program(flash->context, address, data, chunk))
+        {
+            WE_DEBUG_PRINT("Programming flash failed.\r\n");
+            return false;
+        }
+
+        address += chunk;
+        data += chunk;
+        length -= chunk;
+    }
+    return true;
+}
+
+static bool store_find_end(const ICLED_Flash *flash, uint32_t *end)
+{
+    ICLED_Store_Entry entry;
+    uint8_t magic[sizeof(EntryMagic)];
+    uint32_t address = 0;
+
+    while (ICLED_store_next(flash, &address, &entry))
+    {
+    }
+
+    // ICLED_store_next stops at the first erased header, anything else means corruption
+    if (address + ICLED_STORE_HEADER_SIZE <= flash->size)
+    {
+        if (!flash->read(flash->context, address, magic, sizeof(magic)))
+        {
+            WE_DEBUG_PRINT("Reading flash failed.\r\n");
+            return false;
+        }
+        for (size_t i = 0; i < sizeof(magic); i++)
+        {
+            if (magic[i] != 0xFF)
+            {
+                WE_DEBUG_PRINT("Store is corrupted, format it.\r\n");
+                return false;
+            }
+        }
+    }
+
+    *end = address;
+    return true;
+}
+
+size_t ICLED_show_player_slot_size(const ICLED_Show_Header *header)
+{
+    if (header->format == ICLED_Show_Format_Encoded)
+    {
+        return ICLED_ENCODED_FRAME_SIZE(header->pixel_count, header->latch_bytes);
+    }
+    return ICLED_CODEC_MAX_FRAME_SIZE(header->pixel_count);
+}
+
+bool ICLED_show_player_open(ICLED_Show_Player *player, const ICLED_Flash *flash, const ICLED_Store_Entry *entry,
+                            uint8_t *ring, size_t ring_size, uint8_t hold, bool loop)
+{
+    uint8_t data[ICLED_SHOW_HEADER_SIZE];
+
+    memset(player, 0, sizeof(*player));
+
+    if (entry->length < ICLED_SHOW_HEADER_SIZE || !flash->read(flash->context, entry->address, data, sizeof(data)) ||
+        !ICLED_show_read_header(data, &player->header))
+    {
+        WE_DEBUG_PRINT("Store entry %s is no show.\r\n", entry->name);
+        return false;
+    }
+
+    size_t slot_size = ICLED_show_player_slot_size(&player->header);
+    size_t slot_count = ring_size / slot_size;
+    if (slot_count > ICLED_SHOW_PLAYER_MAX_SLOTS)
+    {
+        slot_count = ICLED_SHOW_PLAYER_MAX_SLOTS;
+    }
+    if (slot_count < (size_t)hold + 1)
+    {
+        WE_DEBUG_PRINT("Ring buffer of %d bytes is too small.\r\n", (int)ring_size);
+        return false;
+    }
+
+    if (player->header.format == ICLED_Show_Format_Encoded &&
+        entry->length != ICLED_SHOW_HEADER_SIZE + player->header.frame_count * slot_size)
+    {
+        WE_DEBUG_PRINT("Show %s is truncated.\r\n", entry->name);
+        return false;
+    }
+
+    player->flash = flash;
+    player->frames_address = entry->address + ICLED_SHOW_HEADER_SIZE;
+    player->frames_end = entry->address + entry->length;
+    player->read_address = player->frames_address;
+    player->loop = loop;
+    player->ring = ring;
+    player->slot_size = (uint32_t)slot_size;
+    player->slot_count = (uint8_t)slot_count;
+    player->hold = hold;
+
+    return ICLED_show_player_poll(player);
+}
+
+bool ICLED_show_player_poll(ICLED_Show_Player *player)
+{
+    const ICLED_Flash *flash = player->flash;
+
+    if (player->reading)
+    {
+        if (flash->is_busy != NULL && flash->is_busy(flash->context))
+        {
+            return true;
+        }
+        player->reading = false;
+        player->ready++;
+    }
+
+    while (player->ready + player->taken < player->slot_count)
+    {
+        if (player->frames_read == player->header.frame_count)
+        {
+            if (!player->loop || player->header.frame_count == 0)
+            {
+                break;
+            }
+            player->frames_read = 0;
+            player->read_address = player->frames_address;
+        }
+
+        if (!player_read_frame(player))
+        {
+            return false;
+        }
+
+        if (player->reading)
+        {
+            // One DMA read at a time, it is completed by a later poll
+            break;
+        }
+        player->ready++;
+    }
+
+    return true;
+}
+
+static bool player_read_frame(ICLED_Show_Player *player)
+{
+    const ICLED_Flash *flash = player->flash;
+    uint8_t slot = (player->next + player->ready) % player->slot_count;
+    uint8_t *data = &player->ring[(size_t)slot * player->slot_size];
+    uint32_t address = player->read_address;
+    uint32_t length = player->slot_size;
+
+    if (player->header.format == ICLED_Show_Format_Codec)
+    {
+        uint8_t prefix[ICLED_SHOW_FRAME_LENGTH_SIZE];
+        if (address + sizeof(prefix) > player->frames_end || !flash->read(flash->context, address, prefix, sizeof(prefix)))
+        {
+            WE_DEBUG_PRINT("Reading frame %lu failed.\r\n", (unsigned long)player->frames_read);
+            return false;
+        }
+        address += sizeof(prefix);
+        length = (uint32_t)(prefix[0] | (prefix[1] << 8));
+        if (length > player->slot_size)
+        {
+            WE_DEBUG_PRINT("Frame %lu is too long.\r\n", (unsigned long)player->frames_read);
+            return false;
+        }
+    }
+
+    if (address + length > player->frames_end)
+    {
+        WE_DEBUG_PRINT("Frame %lu exceeds the show.\r\n", (unsigned long)player->frames_read);
+        return false;
+    }
+
+    bool ok;
+    if (flash->read_async != NULL)
+    {
+        ok = flash->read_async(flash->context, address, data, length);
+        player->reading = ok;
+    }
+    else
+    {
+        ok = flash->read(flash->context, address, data, length);
+    }
+
+    if (!ok)
+    {
+        WE_DEBUG_PRINT("Reading frame %lu failed.\r\n", (unsigned long)player->frames_read);
+        return false;
+    }
+
+    player->lengths[slot] = length;
+    player->read_address = address + length;
+    player->frames_read++;
+    return true;
+}
+
+const uint8_t *ICLED_show_player_take(ICLED_Show_Player *player, uint32_t *length)
+{
+    if (player->ready == 0)
+    {
+        if (!ICLED_show_player_finished(player))
+        {
+            player->underruns++;
+        }
+        return NULL;
+    }
+
+    uint8_t slot = player->next;
+    player->next = (player->next + 1) % player->slot_count;
+    player->ready--;
+
+    // The oldest taken slot is released once more than hold frames are in use
+    if (player->taken < player->hold)
+    {
+        player->taken++;
+    }
+
+    player->frames_played++;
+    *length = player->lengths[slot];
+    return &player->ring[(size_t)slot * player->slot_size];
+}
+
+bool ICLED_show_player_finished(const ICLED_Show_Player *player)
+{
+    return !player->loop && player->frames_read == player->header.frame_count && player->ready == 0 && !player->reading;
+}
@@ -0,0 +1,242 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+#ifndef ICLED_24bit_SHOW_STORE_H
+#define ICLED_24bit_SHOW_STORE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ICLED_24bit_show.h"
+
+/*
+ * Show storage on NOR flash and streaming playback
+ *
+ * The store is an append-only log of named entries. Every entry starts on a page boundary
+ * with a 32 byte header: "ICSE", data length (u32), name (16 bytes), state and 7 reserved
+ * bytes, followed by the data. The state byte stays 0xFF while an entry is being written and
+ * is programmed to 0x00 once it is complete, so entries interrupted by a reset are skipped.
+ * The log ends at the first erased header. Sectors are erased when the log grows into them,
+ * so formatting only erases the first sector. A newer entry with the same name replaces an
+ * older one; the space is reclaimed by formatting.
+ *
+ * The player streams a show (see ICLED_24bit_show.h) from the store into a ring buffer of
+ * frame slots. While one frame is output, the next ones are read ahead, using the flash
+ * backend's asynchronous (DMA) read if it has one.
+ */
+
+#define ICLED_STORE_PAGE_SIZE 256
+#define ICLED_STORE_SECTOR_SIZE 4096
+#define ICLED_STORE_HEADER_SIZE 32
+#define ICLED_STORE_NAME_LENGTH 16
+
+#define ICLED_SHOW_PLAYER_MAX_SLOTS 4
+
+/**
+ * @brief   Flash backend used by the store.
+ *
+ *          program never crosses a page boundary, erase_sector is called with sector aligned
+ *          addresses. read_async and is_busy are optional (NULL): a backend that reads
+ *          asynchronously returns from read_async immediately and reports completion via is_busy.
+ */
+typedef struct
+{
+    void *context;
+    uint32_t size;
+    bool (*read)(void *context, uint32_t address, uint8_t *data, uint32_t length);
+    bool (*read_async)(void *context, uint32_t address, uint8_t *data, uint32_t length);
+    bool (*is_busy)(void *context);
+    bool (*program)(void *context, uint32_t address, const uint8_t *data, uint32_t length);
+    bool (*erase_sector)(void *context, uint32_t address);
+} ICLED_Flash;
+
+typedef struct
+{
+    char name[ICLED_STORE_NAME_LENGTH + 1];
+    uint32_t address; // Address of the entry's data
+    uint32_t length;  // Length of the entry's data
+    bool complete;
+} ICLED_Store_Entry;
+
+typedef struct
+{
+    const ICLED_Flash *flash;
+    uint32_t header_address;
+    uint32_t address; // Next address to be programmed
+    uint32_t end;     // End of the entry's data
+} ICLED_Store_Writer;
+
+typedef struct
+{
+    const ICLED_Flash *flash;
+    ICLED_Show_Header header;
+    uint32_t frames_address; // Address of the first frame
+    uint32_t frames_end;     // End of the show
+    uint32_t read_address;   // Address of the next frame to be read
+    uint32_t frames_read;    // Number of frames read into the ring buffer
+    bool loop;
+
+    uint8_t *ring;
+    uint32_t slot_size;                              // Bytes per slot, the size of the longest frame
+    uint8_t slot_count;
+    uint8_t hold;                                    // Number of taken slots kept for the output
+    uint32_t lengths[ICLED_SHOW_PLAYER_MAX_SLOTS];   // Frame length per slot
+    uint8_t next;                                    // Slot that is taken next
+    uint8_t ready;                                   // Number of slots holding a frame not yet taken
+    uint8_t taken;                                   // Number of taken slots still used by the output
+    bool reading;                                    // Asynchronous read in progress
+
+    uint32_t frames_played;
+    uint32_t underruns;
+} ICLED_Show_Player;
+
+/**
+ * @brief       Erase the store.
+ *
+ * @param[in]   flash: Flash backend.
+ *
+ * @return      True if successful, false otherwise.
+ */
+bool ICLED_store_format(const ICLED_Flash *flash);
+
+/**
+ * @brief       Check whether the flash holds a store.
+ *
+ * @param[in]   flash: Flash backend.
+ *
+ * @return      True if the log is intact or the flash is erased, false if it has to be formatted.
+ */
+bool ICLED_store_check(const ICLED_Flash *flash);
+
+/**
+ * @brief       Iterate over the store entries.
+ *
+ * @param[in]   flash: Flash backend.
+ * @param[in,out] address: Header address of the entry to read, 0 for the first one. Advanced to the next entry.
+ * @param[out]  entry: Entry found at address.
+ *
+ * @return      True if an entry was found, false at the end of the log.
+ */
+bool ICLED_store_next(const ICLED_Flash *flash, uint32_t *address, ICLED_Store_Entry *entry);
+
+/**
+ * @brief       Find the newest complete entry with the given name.
+ *
+ * @param[in]   flash: Flash backend.
+ * @param[in]   name: Entry name (max. ICLED_STORE_NAME_LENGTH characters).
+ * @param[out]  entry: Entry found.
+ *
+ * @return      True if the entry was found, false otherwise.
+ */
+bool ICLED_store_find(const ICLED_Flash *flash, const char *name, ICLED_Store_Entry *entry);
+
+/**
+ * @brief       Start appending an entry to the store.
+ *
+ * @param[out]  writer: Writer state.
+ * @param[in]   flash: Flash backend.
+ * @param[in]   name: Entry name (max. ICLED_STORE_NAME_LENGTH characters).
+ * @param[in]   length: Length of the entry's data in bytes.
+ *
+ * @return      True if successful, false if the store is full or the flash failed.
+ */
+bool ICLED_store_append_begin(ICLED_Store_Writer *writer, const ICLED_Flash *flash, const char *name, uint32_t length);
+
+/**
+ * @brief       Write the next part of the entry's data.
+ *
+ * @param[in]   writer: Writer state.
+ * @param[in]   data: Data.
+ * @param[in]   length: Length of data in bytes.
+ *
+ * @return      True if successful, false otherwise.
+ */
+bool ICLED_store_append(ICLED_Store_Writer *writer, const uint8_t *data, uint32_t length);
+
+/**
+ * @brief       Mark the entry as complete once all data has been written.
+ *
+ * @param[in]   writer: Writer state.
+ *
+ * @return      True if successful, false otherwise.
+ */
+bool ICLED_store_append_end(ICLED_Store_Writer *writer);
+
+/**
+ * @brief       Open a show from the store for streaming playback.
+ *
+ * @param[out]  player: Player state.
+ * @param[in]   flash: Flash backend.
+ * @param[in]   entry: Store entry holding the show.
+ * @param[in]   ring: Ring buffer memory for the frame slots.
+ * @param[in]   ring_size: Size of the ring buffer in bytes. Must hold at least hold + 1 slots.
+ * @param[in]   hold: Number of taken frames that stay untouched because the output still uses
+ *              them: 2 when the DMA sends the frame from the slot (the previous frame may still
+ *              be in transfer), 0 when the frame is decoded before the next poll.
+ * @param[in]   loop: Restart at the first frame after the last one.
+ *
+ * @return      True if successful, false otherwise.
+ */
+bool ICLED_show_player_open(ICLED_Show_Player *player, const ICLED_Flash *flash, const ICLED_Store_Entry *entry,
+                            uint8_t *ring, size_t ring_size, uint8_t hold, bool loop);
+
+/**
+ * @brief       Size of one ring buffer slot for a show.
+ *
+ * @param[in]   header: Show header.
+ *
+ * @return      Slot size in bytes.
+ */
+size_t ICLED_show_player_slot_size(const ICLED_Show_Header *header);
+
+/**
+ * @brief       Read ahead into free slots. Call as often as possible.
+ *
+ * @param[in]   player: Player state.
+ *
+ * @return      False if reading from the flash failed, true otherwise.
+ */
+bool ICLED_show_player_poll(ICLED_Show_Player *player);
+
+/**
+ * @brief       Take the next frame from the ring buffer.
+ *
+ * @param[in]   player: Player state.
+ * @param[out]  length: Length of the frame in bytes.
+ *
+ * @return      The frame (codec frame update or encoded frame depending on the show format),
+ *              NULL if no frame is ready (counted as underrun) or the show has ended.
+ */
+const uint8_t *ICLED_show_player_take(ICLED_Show_Player *player, uint32_t *length);
+
+/**
+ * @brief       Check whether a non-looping show has been played completely.
+ *
+ * @param[in]   player: Player state.
+ *
+ * @return      True if all frames have been taken.
+ */
+bool ICLED_show_player_finished(const ICLED_Show_Player *player);
+
+#endif
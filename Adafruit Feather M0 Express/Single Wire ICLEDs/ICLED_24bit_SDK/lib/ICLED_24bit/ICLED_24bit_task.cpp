@@ -0,0 +1,102 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+
+#include "global.h"
+#include "ICLED_24bit.h"
+#include "ICLED_24bit_animation.h"
+#include "ICLED_24bit_task.h"
+
+#define ICLED_TASK_SIGNAL_FRAME 1
+
+static WE_Task_t icled_task;
+static WE_Event_t icled_queue[ICLED_TASK_QUEUE_SIZE];
+static WE_Scheduler_Timer_t icled_frame_timer;
+static ICLED_Animation_Player icled_player;
+static WE_Task_t *icled_listener = NULL;
+static uint16_t icled_listener_signal = 0;
+static uint32_t icled_frame = 0;
+
+/**
+ * @brief       Event handler of the ICLED task, renders one frame per frame event.
+ */
+static void ICLED_task_handler(WE_Task_t *task, const WE_Event_t *event);
+
+bool ICLED_task_init(uint8_t priority)
+{
+    return WE_Scheduler_AddTask(&icled_task, "icled", priority, icled_queue, ICLED_TASK_QUEUE_SIZE, ICLED_task_handler, NULL);
+}
+
+bool ICLED_task_play(const uint8_t *animation, size_t length, uint16_t frame_period_ms, WE_Task_t *listener, uint16_t signal)
+{
+    ICLED_task_stop();
+
+    if (frame_period_ms == 0 || !ICLED_animation_start(&icled_player, animation, length, ICLED_NUM, WE_GetTick()))
+    {
+        return false;
+    }
+
+    icled_listener = listener;
+    icled_listener_signal = signal;
+    icled_frame = 0;
+
+    WE_Scheduler_StartTimer(&icled_frame_timer, &icled_task, ICLED_TASK_SIGNAL_FRAME, 0, (uint32_t)frame_period_ms * 1000);
+    return true;
+}
+
+void ICLED_task_stop()
+{
+    WE_Scheduler_StopTimer(&icled_frame_timer);
+}
+
+WE_Task_t *ICLED_task_get()
+{
+    return &icled_task;
+}
+
+static void ICLED_task_handler(WE_Task_t *task, const WE_Event_t *event)
+{
+    (void)task;
+
+    // Frame events that were queued before the timer was stopped are ignored
+    if (event->signal != ICLED_TASK_SIGNAL_FRAME || !WE_SoftTimer_IsActive(&icled_frame_timer.timer))
+    {
+        return;
+    }
+
+    bool running = ICLED_animation_render(&icled_player, WE_GetTick(), ICLED_get_pixel_buffer());
+    ICLED_write_buffer();
+    icled_frame++;
+
+    if (!running)
+    {
+        ICLED_task_stop();
+    }
+
+    if (icled_listener != NULL)
+    {
+        WE_Scheduler_Post(icled_listener, icled_listener_signal, running ? icled_frame : 0, NULL);
+    }
+}
@@ -0,0 +1,88 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+
+#ifndef ICLED_24bit_TASK_H
+#define ICLED_24bit_TASK_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "scheduler.h"
+
+/*
+ * Keyframe animation playback as scheduler task
+ *
+ * A periodic scheduler timer posts a frame event to the ICLED task, which renders the next
+ * frame of the animation (see ICLED_24bit_animation.h) into the pixel buffer. After every
+ * frame an event is posted to an optional listener task, so the application can react to
+ * frames without polling.
+ *
+ * For battery powered products select single frame output (ICLED_set_continuous_output(false))
+ * and initialize the idle manager in standby mode (WE_Idle_Init()): once a frame has latched
+ * the MCU stays in standby until the next frame event.
+ */
+
+#define ICLED_TASK_QUEUE_SIZE 4
+
+/**
+ * @brief       Add the ICLED task to the scheduler.
+ *
+ *              ICLED_Init() and WE_Scheduler_Init() must have been called before.
+ *
+ * @param[in]   priority: Scheduler priority of the task.
+ *
+ * @return      True if successful, false otherwise.
+ */
+bool ICLED_task_init(uint8_t priority);
+
+/**
+ * @brief       Start playback of an animation.
+ *
+ * @param[in]   animation: Animation data. Must remain valid during playback (e.g. const data in flash).
+ * @param[in]   length: Length of the animation data in bytes.
+ * @param[in]   frame_period_ms: Time between two frames (in milliseconds).
+ * @param[in]   listener: Task notified after every frame or NULL. The event's param holds the number
+ *              of the frame, 0 once a non-looping animation has ended.
+ * @param[in]   signal: Signal of the listener event.
+ *
+ * @return      True if successful, false if the animation is invalid.
+ */
+bool ICLED_task_play(const uint8_t *animation, size_t length, uint16_t frame_period_ms, WE_Task_t *listener, uint16_t signal);
+
+/**
+ * @brief       Stop playback. The last frame stays visible.
+ *
+ * @return      None
+ */
+void ICLED_task_stop();
+
+/**
+ * @brief       Get the ICLED task, e.g. to read its statistics.
+ *
+ * @return      ICLED task.
+ */
+WE_Task_t *ICLED_task_get();
+
+#endif
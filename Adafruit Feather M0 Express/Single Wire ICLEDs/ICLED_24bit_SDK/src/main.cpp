@@ -29,6 +29,7 @@
 #include "debug.h"
 #include "ICLED_24bit.h"
 #include "ICLED_24bit_demos.h"
+#include "ICLED_24bit_animation.h"
 
 /* Test Modes */
 typedef enum
@@ -39,12 +40,28 @@ typedef enum
     TEST4,
     TEST5,
     TEST6,
+    TEST7,
 } TestMode;
 
+/* Keyframe show for TEST7: a red to blue wave over the first half and a breathing green second half */
+static const uint8_t keyframe_show[] = {
+    ICLED_ANIMATION_HEADER(ICLED_ANIMATION_FLAG_LOOP, 20, 2),
+    ICLED_ANIMATION_SEGMENT(0, ICLED_NUM / 2, 20, 3),
+    ICLED_ANIMATION_KEY(255, 0, 0, ICLED_Easing_EaseInOut, 1000),
+    ICLED_ANIMATION_KEY(0, 0, 255, ICLED_Easing_EaseInOut, 1000),
+    ICLED_ANIMATION_KEY(255, 0, 255, ICLED_Easing_Linear, 500),
+    ICLED_ANIMATION_SEGMENT(ICLED_NUM / 2, ICLED_NUM - ICLED_NUM / 2, 0, 2),
+    ICLED_ANIMATION_KEY(0, 16, 0, ICLED_Easing_EaseIn, 1500),
+    ICLED_ANIMATION_KEY(0, 255, 0, ICLED_Easing_EaseOut, 1500),
+};
+
 static volatile TestMode current_mode = TEST5;
 
 void setup() 
 {
+  // Start the microsecond clock before anything reads it
+  WE_InitTimebase();
+
   // Using the USB serial port for debug messages
   #ifdef WE_DEBUG
     WE_Debug_Init();
@@ -59,6 +76,9 @@ void setup()
 
 void loop() {
 
+  // Commands on the debug serial, e.g. 'm' prints the RAM usage (see WE_Debug_Poll())
+  WE_Debug_Poll();
+
   ICLED_set_color_system(RGB);
 
   switch (current_mode)
@@ -87,6 +107,10 @@ void loop() {
       ICLED_demo_TheaterChase(255, 255, 255, 10, 100);
     break;
 
+    case TEST7: 
+      ICLED_demo_Keyframes(keyframe_show, sizeof(keyframe_show), 10000, 10);
+    break;
+
     default: 
     break;  
   }
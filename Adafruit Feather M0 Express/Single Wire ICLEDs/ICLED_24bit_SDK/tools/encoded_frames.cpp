@@ -0,0 +1,131 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+/*
+ * Host tool generating pre-encoded frames for ICLED_play_encoded_frame().
+ *
+ *   encoded_frames <pixel count> <raw frames> <output header> <array name> [latch bytes]
+ *
+ * Reads raw frames (pixel count * 3 bytes G, R, B per frame) and writes a header file with a
+ * const array holding the exact SPI byte stream of every frame, including the latch bytes.
+ * Being const, the array is placed in flash and the DMA reads it from there during playback.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "ICLED_24bit.h"
+#include "ICLED_24bit_encoder.h"
+
+/**
+ * @brief       Parse a decimal number in the range [min, max].
+ *
+ * @return      False if the text is no number or the number is out of range.
+ */
+static bool parse_number(const char *text, unsigned long min, unsigned long max, int *value)
+{
+    char *end;
+    errno = 0;
+    unsigned long number = strtoul(text, &end, 10);
+    if (errno != 0 || end == text || *end != '\0' || text[0] == '-' || number < min || number > max)
+    {
+        fprintf(stderr, "%s is not a number between %lu and %lu\n", text, min, max);
+        return false;
+    }
+    *value = (int)number;
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 5)
+    {
+        fprintf(stderr, "usage: %s <pixel count> <raw frames> <output header> <array name> [latch bytes]\n", argv[0]);
+        return 2;
+    }
+
+    const char *name = argv[4];
+    int pixels;
+    int latch_bytes = ICLED_LATCHBYTECOUNT;
+    if (!parse_number(argv[1], 1, 0xFFFF, &pixels) || ((argc >= 6) && !parse_number(argv[5], 0, 0xFFFF, &latch_bytes)))
+    {
+        return 2;
+    }
+    size_t frame_size = ICLED_ENCODED_FRAME_SIZE(pixels, latch_bytes);
+
+    FILE *in = fopen(argv[2], "rb");
+    if (in == NULL)
+    {
+        perror(argv[2]);
+        return 1;
+    }
+
+    std::vector<uint8_t> pixel_data(pixels * 3);
+    std::vector<uint8_t> encoded;
+    size_t frame_count = 0;
+
+    while (fread(pixel_data.data(), 1, pixel_data.size(), in) == pixel_data.size())
+    {
+        size_t offset = encoded.size();
+        encoded.resize(offset + frame_size, 0);
+        ICLED_encode_pixels(pixel_data.data(), (uint16_t)pixels, &encoded[offset]);
+        frame_count++;
+    }
+    fclose(in);
+
+    FILE *out = fopen(argv[3], "w");
+    if (out == NULL)
+    {
+        perror(argv[3]);
+        return 1;
+    }
+
+    fprintf(out, "/* Generated by encoded_frames - do not edit */\n\n");
+    fprintf(out, "#include <stdint.h>\n#include \"ICLED_24bit.h\"\n\n");
+    fprintf(out, "#if (ICLED_NUM != %d) || (ICLED_LATCHBYTECOUNT != %d)\n", pixels, latch_bytes);
+    fprintf(out, "#error \"%s was encoded for %d ICLEDs and %d latch bytes\"\n#endif\n\n", name, pixels, latch_bytes);
+    fprintf(out, "#define %s_FRAME_COUNT %zu\n\n", name, frame_count);
+    fprintf(out, "static const uint8_t __attribute__((aligned(4))) %s[%zu][%zu] = {\n", name, frame_count, frame_size);
+
+    for (size_t f = 0; f < frame_count; f++)
+    {
+        fprintf(out, "    {");
+        for (size_t i = 0; i < frame_size; i++)
+        {
+            fprintf(out, "%s0x%02X", (i % 16 == 0) ? "\n        " : " ", encoded[f * frame_size + i]);
+            if (i + 1 < frame_size)
+            {
+                fputc(',', out);
+            }
+        }
+        fprintf(out, "\n    },\n");
+    }
+    fprintf(out, "};\n");
+    fclose(out);
+
+    printf("%zu frames, %zu bytes of flash\n", frame_count, frame_count * frame_size);
+    return 0;
+}
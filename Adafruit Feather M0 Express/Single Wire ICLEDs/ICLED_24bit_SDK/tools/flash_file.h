@@ -0,0 +1,175 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+/*
+ * File-backed stand-in for the Feather's SPI flash.
+ *
+ * The image file behaves like NOR flash: programming can only clear bits, erasing sets a
+ * whole sector to 0xFF and programming must not cross a page boundary. read_async reports
+ * busy until the next is_busy call, which exercises the player's DMA read path.
+ */
+
+#ifndef FLASH_FILE_H
+#define FLASH_FILE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include "ICLED_24bit_show_store.h"
+
+// GD25Q16C on the Feather M0 Express
+#define FLASH_FILE_DEFAULT_SIZE (2 * 1024 * 1024)
+
+typedef struct
+{
+    FILE *file;
+    uint32_t size;
+    bool busy;
+
+    uint32_t reads;
+    uint64_t bytes_read;
+    uint32_t pages_programmed;
+    uint32_t sectors_erased;
+} FlashFile;
+
+static bool flash_file_read(void *context, uint32_t address, uint8_t *data, uint32_t length)
+{
+    FlashFile *flash = (FlashFile *)context;
+    if (flash->busy || address + length > flash->size)
+    {
+        return false;
+    }
+    flash->reads++;
+    flash->bytes_read += length;
+    return fseek(flash->file, address, SEEK_SET) == 0 && fread(data, 1, length, flash->file) == length;
+}
+
+static bool flash_file_read_async(void *context, uint32_t address, uint8_t *data, uint32_t length)
+{
+    FlashFile *flash = (FlashFile *)context;
+    if (!flash_file_read(context, address, data, length))
+    {
+        return false;
+    }
+    flash->busy = true;
+    return true;
+}
+
+static bool flash_file_is_busy(void *context)
+{
+    FlashFile *flash = (FlashFile *)context;
+    bool busy = flash->busy;
+    flash->busy = false;
+    return busy;
+}
+
+static bool flash_file_program(void *context, uint32_t address, const uint8_t *data, uint32_t length)
+{
+    FlashFile *flash = (FlashFile *)context;
+    uint8_t page[ICLED_STORE_PAGE_SIZE];
+
+    if (flash->busy || address + length > flash->size || (address % ICLED_STORE_PAGE_SIZE) + length > ICLED_STORE_PAGE_SIZE)
+    {
+        return false;
+    }
+    if (fseek(flash->file, address, SEEK_SET) != 0 || fread(page, 1, length, flash->file) != length)
+    {
+        return false;
+    }
+    for (uint32_t i = 0; i < length; i++)
+    {
+        page[i] &= data[i];
+    }
+    flash->pages_programmed++;
+    return fseek(flash->file, address, SEEK_SET) == 0 && fwrite(page, 1, length, flash->file) == length;
+}
+
+static bool flash_file_erase_sector(void *context, uint32_t address)
+{
+    FlashFile *flash = (FlashFile *)context;
+    std::vector<uint8_t> sector(ICLED_STORE_SECTOR_SIZE, 0xFF);
+
+    if (flash->busy || address >= flash->size || address % ICLED_STORE_SECTOR_SIZE != 0)
+    {
+        return false;
+    }
+    flash->sectors_erased++;
+    return fseek(flash->file, address, SEEK_SET) == 0 && fwrite(sector.data(), 1, sector.size(), flash->file) == sector.size();
+}
+
+/**
+ * @brief       Open a flash image, a missing image is created erased.
+ *
+ * @param[out]  flash: Flash image state.
+ * @param[out]  backend: Flash backend for the store.
+ * @param[in]   path: Image file.
+ * @param[in]   size: Size of a new image in bytes.
+ *
+ * @return      True if successful, false otherwise.
+ */
+static inline bool flash_file_open(FlashFile *flash, ICLED_Flash *backend, const char *path, uint32_t size = FLASH_FILE_DEFAULT_SIZE)
+{
+    memset(flash, 0, sizeof(*flash));
+
+    flash->file = fopen(path, "r+b");
+    if (flash->file == NULL)
+    {
+        flash->file = fopen(path, "w+b");
+        if (flash->file == NULL)
+        {
+            return false;
+        }
+        std::vector<uint8_t> erased(size, 0xFF);
+        if (fwrite(erased.data(), 1, erased.size(), flash->file) != erased.size())
+        {
+            fclose(flash->file);
+            return false;
+        }
+    }
+
+    fseek(flash->file, 0, SEEK_END);
+    flash->size = (uint32_t)ftell(flash->file);
+
+    backend->context = flash;
+    backend->size = flash->size;
+    backend->read = flash_file_read;
+    backend->read_async = flash_file_read_async;
+    backend->is_busy = flash_file_is_busy;
+    backend->program = flash_file_program;
+    backend->erase_sector = flash_file_erase_sector;
+    return true;
+}
+
+static inline void flash_file_close(FlashFile *flash)
+{
+    if (flash->file != NULL)
+    {
+        fclose(flash->file);
+        flash->file = NULL;
+    }
+}
+
+#endif
@@ -0,0 +1,373 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+/*
+ * Host tool for the compressed frame update format (see ICLED_24bit_codec.h).
+ *
+ *   frame_codec encode <pixel count> <raw frames> <encoded stream>
+ *       Encodes a file of raw frames (pixel count * 3 bytes G, R, B per frame) into a stream of
+ *       frame updates, each prefixed by its length as 16 bit little endian value.
+ *
+ *   frame_codec bench [pixel count] [baud rate]
+ *       Encodes the demo animations and reports bytes/frame and achievable frames per second
+ *       on a UART link (8N1) for compressed and raw frames.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <map>
+#include <vector>
+#include <algorithm>
+#include "ICLED_24bit.h"
+#include "ICLED_24bit_codec.h"
+
+typedef std::vector<uint8_t> Frame;
+
+static_assert(ICLED_CODEC_MAX_FRAME_SIZE(ICLED_CODEC_MAX_PIXEL_COUNT) <= 0xFFFF &&
+                  ICLED_CODEC_MAX_FRAME_SIZE(ICLED_CODEC_MAX_PIXEL_COUNT + 1) > 0xFFFF,
+              "ICLED_CODEC_MAX_PIXEL_COUNT does not match the 16 bit frame update length");
+
+static void set_pixel(Frame &frame, int index, uint8_t r, uint8_t g, uint8_t b, uint8_t brightness)
+{
+    frame[index * 3 + 0] = (uint8_t)((g * brightness) / 255);
+    frame[index * 3 + 1] = (uint8_t)((r * brightness) / 255);
+    frame[index * 3 + 2] = (uint8_t)((b * brightness) / 255);
+}
+
+/* The animations below produce the same frames as the demos in ICLED_24bit_demos.cpp */
+
+static std::vector<Frame> animation_rainbow(int pixels)
+{
+    std::vector<Frame> frames;
+    for (int i = 0; i < 256; i++)
+    {
+        Frame frame(pixels * 3);
+        for (int j = 0; j < pixels; j++)
+        {
+            int pos = (j + i) % 256;
+            uint8_t r = (pos < 85) ? (pos * 3) : ((pos < 170) ? (255 - (pos - 85) * 3) : 0);
+            uint8_t g = (pos < 85) ? 0 : ((pos < 170) ? ((pos - 85) * 3) : (255 - (pos - 170) * 3));
+            uint8_t b = (pos < 85) ? (255 - pos * 3) : ((pos < 170) ? 0 : ((pos - 170) * 3));
+            set_pixel(frame, j, r, g, b, 20);
+        }
+        frames.push_back(frame);
+    }
+    return frames;
+}
+
+static std::vector<Frame> animation_breathing(int pixels)
+{
+    std::vector<Frame> frames;
+    for (int i = 0; i <= 100; i++)
+    {
+        Frame frame(pixels * 3);
+        int level = (i <= 50) ? i : 100 - i;
+        for (int j = 0; j < pixels; j++)
+        {
+            set_pixel(frame, j, 255, 255, 255, level);
+        }
+        frames.push_back(frame);
+    }
+    return frames;
+}
+
+static std::vector<Frame> animation_color_wipe(int pixels)
+{
+    std::vector<Frame> frames;
+    Frame frame(pixels * 3);
+    for (int i = 0; i < pixels; i++)
+    {
+        set_pixel(frame, i, 255, 0, 0, 20);
+        frames.push_back(frame);
+    }
+    frames.push_back(Frame(pixels * 3));
+    return frames;
+}
+
+static std::vector<Frame> animation_cyclon(int pixels)
+{
+    std::vector<Frame> frames;
+    for (int i = 0; i < 2 * pixels; i++)
+    {
+        Frame frame(pixels * 3);
+        int position = (i < pixels) ? i : (2 * pixels - 1 - i);
+        set_pixel(frame, position, 255, 0, 255, 20);
+        frames.push_back(frame);
+    }
+    return frames;
+}
+
+static std::vector<Frame> animation_theater_chase(int pixels)
+{
+    std::vector<Frame> frames;
+    for (int j = 0; j < 10; j++)
+    {
+        for (int q = 0; q < 3; q++)
+        {
+            Frame frame(pixels * 3);
+            for (int i = q; i < pixels; i += 3)
+            {
+                set_pixel(frame, i, 255, 255, 255, 10);
+            }
+            frames.push_back(frame);
+        }
+    }
+    return frames;
+}
+
+/**
+ * @brief       Select the most frequent colors of an animation as palette.
+ */
+static std::vector<uint8_t> build_palette(const std::vector<Frame> &frames)
+{
+    std::map<uint32_t, uint32_t> histogram;
+    for (const Frame &frame : frames)
+    {
+        for (size_t i = 0; i < frame.size(); i += 3)
+        {
+            histogram[(frame[i] << 16) | (frame[i + 1] << 8) | frame[i + 2]]++;
+        }
+    }
+
+    std::vector<std::pair<uint32_t, uint32_t>> colors(histogram.begin(), histogram.end());
+    std::sort(colors.begin(), colors.end(), [](const std::pair<uint32_t, uint32_t> &a, const std::pair<uint32_t, uint32_t> &b)
+              { return a.second > b.second; });
+
+    std::vector<uint8_t> palette;
+    for (size_t i = 0; i < colors.size() && i < ICLED_CODEC_PALETTE_SIZE; i++)
+    {
+        // Colors that occur once per frame or less do not pay off the palette transfer
+        if (colors[i].second <= frames.size())
+        {
+            break;
+        }
+        palette.push_back((colors[i].first >> 16) & 0xFF);
+        palette.push_back((colors[i].first >> 8) & 0xFF);
+        palette.push_back(colors[i].first & 0xFF);
+    }
+    return palette;
+}
+
+/**
+ * @brief       Encode an animation as sequence of frame updates.
+ *
+ * @return      True if every frame update decodes to the original frame.
+ */
+static bool encode_animation(const std::vector<Frame> &frames, int pixels, std::vector<std::vector<uint8_t>> &updates, double *encode_us, double *decode_us)
+{
+    ICLED_Codec_Encoder encoder;
+    ICLED_Codec_Decoder decoder;
+    ICLED_codec_encoder_init(&encoder);
+    ICLED_codec_decoder_init(&decoder);
+
+    std::vector<uint8_t> palette = build_palette(frames);
+    ICLED_codec_encoder_set_palette(&encoder, palette.data(), (uint8_t)(palette.size() / 3));
+
+    std::vector<uint8_t> out(ICLED_CODEC_MAX_FRAME_SIZE(pixels));
+    Frame decoded(pixels * 3);
+    bool ok = true;
+    std::chrono::duration<double, std::micro> encode_time(0), decode_time(0);
+
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        size_t size = ICLED_codec_encode(&encoder, (i == 0) ? NULL : frames[i - 1].data(), frames[i].data(), pixels, out.data(), out.size());
+        auto t1 = std::chrono::steady_clock::now();
+        bool decoded_ok = ICLED_codec_decode(&decoder, out.data(), size, decoded.data(), pixels);
+        auto t2 = std::chrono::steady_clock::now();
+
+        encode_time += t1 - t0;
+        decode_time += t2 - t1;
+
+        if (size == 0 || !decoded_ok || decoded != frames[i])
+        {
+            fprintf(stderr, "Frame %zu does not decode to the original frame\n", i);
+            ok = false;
+        }
+        updates.push_back(std::vector<uint8_t>(out.begin(), out.begin() + size));
+    }
+
+    *encode_us = frames.empty() ? 0 : encode_time.count() / frames.size();
+    *decode_us = frames.empty() ? 0 : decode_time.count() / frames.size();
+    return ok;
+}
+
+static int run_encode(int pixels, const char *in_path, const char *out_path)
+{
+    FILE *in = fopen(in_path, "rb");
+    if (in == NULL)
+    {
+        perror(in_path);
+        return 1;
+    }
+
+    std::vector<Frame> frames;
+    Frame frame(pixels * 3);
+    while (fread(frame.data(), 1, frame.size(), in) == frame.size())
+    {
+        frames.push_back(frame);
+    }
+    fclose(in);
+
+    if (frames.empty())
+    {
+        fprintf(stderr, "%s does not contain a complete frame of %d pixels\n", in_path, pixels);
+        return 1;
+    }
+
+    std::vector<std::vector<uint8_t>> updates;
+    double encode_us, decode_us;
+    if (!encode_animation(frames, pixels, updates, &encode_us, &decode_us))
+    {
+        return 1;
+    }
+
+    FILE *out = fopen(out_path, "wb");
+    if (out == NULL)
+    {
+        perror(out_path);
+        return 1;
+    }
+
+    size_t total = 0;
+    for (const std::vector<uint8_t> &update : updates)
+    {
+        uint8_t length[2] = {(uint8_t)(update.size() & 0xFF), (uint8_t)(update.size() >> 8)};
+        fwrite(length, 1, sizeof(length), out);
+        fwrite(update.data(), 1, update.size(), out);
+        total += sizeof(length) + update.size();
+    }
+    fclose(out);
+
+    printf("%zu frames, %zu bytes (raw %zu bytes)\n", frames.size(), total, frames.size() * pixels * 3);
+    return 0;
+}
+
+static int run_bench(int pixels, int baudrate)
+{
+    struct
+    {
+        const char *name;
+        std::vector<Frame> (*generate)(int pixels);
+    } animations[] = {
+        {"Rainbow", animation_rainbow},
+        {"Breathing", animation_breathing},
+        {"ColorWhipe", animation_color_wipe},
+        {"Cyclon", animation_cyclon},
+        {"TheaterChase", animation_theater_chase},
+    };
+
+    // 8N1: 10 bit times per byte
+    double bytes_per_second = baudrate / 10.0;
+    double raw_size = pixels * 3;
+    bool ok = true;
+
+    printf("%d pixels, %d baud, raw frame %.0f bytes -> %.1f fps\n\n", pixels, baudrate, raw_size, bytes_per_second / raw_size);
+    printf("%-14s %8s %12s %8s %10s %10s %10s\n", "animation", "frames", "bytes/frame", "ratio", "fps", "enc [us]", "dec [us]");
+
+    for (auto &animation : animations)
+    {
+        std::vector<Frame> frames = animation.generate(pixels);
+        std::vector<std::vector<uint8_t>> updates;
+        double encode_us, decode_us;
+
+        ok &= encode_animation(frames, pixels, updates, &encode_us, &decode_us);
+        if (updates.empty())
+        {
+            continue;
+        }
+
+        // Count the bytes of the stream written by encode, including the 16 bit length of every update
+        size_t total = 0;
+        for (const std::vector<uint8_t> &update : updates)
+        {
+            total += sizeof(uint16_t) + update.size();
+        }
+        double average = (double)total / updates.size();
+
+        printf("%-14s %8zu %12.1f %7.1fx %10.1f %10.2f %10.2f\n", animation.name, frames.size(), average, raw_size / average,
+               bytes_per_second / average, encode_us, decode_us);
+    }
+
+    return ok ? 0 : 1;
+}
+
+/**
+ * @brief       Parse a decimal number in the range [min, max].
+ *
+ * @return      False if the text is no number or the number is out of range.
+ */
+static bool parse_number(const char *text, unsigned long min, unsigned long max, int *value)
+{
+    char *end;
+    errno = 0;
+    unsigned long number = strtoul(text, &end, 10);
+    if (errno != 0 || end == text || *end != '\0' || text[0] == '-' || number < min || number > max)
+    {
+        fprintf(stderr, "%s is not a number between %lu and %lu\n", text, min, max);
+        return false;
+    }
+    *value = (int)number;
+    return true;
+}
+
+static int usage(const char *name)
+{
+    fprintf(stderr, "usage: %s encode <pixel count> <raw frames> <encoded stream>\n"
+                    "       %s bench [pixel count] [baud rate]\n",
+            name, name);
+    return 2;
+}
+
+int main(int argc, char *argv[])
+{
+    // Every frame update is preceded by a 16 bit length, the pixel count keeps its worst case within it
+    int pixels = ICLED_NUM;
+    int baudrate = 115200;
+
+    if (argc >= 5 && strcmp(argv[1], "encode") == 0)
+    {
+        if (!parse_number(argv[2], 1, ICLED_CODEC_MAX_PIXEL_COUNT, &pixels))
+        {
+            return usage(argv[0]);
+        }
+        return run_encode(pixels, argv[3], argv[4]);
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "bench") == 0)
+    {
+        if ((argc >= 3 && !parse_number(argv[2], 1, ICLED_CODEC_MAX_PIXEL_COUNT, &pixels)) ||
+            (argc >= 4 && !parse_number(argv[3], 10, 10000000, &baudrate)))
+        {
+            return usage(argv[0]);
+        }
+        return run_bench(pixels, baudrate);
+    }
+
+    return usage(argv[0]);
+}
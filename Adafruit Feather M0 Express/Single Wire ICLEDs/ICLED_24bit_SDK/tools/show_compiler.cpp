@@ -0,0 +1,418 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+/*
+ * Host side show compiler.
+ *
+ *   show_compiler [options] <animation file | --demo> <output show>
+ *
+ *   --pixels N          number of ICLEDs (default ICLED_NUM)
+ *   --period MS         frame period in milliseconds (default 20)
+ *   --frames N          number of frames (default: length of the animation, 500 if it loops)
+ *   --format F          "codec" (compressed frame updates, default) or "encoded" (SPI byte stream)
+ *   --threads N         number of render threads (default: all cores)
+ *   --latch N           latch bytes per encoded frame, at least 80 (default ICLED_LATCHBYTECOUNT)
+ *   --no-simd           use the scalar bit-expansion
+ *
+ * Renders a keyframe animation (see ICLED_24bit_animation.h) into a show file (see
+ * ICLED_24bit_show.h) with the same animation, encoder and codec sources as the firmware.
+ * Frames are split into one contiguous range per thread. Every frame is bit-expanded and
+ * checked with the waveform decoder, and every compressed frame update is decoded again
+ * and compared to the rendered frame. The show file is only written if all frames pass.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+#include "ICLED_24bit.h"
+#include "ICLED_24bit_animation.h"
+#include "ICLED_24bit_codec.h"
+#include "ICLED_24bit_encoder.h"
+#include "ICLED_24bit_show.h"
+#include "waveform_decoder.h"
+
+// Shortest latch (200 us of low level) the waveform decoder and the ICLEDs accept
+#define SHOW_MIN_LATCH_BYTES (WAVEFORM_RESET_BITS / 8)
+
+typedef struct
+{
+    int pixels;
+    uint16_t period_ms;
+    uint32_t frames;
+    ICLED_Show_Format format;
+    unsigned threads;
+    uint16_t latch_bytes;
+    bool simd;
+} Options;
+
+typedef struct
+{
+    std::vector<uint8_t> frame;  // Rendered pixels
+    std::vector<uint8_t> output; // Frame as written to the show
+    bool valid;
+} RenderedFrame;
+
+/**
+ * @brief       Bit-expand pixels, 16 pixels per iteration with SSSE3 if available.
+ *
+ *              Each SPI byte is 0x88 with 0x60 added for a set upper bit and 0x06 for a set
+ *              lower bit of the bit pair, which maps directly onto byte compares.
+ */
+static void encode_pixels_simd(const uint8_t *pixels, uint16_t pixel_count, uint8_t *out)
+{
+    uint16_t p = 0;
+#if defined(__SSSE3__)
+    const __m128i mask_high = _mm_setr_epi8((char)0x80, 0x20, 0x08, 0x02, (char)0x80, 0x20, 0x08, 0x02,
+                                            (char)0x80, 0x20, 0x08, 0x02, (char)0x80, 0x20, 0x08, 0x02);
+    const __m128i mask_low = _mm_setr_epi8(0x40, 0x10, 0x04, 0x01, 0x40, 0x10, 0x04, 0x01,
+                                           0x40, 0x10, 0x04, 0x01, 0x40, 0x10, 0x04, 0x01);
+    const __m128i base = _mm_set1_epi8((char)0x88);
+    const __m128i high_bits = _mm_set1_epi8(0x60);
+    const __m128i low_bits = _mm_set1_epi8(0x06);
+    __m128i spread[4];
+    for (int q = 0; q < 4; q++)
+    {
+        spread[q] = _mm_setr_epi8(4 * q, 4 * q, 4 * q, 4 * q, 4 * q + 1, 4 * q + 1, 4 * q + 1, 4 * q + 1,
+                                  4 * q + 2, 4 * q + 2, 4 * q + 2, 4 * q + 2, 4 * q + 3, 4 * q + 3, 4 * q + 3, 4 * q + 3);
+    }
+
+    // 16 pixels = 48 input bytes = 3 vectors
+    for (; p + 16 <= pixel_count; p += 16)
+    {
+        for (int v = 0; v < 3; v++)
+        {
+            __m128i in = _mm_loadu_si128((const __m128i *)&pixels[p * 3 + v * 16]);
+            for (int q = 0; q < 4; q++)
+            {
+                __m128i bytes = _mm_shuffle_epi8(in, spread[q]);
+                __m128i high = _mm_cmpeq_epi8(_mm_and_si128(bytes, mask_high), mask_high);
+                __m128i low = _mm_cmpeq_epi8(_mm_and_si128(bytes, mask_low), mask_low);
+                __m128i result = _mm_or_si128(base, _mm_or_si128(_mm_and_si128(high, high_bits), _mm_and_si128(low, low_bits)));
+                _mm_storeu_si128((__m128i *)&out[(p * 3 + v * 16 + q * 4) * ICLED_ENCODED_BYTESPERBYTE], result);
+            }
+        }
+    }
+#endif
+    ICLED_encode_pixels(&pixels[p * 3], pixel_count - p, &out[p * 3 * ICLED_ENCODED_BYTESPERBYTE]);
+}
+
+/**
+ * @brief       Render, encode and verify a range of frames.
+ */
+static void render_range(const Options *options, const ICLED_Animation_Player *player, uint32_t first, uint32_t last,
+                         std::vector<RenderedFrame> *frames)
+{
+    size_t encoded_size = ICLED_ENCODED_FRAME_SIZE(options->pixels, options->latch_bytes);
+    std::vector<uint8_t> previous(options->pixels * 3, 0);
+    std::vector<uint8_t> encoded(encoded_size, 0);
+    std::vector<uint8_t> decoded;
+    std::vector<uint8_t> update(ICLED_CODEC_MAX_FRAME_SIZE(options->pixels));
+    ICLED_Codec_Encoder encoder;
+    ICLED_codec_encoder_init(&encoder);
+
+    // The codec needs the previous frame, which belongs to the range of another thread
+    if (first > 0)
+    {
+        ICLED_animation_render(player, (first - 1) * options->period_ms, previous.data());
+    }
+
+    for (uint32_t f = first; f < last; f++)
+    {
+        RenderedFrame &rendered = (*frames)[f];
+        rendered.frame.assign(options->pixels * 3, 0);
+        ICLED_animation_render(player, f * options->period_ms, rendered.frame.data());
+
+        if (options->simd)
+        {
+            encode_pixels_simd(rendered.frame.data(), options->pixels, encoded.data());
+        }
+        else
+        {
+            ICLED_encode_pixels(rendered.frame.data(), options->pixels, encoded.data());
+        }
+
+        bool latched;
+        rendered.valid = waveform_decode(encoded.data(), encoded.size(), decoded, &latched) && latched &&
+                         decoded == rendered.frame;
+
+        if (options->format == ICLED_Show_Format_Encoded)
+        {
+            rendered.output = encoded;
+        }
+        else
+        {
+            size_t size = ICLED_codec_encode(&encoder, (f == 0) ? NULL : previous.data(), rendered.frame.data(),
+                                             options->pixels, update.data(), update.size());
+            rendered.output.assign(update.begin(), update.begin() + size);
+            rendered.valid &= (size > 0);
+        }
+
+        previous = rendered.frame;
+    }
+}
+
+/**
+ * @brief       Build the example animation of main.cpp (TEST7) for the given number of pixels.
+ */
+static std::vector<uint8_t> demo_animation(int pixels)
+{
+    const uint8_t show[] = {
+        ICLED_ANIMATION_HEADER(ICLED_ANIMATION_FLAG_LOOP, 20, 2),
+        ICLED_ANIMATION_SEGMENT(0, pixels / 2, 20, 3),
+        ICLED_ANIMATION_KEY(255, 0, 0, ICLED_Easing_EaseInOut, 1000),
+        ICLED_ANIMATION_KEY(0, 0, 255, ICLED_Easing_EaseInOut, 1000),
+        ICLED_ANIMATION_KEY(255, 0, 255, ICLED_Easing_Linear, 500),
+        ICLED_ANIMATION_SEGMENT(pixels / 2, pixels - pixels / 2, 0, 2),
+        ICLED_ANIMATION_KEY(0, 16, 0, ICLED_Easing_EaseIn, 1500),
+        ICLED_ANIMATION_KEY(0, 255, 0, ICLED_Easing_EaseOut, 1500),
+    };
+    return std::vector<uint8_t>(show, show + sizeof(show));
+}
+
+static bool read_file(const char *path, std::vector<uint8_t> &data)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        perror(path);
+        return false;
+    }
+
+    uint8_t buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+        data.insert(data.end(), buffer, buffer + n);
+    }
+    fclose(file);
+    return true;
+}
+
+/**
+ * @brief       Parse a decimal number in the range [min, max].
+ *
+ * @return      False if the text is no number or the number is out of range.
+ */
+static bool parse_number(const char *text, unsigned long min, unsigned long max, unsigned long *value)
+{
+    char *end;
+    errno = 0;
+    unsigned long number = strtoul(text, &end, 10);
+    if (errno != 0 || end == text || *end != '\0' || text[0] == '-' || number < min || number > max)
+    {
+        fprintf(stderr, "%s is not a number between %lu and %lu\n", text, min, max);
+        return false;
+    }
+    *value = number;
+    return true;
+}
+
+static int usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [--pixels N] [--period MS] [--frames N] [--format codec|encoded] [--threads N] [--latch N] [--no-simd]\n"
+                    "       <animation file | --demo> <output show>\n",
+            name);
+    return 2;
+}
+
+int main(int argc, char *argv[])
+{
+    Options options = {ICLED_NUM, 20, 0, ICLED_Show_Format_Codec, std::thread::hardware_concurrency(), ICLED_LATCHBYTECOUNT, true};
+    const char *positional[2] = {NULL, NULL};
+    int positional_count = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--no-simd") == 0)
+        {
+            options.simd = false;
+        }
+        else if (strcmp(argv[i], "--demo") == 0 && positional_count < 2)
+        {
+            positional[positional_count++] = argv[i];
+        }
+        else if (strncmp(argv[i], "--", 2) == 0 && i + 1 < argc)
+        {
+            const char *value = argv[++i];
+            unsigned long number;
+            if (strcmp(argv[i - 1], "--pixels") == 0 && parse_number(value, 1, 0xFFFF, &number))
+                options.pixels = (int)number;
+            else if (strcmp(argv[i - 1], "--period") == 0 && parse_number(value, 1, 0xFFFF, &number))
+                options.period_ms = (uint16_t)number;
+            else if (strcmp(argv[i - 1], "--frames") == 0 && parse_number(value, 0, 0xFFFFFFFF, &number))
+                options.frames = (uint32_t)number;
+            else if (strcmp(argv[i - 1], "--threads") == 0 && parse_number(value, 0, 1024, &number))
+                options.threads = (unsigned)number;
+            else if (strcmp(argv[i - 1], "--latch") == 0 && parse_number(value, SHOW_MIN_LATCH_BYTES, 0xFFFF, &number))
+                options.latch_bytes = (uint16_t)number;
+            else if (strcmp(argv[i - 1], "--format") == 0 && strcmp(value, "codec") == 0)
+                options.format = ICLED_Show_Format_Codec;
+            else if (strcmp(argv[i - 1], "--format") == 0 && strcmp(value, "encoded") == 0)
+                options.format = ICLED_Show_Format_Encoded;
+            else
+                return usage(argv[0]);
+        }
+        else if (positional_count < 2)
+        {
+            positional[positional_count++] = argv[i];
+        }
+        else
+        {
+            return usage(argv[0]);
+        }
+    }
+
+    if (positional_count != 2)
+    {
+        return usage(argv[0]);
+    }
+    // Every compressed frame update is preceded by a 16 bit length
+    if (options.format == ICLED_Show_Format_Codec && options.pixels > ICLED_CODEC_MAX_PIXEL_COUNT)
+    {
+        fprintf(stderr, "--format codec supports at most %d pixels\n", ICLED_CODEC_MAX_PIXEL_COUNT);
+        return usage(argv[0]);
+    }
+    if (options.threads == 0)
+    {
+        options.threads = 1;
+    }
+
+    std::vector<uint8_t> animation;
+    if (strcmp(positional[0], "--demo") == 0)
+    {
+        animation = demo_animation(options.pixels);
+    }
+    else if (!read_file(positional[0], animation))
+    {
+        return 1;
+    }
+
+    ICLED_Animation_Player player;
+    if (!ICLED_animation_start(&player, animation.data(), animation.size(), (uint16_t)options.pixels, 0))
+    {
+        fprintf(stderr, "%s is not a valid animation for %d pixels\n", positional[0], options.pixels);
+        return 1;
+    }
+
+    if (options.frames == 0)
+    {
+        bool loop = (animation[3] & ICLED_ANIMATION_FLAG_LOOP) != 0;
+        options.frames = loop ? 500 : player.duration_ms / options.period_ms + 1;
+    }
+
+    std::vector<RenderedFrame> frames(options.frames);
+    std::vector<std::thread> workers;
+    uint32_t per_thread = (options.frames + options.threads - 1) / options.threads;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t first = 0; first < options.frames; first += per_thread)
+    {
+        uint32_t last = (first + per_thread < options.frames) ? first + per_thread : options.frames;
+        workers.push_back(std::thread(render_range, &options, &player, first, last, &frames));
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Check the frame updates in playback order, as the firmware decodes them
+    uint32_t errors = 0;
+    std::vector<uint8_t> pixels(options.pixels * 3, 0);
+    ICLED_Codec_Decoder decoder;
+    ICLED_codec_decoder_init(&decoder);
+    for (uint32_t f = 0; f < options.frames; f++)
+    {
+        bool valid = frames[f].valid;
+        if (options.format == ICLED_Show_Format_Codec)
+        {
+            valid &= ICLED_codec_decode(&decoder, frames[f].output.data(), frames[f].output.size(), pixels.data(), (uint16_t)options.pixels) &&
+                     pixels == frames[f].frame;
+        }
+        if (!valid)
+        {
+            fprintf(stderr, "Frame %u failed verification\n", f);
+            errors++;
+        }
+    }
+    if (errors != 0)
+    {
+        fprintf(stderr, "verification FAILED (%u errors), %s not written\n", errors, positional[1]);
+        return 1;
+    }
+
+    FILE *out = fopen(positional[1], "wb");
+    if (out == NULL)
+    {
+        perror(positional[1]);
+        return 1;
+    }
+
+    ICLED_Show_Header header = {options.format, (uint16_t)options.pixels, options.frames, options.period_ms, options.latch_bytes};
+    uint8_t header_data[ICLED_SHOW_HEADER_SIZE];
+    ICLED_show_write_header(&header, header_data);
+    bool written = fwrite(header_data, 1, sizeof(header_data), out) == sizeof(header_data);
+
+    size_t total = sizeof(header_data);
+    for (const RenderedFrame &frame : frames)
+    {
+        if (options.format == ICLED_Show_Format_Codec)
+        {
+            uint8_t length[ICLED_SHOW_FRAME_LENGTH_SIZE] = {(uint8_t)(frame.output.size() & 0xFF), (uint8_t)(frame.output.size() >> 8)};
+            written &= fwrite(length, 1, sizeof(length), out) == sizeof(length);
+            total += sizeof(length);
+        }
+        written &= fwrite(frame.output.data(), 1, frame.output.size(), out) == frame.output.size();
+        total += frame.output.size();
+    }
+    written &= (fclose(out) == 0);
+    if (!written)
+    {
+        perror(positional[1]);
+        remove(positional[1]);
+        return 1;
+    }
+
+    printf("%u frames x %d pixels, %u threads, %s bit-expansion\n", options.frames, options.pixels, (unsigned)workers.size(),
+#if defined(__SSSE3__)
+           options.simd ? "SSSE3" : "scalar"
+#else
+           "scalar"
+#endif
+    );
+    printf("rendered in %.3f s: %.0f frames/s\n", seconds, options.frames / seconds);
+    printf("show file %zu bytes (%.1f bytes/frame, raw %d bytes/frame)\n", total, (double)(total - ICLED_SHOW_HEADER_SIZE) / options.frames,
+           options.pixels * 3);
+    printf("verification: passed\n");
+
+    return 0;
+}
@@ -0,0 +1,313 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+/*
+ * Host tool for the show store on the Feather's SPI flash (see ICLED_24bit_show_store.h).
+ * It works on a flash image file through the file-backed stand-in in flash_file.h.
+ *
+ *   show_store <image> format
+ *       Creates an erased 2 MB image or formats an existing one.
+ *
+ *   show_store <image> add <name> <show file>
+ *       Appends a show file written by show_compiler.
+ *
+ *   show_store <image> list
+ *       Lists the store entries.
+ *
+ *   show_store <image> bench <name> [--sync]
+ *       Streams the show through the player like the firmware does, verifies every frame
+ *       and reports the host throughput and the estimated flash read time per frame on the
+ *       Feather. --sync uses blocking reads instead of the asynchronous read path.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "ICLED_24bit_codec.h"
+#include "ICLED_24bit_encoder.h"
+#include "ICLED_24bit_show.h"
+#include "ICLED_24bit_show_store.h"
+#include "flash_file.h"
+#include "waveform_decoder.h"
+
+// Feather SPI flash clock and ICLED SPI clock
+#define FEATHER_FLASH_CLOCK 12000000.0
+#define FEATHER_ICLED_CLOCK 3200000.0
+// Read command and 24 bit address
+#define FEATHER_READ_OVERHEAD 4
+// Polls of the player between two frames in the benchmark
+#define BENCH_POLLS_PER_FRAME 4
+
+static int run_format(const ICLED_Flash *flash)
+{
+    if (!ICLED_store_format(flash))
+    {
+        fprintf(stderr, "Formatting failed\n");
+        return 1;
+    }
+    printf("Formatted %u bytes\n", flash->size);
+    return 0;
+}
+
+static int run_add(const ICLED_Flash *flash, FlashFile *image, const char *name, const char *path)
+{
+    FILE *in = fopen(path, "rb");
+    if (in == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+    std::vector<uint8_t> show;
+    uint8_t buffer[ICLED_STORE_SECTOR_SIZE];
+    size_t size;
+    while ((size = fread(buffer, 1, sizeof(buffer), in)) > 0)
+    {
+        show.insert(show.end(), buffer, buffer + size);
+    }
+    fclose(in);
+
+    ICLED_Show_Header header;
+    if (show.size() < ICLED_SHOW_HEADER_SIZE || !ICLED_show_read_header(show.data(), &header))
+    {
+        fprintf(stderr, "%s is no show file\n", path);
+        return 1;
+    }
+
+    ICLED_Store_Writer writer;
+    bool ok = ICLED_store_append_begin(&writer, flash, name, (uint32_t)show.size());
+    for (size_t offset = 0; ok && offset < show.size(); offset += ICLED_STORE_SECTOR_SIZE)
+    {
+        size_t chunk = std::min((size_t)ICLED_STORE_SECTOR_SIZE, show.size() - offset);
+        ok = ICLED_store_append(&writer, &show[offset], (uint32_t)chunk);
+    }
+    ok = ok && ICLED_store_append_end(&writer);
+
+    if (!ok)
+    {
+        fprintf(stderr, "Adding %s failed\n", name);
+        return 1;
+    }
+
+    printf("Added %s: %zu bytes at 0x%06X, %u pages programmed, %u sectors erased\n", name, show.size(),
+           writer.header_address, image->pages_programmed, image->sectors_erased);
+    return 0;
+}
+
+static int run_list(const ICLED_Flash *flash)
+{
+    ICLED_Store_Entry entry;
+    uint32_t address = 0;
+    uint32_t used = 0;
+
+    printf("%-16s %10s %10s %-10s %s\n", "name", "address", "bytes", "state", "show");
+    while (ICLED_store_next(flash, &address, &entry))
+    {
+        uint8_t data[ICLED_SHOW_HEADER_SIZE];
+        ICLED_Show_Header header;
+        char show[64] = "-";
+
+        if (entry.length >= ICLED_SHOW_HEADER_SIZE && flash->read(flash->context, entry.address, data, sizeof(data)) &&
+            ICLED_show_read_header(data, &header))
+        {
+            snprintf(show, sizeof(show), "%s, %u pixels, %u frames, %u ms",
+                     header.format == ICLED_Show_Format_Encoded ? "encoded" : "codec", header.pixel_count,
+                     header.frame_count, header.frame_period_ms);
+        }
+
+        printf("%-16s   0x%06X %10u %-10s %s\n", entry.name, entry.address, entry.length,
+               entry.complete ? "complete" : "incomplete", show);
+        used = address;
+    }
+    printf("%u of %u bytes used\n", used, flash->size);
+    return 0;
+}
+
+/**
+ * @brief       Check a frame taken from the player against the frame read directly from the show.
+ */
+static bool verify_frame(const ICLED_Show_Header &header, ICLED_Codec_Decoder *decoder, std::vector<uint8_t> &pixels,
+                         const uint8_t *frame, uint32_t length, const uint8_t *expected, size_t expected_length)
+{
+    if (length != expected_length || memcmp(frame, expected, length) != 0)
+    {
+        return false;
+    }
+
+    if (header.format == ICLED_Show_Format_Codec)
+    {
+        return ICLED_codec_decode(decoder, frame, length, pixels.data(), header.pixel_count);
+    }
+
+    std::vector<uint8_t> data;
+    bool latched;
+    return waveform_decode(frame, length, data, &latched) && latched && data.size() == (size_t)header.pixel_count * 3;
+}
+
+static int run_bench(const ICLED_Flash *flash, FlashFile *image, const char *name, bool sync)
+{
+    ICLED_Store_Entry entry;
+    if (!ICLED_store_find(flash, name, &entry))
+    {
+        fprintf(stderr, "%s not found\n", name);
+        return 1;
+    }
+
+    // Reference copy of the whole show, read with plain blocking reads
+    std::vector<uint8_t> show(entry.length);
+    ICLED_Show_Header header;
+    if (!flash->read(flash->context, entry.address, show.data(), entry.length) || !ICLED_show_read_header(show.data(), &header))
+    {
+        fprintf(stderr, "%s is no show\n", name);
+        return 1;
+    }
+
+    ICLED_Flash backend = *flash;
+    if (sync)
+    {
+        backend.read_async = NULL;
+        backend.is_busy = NULL;
+    }
+
+    // Same ring buffer setup as ICLED_demo_FlashShow()
+    bool encoded = (header.format == ICLED_Show_Format_Encoded);
+    size_t slot_size = ICLED_show_player_slot_size(&header);
+    std::vector<uint8_t> ring(3 * ICLED_ENCODED_FRAME_SIZE(header.pixel_count, header.latch_bytes));
+    uint8_t hold = 2;
+
+    ICLED_Codec_Decoder decoder;
+    ICLED_codec_decoder_init(&decoder);
+    std::vector<uint8_t> pixels(header.pixel_count * 3);
+
+    ICLED_Show_Player player;
+    image->reads = 0;
+    image->bytes_read = 0;
+
+    auto t0 = std::chrono::steady_clock::now();
+    if (!ICLED_show_player_open(&player, &backend, &entry, ring.data(), ring.size(), hold, false))
+    {
+        fprintf(stderr, "Opening %s failed\n", name);
+        return 1;
+    }
+
+    size_t offset = ICLED_SHOW_HEADER_SIZE;
+    uint32_t errors = 0;
+    uint32_t frames = 0;
+    while (!ICLED_show_player_finished(&player))
+    {
+        for (int i = 0; i < BENCH_POLLS_PER_FRAME; i++)
+        {
+            if (!ICLED_show_player_poll(&player))
+            {
+                fprintf(stderr, "Reading frame %u failed\n", frames);
+                return 1;
+            }
+        }
+
+        uint32_t length;
+        const uint8_t *frame = ICLED_show_player_take(&player, &length);
+        if (frame == NULL)
+        {
+            continue;
+        }
+
+        size_t expected_length = slot_size;
+        if (!encoded)
+        {
+            expected_length = show[offset] | (show[offset + 1] << 8);
+            offset += ICLED_SHOW_FRAME_LENGTH_SIZE;
+        }
+        if (offset + expected_length > show.size() ||
+            !verify_frame(header, &decoder, pixels, frame, length, &show[offset], expected_length))
+        {
+            errors++;
+        }
+        offset += expected_length;
+        frames++;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(t1 - t0).count();
+
+    double bytes_per_frame = (double)image->bytes_read / frames;
+    double reads_per_frame = (double)image->reads / frames;
+    double flash_us = (bytes_per_frame + reads_per_frame * FEATHER_READ_OVERHEAD) * 8 / FEATHER_FLASH_CLOCK * 1e6;
+    double icled_us = ICLED_ENCODED_FRAME_SIZE(header.pixel_count, header.latch_bytes) * 8 / FEATHER_ICLED_CLOCK * 1e6;
+
+    printf("%s: %s, %u pixels, %u frames, %u ms period, ring %zu bytes (%u slots)\n", name, encoded ? "encoded" : "codec",
+           header.pixel_count, header.frame_count, header.frame_period_ms, ring.size(), player.slot_count);
+    printf("host:    %.0f frames/s, %.1f MB/s, %u underruns\n", frames / seconds, image->bytes_read / seconds / 1e6, player.underruns);
+    printf("feather: %.0f bytes/frame in %.2f reads, flash read %.0f us/frame (%.1f%% of the frame period), ICLED transfer %.0f us\n",
+           bytes_per_frame, reads_per_frame, flash_us, header.frame_period_ms ? flash_us / (header.frame_period_ms * 10.0) : 0.0, icled_us);
+    printf("verification: %u of %u frames %s\n", frames - errors, header.frame_count, errors || frames != header.frame_count ? "FAILED" : "ok");
+
+    return (errors == 0 && frames == header.frame_count) ? 0 : 1;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s <image> format\n"
+                        "       %s <image> add <name> <show file>\n"
+                        "       %s <image> list\n"
+                        "       %s <image> bench <name> [--sync]\n",
+                argv[0], argv[0], argv[0], argv[0]);
+        return 2;
+    }
+
+    FlashFile image;
+    ICLED_Flash flash;
+    if (!flash_file_open(&image, &flash, argv[1]))
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    int result = 2;
+    if (strcmp(argv[2], "format") == 0)
+    {
+        result = run_format(&flash);
+    }
+    else if (strcmp(argv[2], "add") == 0 && argc >= 5)
+    {
+        result = run_add(&flash, &image, argv[3], argv[4]);
+    }
+    else if (strcmp(argv[2], "list") == 0)
+    {
+        result = run_list(&flash);
+    }
+    else if (strcmp(argv[2], "bench") == 0 && argc >= 4)
+    {
+        result = run_bench(&flash, &image, argv[3], argc >= 5 && strcmp(argv[4], "--sync") == 0);
+    }
+    else
+    {
+        fprintf(stderr, "Unknown command %s\n", argv[2]);
+    }
+
+    flash_file_close(&image);
+    return result;
+}
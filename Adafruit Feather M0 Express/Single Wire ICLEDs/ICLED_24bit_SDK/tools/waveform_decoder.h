@@ -0,0 +1,120 @@
+/**
+***************************************************************************************************
+* This file is part of ICLED SDK:
+*
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+
+/*
+ * Host side decoder for the ICLED data line waveform.
+ *
+ * Interprets an SPI byte stream the way the ICLED does: the MOSI output is treated as a
+ * bit stream at 3.2 MHz, every high pulse is classified by its width (one bit time for a
+ * logical "0", two or more bit times for a logical "1") and a low time of at least
+ * reset_bits bit times latches the data. It deliberately does not use the encoder's pattern
+ * table, so it independently verifies the encoded output.
+ */
+
+#ifndef WAVEFORM_DECODER_H
+#define WAVEFORM_DECODER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+// 200 us reset time at 0.3125 us per bit
+#define WAVEFORM_RESET_BITS 640
+
+/**
+ * @brief       Decode the data bytes of one frame from an SPI byte stream.
+ *
+ * @param[in]   stream: SPI byte stream.
+ * @param[in]   length: Length of the stream in bytes.
+ * @param[out]  data: Decoded data bytes (G, R, B per pixel).
+ * @param[out]  latched: True if the data was followed by a reset (latch).
+ *
+ * @return      True if all pulses were valid, false otherwise.
+ */
+static inline bool waveform_decode(const uint8_t *stream, size_t length, std::vector<uint8_t> &data, bool *latched,
+                                   size_t reset_bits = WAVEFORM_RESET_BITS)
+{
+    size_t high = 0;
+    size_t low = 0;
+    uint8_t value = 0;
+    int bit_count = 0;
+
+    data.clear();
+    *latched = false;
+
+    for (size_t i = 0; i < length * 8; i++)
+    {
+        bool level = (stream[i / 8] >> (7 - (i % 8))) & 0x1;
+
+        if (level)
+        {
+            if (low > 0 && high > 0)
+            {
+                // Rising edge: the previous pulse is complete
+                if (high > 3 || high + low != 4)
+                {
+                    return false;
+                }
+                value = (uint8_t)((value << 1) | (high >= 2 ? 1 : 0));
+                if (++bit_count == 8)
+                {
+                    data.push_back(value);
+                    bit_count = 0;
+                }
+                high = 0;
+            }
+            low = 0;
+            high++;
+        }
+        else
+        {
+            low++;
+            if (low >= reset_bits)
+            {
+                *latched = true;
+                break;
+            }
+        }
+    }
+
+    // The last pulse is terminated by the reset
+    if (high > 0)
+    {
+        if (high > 3 || low < 4 - high)
+        {
+            return false;
+        }
+        value = (uint8_t)((value << 1) | (high >= 2 ? 1 : 0));
+        if (++bit_count == 8)
+        {
+            data.push_back(value);
+            bit_count = 0;
+        }
+    }
+
+    return bit_count == 0;
+}
+
+#endif
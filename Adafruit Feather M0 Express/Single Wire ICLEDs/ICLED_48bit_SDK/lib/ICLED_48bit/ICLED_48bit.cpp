@@ -41,6 +41,8 @@ static ICLED_Color_System ColorSystem = RGB;
 
 static uint8_t dmaBuf[ICLED_BYTESTOTAL]; // The raw buffer we write to SPI
 static Adafruit_ZeroDMA dma; ///< The DMA manager for the SPI class
+static DmacDescriptor *dmaDesc; ///< DMA descriptor, set while the DMA channel is allocated
+static PlatformPool<SPIClass> spiPool; ///< Storage of the SPI interface, static with WE_STATIC_ALLOCATION
 static SPIClass *spi;        ///< Underlying SPI hardware interface we use to DMA
 
 #define MIN_LOOP_DELAY_MS 5
@@ -58,7 +60,7 @@ typedef union
 } Pixel;
 
 // Buffer for LEDs --> will be written into dmaBuf after bit-expansion
-static Pixel LEDBuf[ICLED_BYTESTOTAL];
+static Pixel LEDBuf[ICLED_NUM];
 
 // Bit patterns for data encoding
 #define ZEROPATTERN 0x8  // 4-bit pattern for logical "0"
@@ -74,15 +76,30 @@ bool ICLED_Init(ICLED_Color_System color_system)
     // Set color system to given color system
     ColorSystem = color_system;
 
+    // Restart if already initialized
+    if (spi != NULL)
+    {
+        ICLED_Deinit();
+    }
+
     // Clear buffer and set all values to zero
     ICLED_clear();
 
-    spi = new SPIClass(&sercom5, ICLED_DIN_PIN, ICLED_DIN_PIN, ICLED_DIN_PIN, SPI_PAD_2_SCK_3, SERCOM_RX_PAD_1);
+    spi = spiPool.create(&sercom5, ICLED_DIN_PIN, ICLED_DIN_PIN, ICLED_DIN_PIN, SPI_PAD_2_SCK_3, SERCOM_RX_PAD_1);
+    if (spi == NULL)
+    {
+        WE_DEBUG_PRINT("Failed to allocate SPI interface.\r\n");
+        return false;
+    }
     spi->begin();
 
+    WE_Memory_AddBuffer("icled-pixels", sizeof(LEDBuf));
+    WE_Memory_AddBuffer("icled-dma", sizeof(dmaBuf));
+
     if (pinPeripheral(ICLED_DIN_PIN, PIO_SERCOM) < 0)
     {
         WE_DEBUG_PRINT("Problem changing pin %d configuration.\r\n", ICLED_DIN_PIN);
+        ICLED_Deinit();
         return false;
     }
 
@@ -92,12 +109,15 @@ bool ICLED_Init(ICLED_Color_System color_system)
     if (dma.allocate() != DMA_STATUS_OK)
     {
         WE_DEBUG_PRINT("Failed to allocate DMA channel.\r\n");
+        ICLED_Deinit();
         return false;
     }
 
-    if (dma.addDescriptor(dmaBuf, (void *)(&SERCOM5->SPI.DATA.reg), ICLED_BYTESTOTAL, DMA_BEAT_SIZE_BYTE, true, false) == NULL)
+    dmaDesc = dma.addDescriptor(dmaBuf, (void *)(&SERCOM5->SPI.DATA.reg), ICLED_BYTESTOTAL, DMA_BEAT_SIZE_BYTE, true, false);
+    if (dmaDesc == NULL)
     {
         WE_DEBUG_PRINT("Failed to allocate DMA descriptor.\r\n");
+        ICLED_Deinit();
         return false;
     }
 
@@ -109,6 +129,7 @@ bool ICLED_Init(ICLED_Color_System color_system)
     if (dma.startJob() != DMA_STATUS_OK)
     {
         WE_DEBUG_PRINT("Failed to start DMA job.\r\n");
+        ICLED_Deinit();
         return false;
     }
 
@@ -122,15 +143,24 @@ bool ICLED_Deinit()
 
     dma.abort();
 
-    if (dma.free() != DMA_STATUS_OK)
+    // Also called to clean up after a failed ICLED_Init(), the channel may not be allocated yet
+    bool freed = (dma.free() == DMA_STATUS_OK) || (dmaDesc == NULL);
+    dmaDesc = NULL;
+
+    if (spi != NULL)
+    {
+        spi->endTransaction();
+        spi->end();
+        spiPool.destroy(spi);
+        spi = NULL;
+    }
+
+    if (!freed)
     {
         WE_DEBUG_PRINT("Failed to free DMA channel.\r\n");
         return false;
     }
 
-    spi->endTransaction();
-    delete spi;
-
     return true;
 }
 
@@ -172,6 +202,10 @@ bool ICLED_set_pixel(uint16_t pixel_number, uint16_t R, uint16_t G, uint16_t B,
 
 static void write_ledbuffer_to_DMAbuffer()
 {
+    // The DMA sends dmaBuf over and over again, every frame is written while it is being sent
+    WE_FrameMonitor_Render(true);
+    WE_PROFILE_BEGIN(WE_PROFILE_ZONE_ICLED_ENCODE);
+    WE_EVENT_BEGIN(WE_EVENT_ID_ICLED_ENCODE);
     for (int i = 0; i < ICLED_NUM; i++)
     {
         for (uint8_t colorIdx = 0; colorIdx < 3; colorIdx++)
@@ -196,6 +230,10 @@ static void write_ledbuffer_to_DMAbuffer()
             }
         }
     }
+    WE_EVENT_END(WE_EVENT_ID_ICLED_ENCODE);
+    WE_PROFILE_END(WE_PROFILE_ZONE_ICLED_ENCODE);
+    // The looping transfer picks the frame up, there is no latch per frame
+    WE_FrameMonitor_DmaStart();
 }
 
 bool ICLED_set_all_pixels(uint16_t R, uint16_t G, uint16_t B, bool write_buffer)
@@ -222,6 +260,13 @@ void ICLED_clear(bool write_buffer)
 
     if (write_buffer)
     {
+        WE_FrameMonitor_Render(true);
         memset(dmaBuf, 0, sizeof(dmaBuf));
+        WE_FrameMonitor_DmaStart();
     }
 }
+
+void ICLED_write_buffer()
+{
+    write_ledbuffer_to_DMAbuffer();
+}
@@ -134,4 +134,11 @@ ICLED_Color_System ICLED_get_color_system();
  */
 void ICLED_clear(bool write_buffer = true);
 
+/**
+ * @brief       Apply the current LED buffer to the LED screen, e.g. after setting pixels with write_buffer false.
+ *
+ * @return      None
+ */
+void ICLED_write_buffer();
+
 #endif
@@ -30,6 +30,7 @@
 
 bool ICLED_demo_Blink(uint16_t pixel_number, uint16_t delay_ms)
 {
+    WE_FrameMonitor_SetPeriod(delay_ms * 1000UL);
     uint16_t LED_current = 0x4;         // 25% of maximum current (4-bit value)
     uint16_t LED_brightness = 0xFFF;    // Maximum PWM brightness (12-bit value)
     uint16_t LED_off = 0x000;           // LED off state
@@ -63,6 +64,7 @@ bool ICLED_demo_Blink(uint16_t pixel_number, uint16_t delay_ms)
 
 bool ICLED_demo_Breathing( uint16_t delay_ms)
 {
+    WE_FrameMonitor_SetPeriod(delay_ms * 1000UL);
     uint16_t LED_current = 0x4; // 25% of maximum current (4-bit value)
     uint16_t LED_brightness = 0xFFF; // Maximum PWM brightness (12-bit value)
     
@@ -95,6 +97,7 @@ bool ICLED_demo_Breathing( uint16_t delay_ms)
 
 bool ICLED_demo_ColorWhipe(uint16_t R, uint16_t G, uint16_t B, uint16_t delay_ms)
 {
+    WE_FrameMonitor_SetPeriod(delay_ms * 1000UL);
     for (int i = 0; i < ICLED_NUM; i++)
     {
         ICLED_set_pixel(i, R, G, B);
@@ -110,6 +113,7 @@ bool ICLED_demo_ColorWhipe(uint16_t R, uint16_t G, uint16_t B, uint16_t delay_ms
 
 bool ICLED_demo_Cyclon(uint16_t R, uint16_t G, uint16_t B, uint16_t delay_ms)
 {
+    WE_FrameMonitor_SetPeriod(delay_ms * 1000UL);
     // Scan from left to right
     for (int i = 0; i < ICLED_NUM; i++)
     {
@@ -137,6 +141,7 @@ bool ICLED_demo_Cyclon(uint16_t R, uint16_t G, uint16_t B, uint16_t delay_ms)
 
 bool ICLED_demo_Rainbow(uint16_t delay_ms) 
 {
+    WE_FrameMonitor_SetPeriod(delay_ms * 1000UL);
     uint16_t LED_current = 0x1; // 25% of maximum current (4-bit value)
 
     for (int i = 0; i < 4096; i++) 
@@ -157,8 +162,10 @@ bool ICLED_demo_Rainbow(uint16_t delay_ms)
              uint16_t B  = (LED_current << 12) | (b  & 0xFFF);
  
              // Set the color for the j-th pixel
-             ICLED_set_pixel(j, R, G, B);
+             ICLED_set_pixel(j, R, G, B, false);
          }
+         // Send all pixels as one frame
+         ICLED_write_buffer();
          WE_Delay(delay_ms);
      }
      return true;
@@ -166,19 +173,20 @@ bool ICLED_demo_Rainbow(uint16_t delay_ms)
 
  bool ICLED_demo_TheaterChase(uint16_t R, uint16_t G, uint16_t B, uint16_t delay_ms) 
  {     
+     WE_FrameMonitor_SetPeriod(delay_ms * 1000UL);
      for (int j = 0; j < 10; j++) 
      {  
          // Do 10 cycles of chasing
          for (int q = 0; q < 3; q++) 
          {
+             ICLED_clear(false);
              for (int i = 0; i < ICLED_NUM; i += 3) 
              {
-                 ICLED_set_pixel(i + q, R, G, B);
+                 ICLED_set_pixel(i + q, R, G, B, false);
              }
+             ICLED_write_buffer();
              
              WE_Delay(delay_ms);
-             
-             ICLED_clear();
          }
      }
      return true;
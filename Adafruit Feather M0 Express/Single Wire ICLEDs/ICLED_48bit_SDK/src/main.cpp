@@ -45,6 +45,9 @@ static volatile TestMode current_mode = TEST1;
 
 void setup() 
 {
+  // Start the microsecond clock before anything reads it
+  WE_InitTimebase();
+
   // Using the USB serial port for debug messages
   #ifdef WE_DEBUG
     WE_Debug_Init();
@@ -59,6 +62,9 @@ void setup()
 
 void loop() {
 
+  // Commands on the debug serial, e.g. 'm' prints the RAM usage (see WE_Debug_Poll())
+  WE_Debug_Poll();
+
   ICLED_set_color_system(RGB);
 
   switch (current_mode)